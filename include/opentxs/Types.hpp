@@ -25,8 +25,10 @@
 #define OPENTXS_ARG_BACKUP_DIRECTORY "backupdirectory"
 #define OPENTXS_ARG_BINDIP "bindip"
 #define OPENTXS_ARG_BLOCKCHAIN_SYNC "blockchainsync"
+#define OPENTXS_ARG_BLOCK_CACHE_SIZE "blockcachesize"
 #define OPENTXS_ARG_BLOCK_STORAGE_LEVEL "blockstoragelevel"
 #define OPENTXS_ARG_COMMANDPORT "commandport"
+#define OPENTXS_ARG_COMPACT_BLOCK_DB "compactblockdb"
 #define OPENTXS_ARG_DISABLED_BLOCKCHAINS "disabledblockchain"
 #define OPENTXS_ARG_EEP "eep"
 #define OPENTXS_ARG_ENCRYPTED_DIRECTORY "encrypteddirectory"
@@ -39,7 +41,9 @@
 #define OPENTXS_ARG_LISTENNOTIFY "listennotify"
 #define OPENTXS_ARG_LOGENDPOINT "logendpoint"
 #define OPENTXS_ARG_LOGLEVEL "log_level"
+#define OPENTXS_ARG_MEMPOOL_SIZE "mempoolsize"
 #define OPENTXS_ARG_NAME "name"
+#define OPENTXS_ARG_NOTARY_WORKERS "notaryworkers"
 #define OPENTXS_ARG_NOTIFICATIONPORT "notificationport"
 #define OPENTXS_ARG_ONION "onion"
 #define OPENTXS_ARG_PASSPHRASE "passphrase"
@@ -82,7 +82,7 @@ public:
     /** Blockchain mempool updates
      *
      *  A subscribe socket can connect to this endpoint to receive
-     *  BlockchainMempoolUpdated tagged messages
+     *  BlockchainMempoolUpdated and BlockchainMempoolStats tagged messages
      *
      *  See opentxs/util/WorkTypes.hpp for message format documentation
      *
@@ -55,6 +55,24 @@ public:
         const BIP44Chain internal,
         const Bip32Index index,
         const PasswordPrompt& reason) const = 0;
+    /**   Derive public keys for count consecutive children of an account
+     *    chain, starting at index first
+     *
+     *    The account level node is derived from the seed the first time a
+     *    path is used and kept in memory afterwards, so subsequent calls
+     *    neither decrypt the seed nor repeat any hardened derivations. The
+     *    returned keys do not contain private key data.
+     *
+     *    Returns an empty vector if any child can not be derived.
+     */
+    OPENTXS_NO_EXPORT virtual std::vector<
+        std::unique_ptr<opentxs::crypto::key::HD>>
+    AccountChildPublicKeys(
+        const proto::HDPath& path,
+        const BIP44Chain internal,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const = 0;
     OPENTXS_NO_EXPORT virtual std::unique_ptr<opentxs::crypto::key::HD>
     AccountKey(
         const proto::HDPath& path,
@@ -8,8 +8,10 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <chrono>
 #include <cstddef>
 #include <functional>
+#include <map>
 #include <string>
 
 #include "opentxs/network/zeromq/Message.hpp"
@@ -37,6 +39,17 @@ public:
     using Message = opentxs::network::zeromq::Message;
     using Callback = std::function<void(const Message&)>;
     using WorkType = OTZMQWorkType;
+    using Task = std::function<void()>;
+
+    struct WorkStats {
+        std::size_t submitted_{};
+        std::size_t finished_{};
+        // Time between submission and the start of execution
+        std::chrono::nanoseconds total_wait_{};
+        std::chrono::nanoseconds max_wait_{};
+        std::chrono::nanoseconds total_run_{};
+    };
+    using Stats = std::map<WorkType, WorkStats>;
 
     OPENTXS_EXPORT static auto Capacity() noexcept -> std::size_t;
     OPENTXS_EXPORT static auto MakeWork(
@@ -44,8 +57,13 @@ public:
         WorkType type) noexcept -> OTZMQMessage;
 
     OPENTXS_EXPORT virtual auto Endpoint() const noexcept -> std::string = 0;
+    OPENTXS_EXPORT virtual auto QueueDepth() const noexcept -> std::size_t = 0;
     OPENTXS_EXPORT virtual auto Register(WorkType type, Callback handler)
         const noexcept -> bool = 0;
+    OPENTXS_EXPORT virtual auto Statistics() const noexcept -> Stats = 0;
+    // Queue a task for execution without serializing it into a message
+    OPENTXS_EXPORT virtual auto Submit(WorkType type, Task&& task)
+        const noexcept -> bool = 0;
 
     virtual ~ThreadPool() = default;
 
@@ -10,6 +10,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/crypto/Types.hpp"
@@ -49,6 +50,16 @@ public:
         const std::uint32_t type,
         const ReadView data,
         const AllocateOutput encodedDestination) const noexcept = 0;
+    /**   Hash every input independently
+     *
+     *    The digests are written contiguously into a single allocation of
+     *    inputs.size() times the digest size. Sha256 and Sha256D inputs are
+     *    hashed in parallel SIMD lanes when the processor supports it.
+     */
+    virtual auto DigestBatch(
+        const opentxs::crypto::HashType hashType,
+        const std::vector<ReadView>& inputs,
+        const AllocateOutput destination) const noexcept -> bool = 0;
     virtual bool HMAC(
         const opentxs::crypto::HashType hashType,
         const ReadView key,
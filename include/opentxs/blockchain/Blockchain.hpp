@@ -57,6 +57,13 @@ OPENTXS_EXPORT auto MerkleHash(
     const Type chain,
     const ReadView input,
     const AllocateOutput output) noexcept -> bool;
+// Hashes every input independently. The digests are written contiguously to a
+// single allocation in the same order as the inputs.
+OPENTXS_EXPORT auto MerkleHashes(
+    const api::Core& api,
+    const Type chain,
+    const std::vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool;
 OPENTXS_EXPORT auto NumberToHash(const api::Core& api, ReadView hex) noexcept
     -> pHash;
 OPENTXS_EXPORT auto P2PMessageHash(
@@ -91,6 +98,13 @@ OPENTXS_EXPORT auto TransactionHash(
     const Type chain,
     const ReadView input,
     const AllocateOutput output) noexcept -> bool;
+// Hashes every input independently. The digests are written contiguously to a
+// single allocation in the same order as the inputs.
+OPENTXS_EXPORT auto TransactionHashes(
+    const api::Core& api,
+    const Type chain,
+    const std::vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool;
 
 namespace block
 {
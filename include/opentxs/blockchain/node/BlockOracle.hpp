@@ -10,6 +10,7 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <future>
 #include <memory>
 #include <vector>
@@ -46,6 +47,21 @@ public:
     using BlockHashes = std::vector<block::pHash>;
     using BitcoinBlockFutures = std::vector<BitcoinBlockFuture>;
 
+    struct CacheStats {
+        /// requests satisfied from the memory cache
+        std::size_t hits_{};
+        /// requests which required a database load or a download
+        std::size_t misses_{};
+        std::size_t evictions_{};
+        /// blocks loaded ahead of a sequential access pattern
+        std::size_t prefetched_{};
+        std::size_t blocks_{};
+        std::size_t bytes_{};
+        std::size_t limit_{};
+    };
+
+    OPENTXS_EXPORT virtual auto CacheStatistics() const noexcept
+        -> CacheStats = 0;
     OPENTXS_EXPORT virtual auto DownloadQueue() const noexcept
         -> std::size_t = 0;
     OPENTXS_EXPORT virtual auto LoadBitcoin(
@@ -11,10 +11,12 @@
 #include <irrxml/irrXML.hpp>
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "opentxs/Types.hpp"
 #include "opentxs/core/Contract.hpp"
@@ -44,6 +46,12 @@ struct Manager;
 }  // namespace server
 }  // namespace api
 
+namespace cron
+{
+class Journal;
+class Schedule;
+}  // namespace cron
+
 namespace identifier
 {
 class Nym;
@@ -71,6 +79,9 @@ using listOfLongNumbers = std::list<std::int64_t>;
 class OTCron final : public Contract
 {
 public:
+    using ItemLock = std::function<
+        void(const OTCronItem& item, const std::function<void()>& process)>;
+
     static std::chrono::milliseconds GetCronMsBetweenProcess()
     {
         return __cron_ms_between_process;
@@ -143,6 +154,8 @@ public:
      * as well as to call AddTransactionNumber() regularly, in order to keep
      * GetTransactionCount() at some minimum threshold. */
     void AddTransactionNumber(const std::int64_t& lTransactionNum);
+    /** Adds the numbers and records them in the cron journal. */
+    bool AddTransactionNumbers(const listOfLongNumbers& numbers);
     std::int64_t GetNextTransactionNumber();
     /** How many numbers do I currently have on the list? */
     std::int32_t GetTransactionCount() const;
@@ -151,8 +164,11 @@ public:
      * transaction numbers in there must be enough to last for the entire
      * ProcessCronItems() call, and all the trades and payment plans within,
      * since it will not be replenished again at least until the call has
-     * finished.) */
-    void ProcessCronItems();
+     * finished.)
+     *
+     * If lock is provided it is called once for every due item and must call
+     * process exactly once, while holding whatever locks the item needs. */
+    void ProcessCronItems(const ItemLock& lock = {});
 
     std::chrono::milliseconds computeTimeout();
 
@@ -204,6 +220,8 @@ private:
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
+    // Cron items keyed by the time at which they next need to be processed.
+    std::unique_ptr<cron::Schedule> m_pSchedule;
     // Always store this in any object that's associated with a specific server.
     OTServerID m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
@@ -213,6 +231,18 @@ private:
     bool m_bIsActivated{false};
     // I'll need this for later.
     Nym_p m_pServerNym{nullptr};
+    // Additions and removals are appended to the journal between snapshots of
+    // the cron file.
+    std::unique_ptr<cron::Journal> m_pJournal;
+    // Transaction numbers at the front of the list which have already been
+    // journaled as consumed.
+    std::int64_t m_lReservedNumbers{0};
+
+    bool erase_item(const std::int64_t lTransactionNum);
+    bool journal(const std::string& record, const bool durable = false);
+    bool replay(const std::string& record);
+    void schedule(const OTCronItem& item, const Time tDateAdded);
+    void unschedule(const std::int64_t lTransactionNum);
 
     explicit OTCron(const api::internal::Core& server);
 
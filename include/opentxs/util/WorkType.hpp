@@ -40,6 +40,7 @@ enum class WorkType : OTZMQWorkType {
     BlockchainWalletUpdated = 140,
     SyncServerUpdated = 141,
     BlockchainMempoolUpdated = 142,
+    BlockchainMempoolStats = 143,
     OTXConnectionStatus = 256,
     OTXTaskComplete = 257,
     OTXSearchNym = 258,
@@ -224,6 +225,14 @@ constexpr auto value(const WorkType in) noexcept
  *          1: chain type as blockchain::Type
  *          2: txid as blockchain::block::Hash (encoded as byte sequence)
  *
+ *   BlockchainMempoolStats: reports the size of the mempool after it changes
+ *       * Additional frames:
+ *          1: chain type as blockchain::Type
+ *          2: transaction count as std::size_t
+ *          3: serialized size of all transactions in bytes as std::size_t
+ *          4: lowest fee rate in satoshis per 1000 bytes as
+ *             blockchain::Amount
+ *
  *   OTXConnectionStatus: reports state changes to notary connections
  *       * Additional frames:
  *          1: notary id as identifier::Server (encoded as byte sequence)
@@ -88,9 +88,44 @@ HDSeed::HDSeed(
     , bip39_(bip39)
     , seed_lock_()
     , seeds_()
+    , node_lock_()
+    , nodes_()
 {
 }
 
+auto HDSeed::account_node(
+    const Lock& lock,
+    const proto::HDPath& rootPath,
+    const PasswordPrompt& reason) const noexcept
+    -> const opentxs::crypto::key::HD*
+{
+#if OT_CRYPTO_WITH_BIP32
+    const auto id = node_id(rootPath);
+
+    if (auto it{nodes_.find(id)}; nodes_.end() != it) {
+        return it->second.get();
+    }
+
+    auto path = Path{};
+
+    for (const auto& child : rootPath.child()) { path.emplace_back(child); }
+
+    auto pKey = GetHDKey(rootPath.root(), EcdsaCurve::secp256k1, path, reason);
+
+    if (false == bool(pKey)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to derive account key")
+            .Flush();
+
+        return nullptr;
+    }
+
+    return nodes_.try_emplace(id, std::move(pKey)).first->second.get();
+#else
+
+    return nullptr;
+#endif  // OT_CRYPTO_WITH_BIP32
+}
+
 auto HDSeed::AccountChildKey(
     const proto::HDPath& rootPath,
     const BIP44Chain internal,
@@ -121,6 +156,41 @@ auto HDSeed::AccountChildKey(
         proto::Factory<proto::HDPath>(view), internal, index, reason);
 }
 
+auto HDSeed::AccountChildPublicKeys(
+    const proto::HDPath& rootPath,
+    const BIP44Chain internal,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const
+    -> std::vector<std::unique_ptr<opentxs::crypto::key::HD>>
+{
+    auto output = std::vector<std::unique_ptr<opentxs::crypto::key::HD>>{};
+#if OT_CRYPTO_WITH_BIP32
+    auto lock = Lock{node_lock_};
+    const auto* pNode = chain_public_node(lock, rootPath, internal, reason);
+
+    if (nullptr == pNode) { return output; }
+
+    const auto& node = *pNode;
+    output.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        auto& key = output.emplace_back(
+            node.ChildKey(first + static_cast<Bip32Index>(i), reason));
+
+        if (false == bool(key)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to derive child ")(
+                first + i)
+                .Flush();
+
+            return {};
+        }
+    }
+#endif  // OT_CRYPTO_WITH_BIP32
+
+    return output;
+}
+
 auto HDSeed::AccountKey(
     const proto::HDPath& rootPath,
     const BIP44Chain internal,
@@ -128,16 +198,14 @@ auto HDSeed::AccountKey(
     -> std::unique_ptr<opentxs::crypto::key::HD>
 {
 #if OT_CRYPTO_WITH_BIP32
-    std::string fingerprint{rootPath.root()};
     const auto change =
         (INTERNAL_CHAIN == internal) ? Bip32Index{1u} : Bip32Index{0u};
-    Path path{};
+    auto lock = Lock{node_lock_};
+    const auto* account = account_node(lock, rootPath, reason);
 
-    for (const auto& child : rootPath.child()) { path.emplace_back(child); }
+    if (nullptr == account) { return {}; }
 
-    path.emplace_back(change);
-
-    return GetHDKey(fingerprint, EcdsaCurve::secp256k1, path, reason);
+    return account->ChildKey(change, reason);
 #else
 
     return {};
@@ -212,6 +280,78 @@ auto HDSeed::Bip32Root(const std::string& seedID, const PasswordPrompt& reason)
     }
 }
 
+auto HDSeed::chain_public_node(
+    const Lock& lock,
+    const proto::HDPath& rootPath,
+    const BIP44Chain internal,
+    const PasswordPrompt& reason) const noexcept
+    -> const opentxs::crypto::key::HD*
+{
+#if OT_CRYPTO_WITH_BIP32 && OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+    const auto change =
+        (INTERNAL_CHAIN == internal) ? Bip32Index{1u} : Bip32Index{0u};
+    const auto id = node_id(rootPath, std::to_string(change));
+
+    if (auto it{nodes_.find(id)}; nodes_.end() != it) {
+        return it->second.get();
+    }
+
+    const auto* account = account_node(lock, rootPath, reason);
+
+    if (nullptr == account) { return nullptr; }
+
+    const auto pChain = account->ChildKey(change, reason);
+
+    if (false == bool(pChain)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to derive chain key")
+            .Flush();
+
+        return nullptr;
+    }
+
+    const auto& chain = *pChain;
+    const auto chaincode = chain.Chaincode(reason);
+
+    if (chaincode.empty()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Missing chain code").Flush();
+
+        return nullptr;
+    }
+
+    const auto path = [&] {
+        auto out = proto::HDPath{};
+        chain.Path(out);
+
+        return out;
+    }();
+    const auto& api = asymmetric_.API();
+    // NOTE only the public half of the chain node is retained since that is
+    // all that is needed to derive the public keys of its children
+    auto pKey = std::unique_ptr<opentxs::crypto::key::HD>{factory::Secp256k1Key(
+        api,
+        api.Crypto().SECP256K1(),
+        api.Factory().Secret(0),
+        api.Factory().SecretFromBytes(chaincode),
+        api.Factory().Data(chain.PublicKey()),
+        path,
+        chain.Parent(),
+        chain.Role(),
+        chain.Version())};
+
+    if (false == bool(pKey)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to instantiate public key")
+            .Flush();
+
+        return nullptr;
+    }
+
+    return nodes_.try_emplace(id, std::move(pKey)).first->second.get();
+#else
+
+    return nullptr;
+#endif  // OT_CRYPTO_WITH_BIP32 && OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+}
+
 auto HDSeed::DefaultSeed() const -> std::string
 {
     auto lock = Lock{seed_lock_};
@@ -530,6 +670,25 @@ auto HDSeed::new_seed(
     }
 }
 
+auto HDSeed::node_id(
+    const proto::HDPath& path,
+    const std::string& suffix) noexcept -> std::string
+{
+    auto output = path.root();
+
+    for (const auto& child : path.child()) {
+        output += '/';
+        output += std::to_string(child);
+    }
+
+    if (false == suffix.empty()) {
+        output += '/';
+        output += suffix;
+    }
+
+    return output;
+}
+
 auto HDSeed::Passphrase(const std::string& seedID, const PasswordPrompt& reason)
     const -> std::string
 {
@@ -13,6 +13,7 @@
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "Proto.hpp"
 #include "crypto/Seed.hpp"
@@ -87,6 +88,13 @@ public:
         const Bip32Index index,
         const PasswordPrompt& reason) const
         -> std::unique_ptr<opentxs::crypto::key::HD> final;
+    auto AccountChildPublicKeys(
+        const proto::HDPath& path,
+        const BIP44Chain internal,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const
+        -> std::vector<std::unique_ptr<opentxs::crypto::key::HD>> final;
     auto AccountKey(
         const proto::HDPath& path,
         const BIP44Chain internal,
@@ -170,6 +178,9 @@ public:
     ~HDSeed() final = default;
 
 private:
+    // NOTE keys are stored by seed id and derivation path
+    using NodeCache =
+        std::map<std::string, std::unique_ptr<opentxs::crypto::key::HD>>;
     using SeedMap = std::map<std::string, opentxs::crypto::Seed>;
 
     const api::Factory& factory_;
@@ -182,7 +193,24 @@ private:
     const opentxs::crypto::Bip39& bip39_;
     mutable std::mutex seed_lock_;
     mutable SeedMap seeds_;
+    mutable std::mutex node_lock_;
+    mutable NodeCache nodes_;
+
+    static auto node_id(
+        const proto::HDPath& path,
+        const std::string& suffix = {}) noexcept -> std::string;
 
+    auto account_node(
+        const Lock& lock,
+        const proto::HDPath& path,
+        const PasswordPrompt& reason) const noexcept
+        -> const opentxs::crypto::key::HD*;
+    auto chain_public_node(
+        const Lock& lock,
+        const proto::HDPath& path,
+        const BIP44Chain internal,
+        const PasswordPrompt& reason) const noexcept
+        -> const opentxs::crypto::key::HD*;
     auto get_seed(
         const Lock& lock,
         const std::string& seedID,
@@ -7,10 +7,15 @@
 #include "1_Internal.hpp"      // IWYU pragma: associated
 #include "api/ThreadPool.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <thread>
 #include <utility>
 
@@ -56,42 +61,41 @@ auto ThreadPool::MakeWork(const zmq::Context& zmq, WorkType type) noexcept
 
 namespace opentxs::api::implementation
 {
-constexpr auto endpoint_{"inproc://opentxs//thread_pool/1"};
-constexpr auto internal_endpoint_{"inproc://opentxs//thread_pool/internal"};
 using Direction = zmq::socket::Socket::Direction;
 
+// Identifies the pool and worker which owns the current thread, if any
+thread_local const ThreadPool* current_pool_{nullptr};
+thread_local std::size_t current_worker_{0};
+
 ThreadPool::ThreadPool(const zmq::Context& zmq) noexcept
     : zmq_(zmq)
+    , endpoint_([] {
+        // NOTE every pool binds its own endpoint so more than one instance
+        // can exist in a process
+        static auto counter = std::atomic<int>{0};
+
+        return std::string{"inproc://opentxs//thread_pool/"} +
+               std::to_string(++counter);
+    }())
     , lock_()
     , map_()
     , running_(true)
-    , cbi_(zmq::ListenCallback::Factory([this](auto& in) { callback(in); }))
+    , pending_(0)
+    , next_(0)
+    , idle_lock_()
+    , idle_()
     , workers_([&] {
-        auto out = Vector{};
-        const auto target = Capacity();
+        auto out = std::vector<std::unique_ptr<Worker>>{};
+        const auto target = std::max(Capacity(), std::size_t{1});
         out.reserve(target);
 
-        for (unsigned int i{0}; i < target; ++i) {
-            auto& worker =
-                out.emplace_back(zmq_.PullSocket(cbi_, Direction::Connect));
-            const auto rc = worker->Start(internal_endpoint_);
-
-            OT_ASSERT(rc);
-
-            LogTrace("Started thread pool worker #")(i).Flush();
+        for (auto i = std::size_t{0}; i < target; ++i) {
+            out.emplace_back(std::make_unique<Worker>());
         }
 
         return out;
     }())
-    , int_([&] {
-        auto out = zmq_.PushSocket(Direction::Bind);
-        const auto rc = out->Start(internal_endpoint_);
-
-        OT_ASSERT(rc);
-
-        return out;
-    }())
-    , cbe_(zmq::ListenCallback::Factory([this](auto& in) { int_->Send(in); }))
+    , cbe_(zmq::ListenCallback::Factory([this](auto& in) { callback(in); }))
     , ext_([&] {
         auto out = zmq_.PullSocket(cbe_, Direction::Bind);
         const auto rc = out->Start(endpoint_);
@@ -101,6 +105,10 @@ ThreadPool::ThreadPool(const zmq::Context& zmq) noexcept
         return out;
     }())
 {
+    for (auto i = std::size_t{0}; i < workers_.size(); ++i) {
+        workers_.at(i)->thread_ = std::thread{&ThreadPool::run, this, i};
+        LogTrace("Started thread pool worker #")(i).Flush();
+    }
 }
 
 auto ThreadPool::callback(zmq::Message& in) noexcept -> void
@@ -122,7 +130,7 @@ auto ThreadPool::callback(zmq::Message& in) noexcept -> void
                 OT_FAIL;
             }
         }();
-        const auto& cb = [&] {
+        auto cb = [&] {
             auto lock = Lock{lock_};
 
             try {
@@ -132,8 +140,13 @@ auto ThreadPool::callback(zmq::Message& in) noexcept -> void
                 throw std::runtime_error{"No callback for specified work type"};
             }
         }();
+        auto task = [cb = std::move(cb), message = OTZMQMessage{in}] {
+            cb(message.get());
+        };
 
-        cb(in);
+        if (false == Submit(type, std::move(task))) {
+            throw std::runtime_error{"Failed to queue work"};
+        }
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -143,6 +156,94 @@ auto ThreadPool::callback(zmq::Message& in) noexcept -> void
 
 auto ThreadPool::Endpoint() const noexcept -> std::string { return endpoint_; }
 
+auto ThreadPool::execute(Worker& worker, Job& job) const noexcept -> void
+{
+    const auto start = Clock::now();
+
+    try {
+        job.task_();
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+    } catch (...) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": unknown exception").Flush();
+    }
+
+    const auto finish = Clock::now();
+    const auto wait = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        start - job.queued_);
+    const auto run =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
+    auto lock = Lock{worker.stats_lock_};
+    auto& stats = worker.stats_[job.type_];
+    ++stats.finished_;
+    stats.total_wait_ += wait;
+    stats.max_wait_ = std::max(stats.max_wait_, wait);
+    stats.total_run_ += run;
+}
+
+auto ThreadPool::pop(const std::size_t index, Job& out) const noexcept -> bool
+{
+    const auto count = workers_.size();
+    auto& own = *workers_.at(index);
+
+    for (auto level = std::size_t{0}; level < priority_levels_; ++level) {
+        {
+            auto lock = Lock{own.lock_};
+            auto& queue = own.queues_.at(level);
+
+            if (false == queue.empty()) {
+                out = std::move(queue.back());
+                queue.pop_back();
+                --pending_;
+
+                return true;
+            }
+        }
+
+        for (auto i = std::size_t{1}; i < count; ++i) {
+            auto& victim = *workers_.at((index + i) % count);
+            auto lock = Lock{victim.lock_};
+            auto& queue = victim.queues_.at(level);
+
+            if (false == queue.empty()) {
+                out = std::move(queue.front());
+                queue.pop_front();
+                --pending_;
+
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+auto ThreadPool::priority(WorkType type) noexcept -> Priority
+{
+    using Work = internal::ThreadPool::Work;
+
+    switch (static_cast<Work>(type)) {
+        case Work::BlockchainWallet: {
+
+            return Priority::High;
+        }
+        case Work::CalculateBlockFilters: {
+
+            return Priority::Low;
+        }
+        case Work::SyncDataFiltersIncoming:
+        default: {
+
+            return Priority::Normal;
+        }
+    }
+}
+
+auto ThreadPool::QueueDepth() const noexcept -> std::size_t
+{
+    return pending_.load();
+}
+
 auto ThreadPool::Register(WorkType type, Callback handler) const noexcept
     -> bool
 {
@@ -158,12 +259,111 @@ auto ThreadPool::Register(WorkType type, Callback handler) const noexcept
     return added;
 }
 
+auto ThreadPool::run(const std::size_t index) noexcept -> void
+{
+    current_pool_ = this;
+    current_worker_ = index;
+    auto& worker = *workers_.at(index);
+
+    while (true) {
+        auto job = Job{};
+
+        if (pop(index, job)) {
+            execute(worker, job);
+
+            continue;
+        }
+
+        auto lock = std::unique_lock<std::mutex>{idle_lock_};
+
+        // NOTE pending_ only counts jobs which are already in a queue, so a
+        // non-zero value means another pass through the queues will find work
+        if (0u < pending_.load()) { continue; }
+
+        // NOTE queued jobs are completed before the workers exit
+        if (false == running_.load()) { break; }
+
+        idle_.wait(lock, [&] {
+            return (0u < pending_.load()) || (false == running_.load());
+        });
+    }
+
+    current_pool_ = nullptr;
+}
+
 auto ThreadPool::Shutdown() noexcept -> void
 {
-    if (running_.exchange(false)) {
+    const auto running = [&] {
+        auto lock = Lock{idle_lock_};
+
+        return running_.exchange(false);
+    }();
+
+    if (running) {
         ext_->Close();
-        int_->Close();
-        workers_.clear();
+        idle_.notify_all();
+
+        for (auto& worker : workers_) {
+            if (worker->thread_.joinable()) { worker->thread_.join(); }
+        }
     }
 }
+
+auto ThreadPool::Statistics() const noexcept -> Stats
+{
+    auto output = Stats{};
+
+    for (const auto& worker : workers_) {
+        auto lock = Lock{worker->stats_lock_};
+
+        for (const auto& [type, stats] : worker->stats_) {
+            auto& out = output[type];
+            out.submitted_ += stats.submitted_;
+            out.finished_ += stats.finished_;
+            out.total_wait_ += stats.total_wait_;
+            out.max_wait_ = std::max(out.max_wait_, stats.max_wait_);
+            out.total_run_ += stats.total_run_;
+        }
+    }
+
+    return output;
+}
+
+auto ThreadPool::Submit(WorkType type, Task&& task) const noexcept -> bool
+{
+    if (!task) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": invalid task").Flush();
+
+        return false;
+    }
+
+    const auto index = (this == current_pool_)
+                           ? current_worker_
+                           : (next_++ % workers_.size());
+    auto& worker = *workers_.at(index);
+
+    {
+        // NOTE checking running_ while holding this lock ensures workers do
+        // not exit while a job is being queued
+        auto idle = Lock{idle_lock_};
+
+        if (false == running_.load()) { return false; }
+
+        auto lock = Lock{worker.lock_};
+        worker.queues_.at(static_cast<std::size_t>(priority(type)))
+            .emplace_back(Job{type, Clock::now(), std::move(task)});
+        ++pending_;
+    }
+
+    {
+        auto lock = Lock{worker.stats_lock_};
+        ++worker.stats_[type].submitted_;
+    }
+
+    idle_.notify_one();
+
+    return true;
+}
+
+ThreadPool::~ThreadPool() { Shutdown(); }
 }  // namespace opentxs::api::implementation
@@ -7,16 +7,23 @@
 
 #include "opentxs/api/ThreadPool.hpp"  // IWYU pragma: associated
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "internal/api/Api.hpp"
+#include "opentxs/Types.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/socket/Pull.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 
 namespace opentxs
 {
@@ -34,33 +41,73 @@ namespace zmq = opentxs::network::zeromq;
 
 namespace opentxs::api::implementation
 {
+// Each worker thread owns a set of queues, one per priority level. Tasks
+// submitted from a worker thread are queued on that worker, other tasks are
+// distributed round robin. An idle worker takes the newest task from its own
+// queue or steals the oldest task from another worker, always preferring
+// higher priority levels.
+//
+// Messages received on the zeromq endpoint are converted into tasks which
+// execute the callback registered for the message's work type.
 class ThreadPool final : public internal::ThreadPool
 {
 public:
     auto Endpoint() const noexcept -> std::string final;
+    auto QueueDepth() const noexcept -> std::size_t final;
     auto Register(WorkType type, Callback handler) const noexcept -> bool final;
+    auto Statistics() const noexcept -> Stats final;
+    auto Submit(WorkType type, Task&& task) const noexcept -> bool final;
 
     auto Shutdown() noexcept -> void final;
 
     ThreadPool(const opentxs::network::zeromq::Context& zmq) noexcept;
 
-    ~ThreadPool() final = default;
+    ~ThreadPool() final;
 
 private:
+    enum class Priority : std::size_t {
+        High = 0,
+        Normal = 1,
+        Low = 2,
+    };
+
+    static constexpr auto priority_levels_ = std::size_t{3};
+
     using Map = std::map<WorkType, Callback>;
-    using Vector = std::vector<OTZMQPullSocket>;
+
+    struct Job {
+        WorkType type_{};
+        Time queued_{};
+        Task task_{};
+    };
+
+    struct Worker {
+        mutable std::mutex lock_{};
+        std::array<std::deque<Job>, priority_levels_> queues_{};
+        mutable std::mutex stats_lock_{};
+        Stats stats_{};
+        std::thread thread_{};
+    };
 
     const opentxs::network::zeromq::Context& zmq_;
+    const std::string endpoint_;
     mutable std::mutex lock_;
     mutable Map map_;
     std::atomic<bool> running_;
-    OTZMQListenCallback cbi_;
-    Vector workers_;
-    OTZMQPushSocket int_;
+    mutable std::atomic<std::size_t> pending_;
+    mutable std::atomic<std::size_t> next_;
+    mutable std::mutex idle_lock_;
+    mutable std::condition_variable idle_;
+    std::vector<std::unique_ptr<Worker>> workers_;
     OTZMQListenCallback cbe_;
     OTZMQPullSocket ext_;
 
+    static auto priority(WorkType type) noexcept -> Priority;
+
     auto callback(zmq::Message& in) noexcept -> void;
+    auto execute(Worker& worker, Job& job) const noexcept -> void;
+    auto pop(const std::size_t index, Job& out) const noexcept -> bool;
+    auto run(const std::size_t index) noexcept -> void;
 
     ThreadPool() = delete;
     ThreadPool(const ThreadPool&) = delete;
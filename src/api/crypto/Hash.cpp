@@ -17,6 +17,7 @@
 #include "internal/crypto/library/Pbkdf2.hpp"
 #include "internal/crypto/library/Ripemd160.hpp"
 #include "internal/crypto/library/Scrypt.hpp"
+#include "internal/crypto/library/Sha256.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/crypto/Encode.hpp"
 #include "opentxs/core/Data.hpp"
@@ -177,6 +178,63 @@ auto Hash::Digest(
     }
 }
 
+auto Hash::DigestBatch(
+    const opentxs::crypto::HashType type,
+    const std::vector<ReadView>& inputs,
+    const AllocateOutput destination) const noexcept -> bool
+{
+    namespace sha256 = opentxs::crypto::sha256;
+
+    if (false == bool(destination)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid output allocator")
+            .Flush();
+
+        return false;
+    }
+
+    const auto size = Provider::HashSize(type);
+
+    if (0u == size) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Unsupported hash type.").Flush();
+
+        return false;
+    }
+
+    const auto total = size * inputs.size();
+    auto output = destination(total);
+
+    if (false == output.valid(total)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Unable to allocate output space.")
+            .Flush();
+
+        return false;
+    }
+
+    if (0u == total) { return true; }
+
+    auto* out = output.as<std::byte>();
+
+    switch (type) {
+        case opentxs::crypto::HashType::Sha256:
+        case opentxs::crypto::HashType::Sha256D: {
+            const auto twice = (opentxs::crypto::HashType::Sha256D == type);
+
+            return sha256::Batch(sha256::Best(), inputs, twice, out);
+        }
+        default: {
+            for (const auto& input : inputs) {
+                if (false == digest(type, input.data(), input.size(), out)) {
+                    return false;
+                }
+
+                out += size;
+            }
+
+            return true;
+        }
+    }
+}
+
 auto Hash::digest(
     const opentxs::crypto::HashType type,
     const void* input,
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 #include "Proto.hpp"
 #include "opentxs/Bytes.hpp"
@@ -63,6 +64,10 @@ public:
         const std::uint32_t type,
         const ReadView data,
         const AllocateOutput destination) const noexcept -> bool final;
+    auto DigestBatch(
+        const opentxs::crypto::HashType hashType,
+        const std::vector<ReadView>& inputs,
+        const AllocateOutput destination) const noexcept -> bool final;
     auto HMAC(
         const opentxs::crypto::HashType hashType,
         const ReadView key,
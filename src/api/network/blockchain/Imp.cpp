@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <chrono>
 #include <iterator>
+#include <string>
 #include <utility>
 
 #include "api/network/blockchain/SyncClient.hpp"
@@ -354,6 +355,28 @@ auto BlockchainImp::Init(
         } catch (...) {
         }
 
+        try {
+            // NOTE specified in MiB
+            const auto& arg = args.at(OPENTXS_ARG_BLOCK_CACHE_SIZE);
+
+            if (0 < arg.size()) {
+                output.block_cache_bytes_ =
+                    std::stoul(*arg.cbegin()) * 1024u * 1024u;
+            }
+        } catch (...) {
+        }
+
+        try {
+            // NOTE specified in MiB
+            const auto& arg = args.at(OPENTXS_ARG_MEMPOOL_SIZE);
+
+            if (0 < arg.size()) {
+                output.mempool_bytes_ =
+                    std::stoul(*arg.cbegin()) * 1024u * 1024u;
+            }
+        } catch (...) {
+        }
+
         return out;
     }();
     sync_client_ = [&]() -> std::unique_ptr<blockchain::SyncClient> {
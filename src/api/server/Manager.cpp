@@ -7,8 +7,10 @@
 #include "1_Internal.hpp"          // IWYU pragma: associated
 #include "api/server/Manager.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <exception>
 #include <list>
@@ -148,8 +150,11 @@ Manager::Manager(
     , reason_(factory_.PasswordPrompt("Notary operation"))
     , server_p_(new opentxs::server::Server(*this, reason_))
     , server_(*server_p_)
-    , message_processor_p_(
-          new opentxs::server::MessageProcessor(server_, reason_, running_))
+    , message_processor_p_(new opentxs::server::MessageProcessor(
+          server_,
+          reason_,
+          running_,
+          notary_workers()))
     , message_processor_(*message_processor_p_)
 #if OT_CASH
     , mint_thread_()
@@ -549,6 +554,24 @@ void Manager::mint() const
 }
 #endif  // OT_CASH
 
+auto Manager::notary_workers() const noexcept -> std::size_t
+{
+    const auto fallback = std::max(
+        std::size_t{std::thread::hardware_concurrency()}, std::size_t{1});
+
+    try {
+        const auto arg = get_arg(OPENTXS_ARG_NOTARY_WORKERS);
+
+        if (arg.empty()) { return fallback; }
+
+        return std::max(std::size_t{std::stoul(arg)}, std::size_t{1});
+    } catch (...) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid worker count").Flush();
+
+        return fallback;
+    }
+}
+
 auto Manager::NymID() const -> const identifier::Nym&
 {
     return server_.GetServerNym().ID();
@@ -152,6 +152,7 @@ private:
         const std::string seriesID) const -> std::shared_ptr<blind::Mint>;
     void mint() const;
 #endif  // OT_CASH
+    auto notary_workers() const noexcept -> std::size_t;
     auto verify_lock(const opentxs::Lock& lock, const std::mutex& mutex) const
         -> bool;
 #if OT_CASH
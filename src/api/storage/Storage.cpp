@@ -8,6 +8,7 @@
 #include "api/storage/Storage.hpp"  // IWYU pragma: associated
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <functional>
@@ -79,6 +80,7 @@
 #include "storage/tree/Threads.hpp"
 #include "storage/tree/Tree.hpp"
 #include "storage/tree/Units.hpp"
+#include "util/ByteLiterals.hpp"
 
 #define STORAGE_CONFIG_KEY "storage"
 
@@ -196,6 +198,21 @@ auto Factory::Storage(
         defaultGcInterval,
         configGcInterval,
         notUsed);
+    {
+        auto queue = std::int64_t{};
+        config.CheckSet_long(
+            String::Factory(STORAGE_CONFIG_KEY),
+            String::Factory("replication_queue_mib"),
+            static_cast<std::int64_t>(
+                storageConfig.replication_queue_bytes_ / 1_MiB),
+            queue,
+            notUsed);
+
+        if (0 < queue) {
+            storageConfig.replication_queue_bytes_ =
+                static_cast<std::size_t>(queue) * 1_MiB;
+        }
+    }
     config.CheckSet_str(
         String::Factory(STORAGE_CONFIG_KEY),
         String::Factory("path"),
@@ -9,13 +9,13 @@
 
 #include <boost/cstdint.hpp>
 #include <boost/endian/buffers.hpp>
-#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/endian/conversion.hpp>
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <limits>
-#include <map>
 #include <memory>
 #include <optional>
 #include <stdexcept>
@@ -31,15 +31,12 @@
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
-#include "opentxs/api/crypto/Crypto.hpp"
-#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/FilterType.hpp"
 #include "opentxs/blockchain/block/Block.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
-#include "opentxs/crypto/HashType.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/protobuf/Check.hpp"
 #include "opentxs/protobuf/GCS.pb.h"
@@ -49,7 +46,6 @@
 //#define OT_METHOD "opentxs::blockchain::implementation::GCS::"
 
 namespace be = boost::endian;
-namespace bmp = boost::multiprecision;
 
 namespace opentxs
 {
@@ -206,16 +202,222 @@ namespace opentxs::gcs
 using BitReader = blockchain::internal::BitReader;
 using BitWriter = blockchain::internal::BitWriter;
 
+// Decodes Golomb-Rice coded values from an MSB-first bit stream while keeping
+// up to 63 bits buffered in a single word. Unary quotients are measured with a
+// count leading zeros instruction and remainders are extracted with one shift.
+// Bits past the end of the input read as zero, which matches BitReader.
+class GolombReader
+{
+public:
+    auto decode(const std::uint8_t P) noexcept -> std::uint64_t
+    {
+        const auto quotient = unary();
+
+        return (quotient << P) + bits(P);
+    }
+
+    GolombReader(const ReadView in) noexcept
+        : it_(reinterpret_cast<const std::uint8_t*>(in.data()))
+        , end_(it_ + in.size())
+        , word_(0)
+        , count_(0)
+    {
+    }
+
+private:
+    const std::uint8_t* it_;
+    const std::uint8_t* const end_;
+    // Buffered bits are left-aligned. Bits below count_ may contain the
+    // leading bits of *it_, which is harmless since they are or'd in again
+    // with identical values during the next refill.
+    std::uint64_t word_;
+    std::size_t count_;
+
+    static auto count_leading_ones(const std::uint64_t value) noexcept
+        -> std::size_t
+    {
+        const auto inverted = std::uint64_t{~value};
+
+        if (0u == inverted) { return 64u; }
+
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_clzll(inverted));
+#else
+        auto output = std::size_t{0};
+
+        for (auto mask = std::uint64_t{1u} << 63u; 0u != (value & mask);
+             mask >>= 1u) {
+            ++output;
+        }
+
+        return output;
+#endif
+    }
+
+    auto bits(const std::uint8_t n) noexcept -> std::uint64_t
+    {
+        OT_ASSERT(n < 57u);
+
+        if (0u == n) { return 0u; }
+
+        if (count_ < n) { refill(); }
+
+        const auto output = std::uint64_t{word_ >> (64u - n)};
+        consume(n);
+
+        return output;
+    }
+    auto consume(const std::size_t n) noexcept -> void
+    {
+        word_ <<= n;
+        count_ = (n < count_) ? (count_ - n) : 0u;
+    }
+    auto refill() noexcept -> void
+    {
+        constexpr auto word = sizeof(std::uint64_t);
+
+        if (word <= static_cast<std::size_t>(end_ - it_)) {
+            auto next = std::uint64_t{};
+            std::memcpy(&next, it_, word);
+            word_ |= (be::big_to_native(next) >> count_);
+            it_ += (63u - count_) >> 3u;
+            count_ |= 56u;
+        } else {
+            // NOTE stop while a whole byte still fits below the 63 bit limit
+            // so that consume() never shifts by the full width of word_
+            while ((55u >= count_) && (end_ != it_)) {
+                word_ |= (std::uint64_t{*it_++} << (56u - count_));
+                count_ += 8u;
+            }
+        }
+    }
+    auto unary() noexcept -> std::uint64_t
+    {
+        auto output = std::uint64_t{0};
+
+        while (true) {
+            if (0u == count_) {
+                refill();
+
+                if (0u == count_) { return output; }
+            }
+
+            const auto ones = std::min(count_leading_ones(word_), count_);
+            output += ones;
+
+            if (ones < count_) {
+                consume(ones + 1u);
+
+                return output;
+            }
+
+            consume(ones);
+        }
+    }
+
+    GolombReader() = delete;
+    GolombReader(const GolombReader&) = delete;
+    GolombReader(GolombReader&&) = delete;
+    auto operator=(const GolombReader&) -> GolombReader& = delete;
+    auto operator=(GolombReader&&) -> GolombReader& = delete;
+};
+
+// Encodes Golomb-Rice coded values by packing the unary quotient and the
+// remainder into a single word and appending completed bytes in bulk.
+class GolombWriter
+{
+public:
+    auto encode(const std::uint8_t P, const std::uint64_t value) noexcept
+        -> void
+    {
+        OT_ASSERT(P < 57u);
+
+        auto quotient = std::uint64_t{value >> P};
+        const auto remainder = std::uint64_t{value & mask(P)};
+
+        while (max_write_ <= quotient) {
+            write(max_write_, mask(max_write_));
+            quotient -= max_write_;
+        }
+
+        // quotient one bits followed by a zero bit
+        const auto unary = std::uint64_t{mask(quotient) << 1u};
+        const auto unaryBits = static_cast<std::size_t>(quotient + 1u);
+
+        if (max_write_ >= (unaryBits + P)) {
+            write(unaryBits + P, (unary << P) | remainder);
+        } else {
+            write(unaryBits, unary);
+            write(P, remainder);
+        }
+    }
+    auto flush() noexcept -> void
+    {
+        if (0u < count_) {
+            output_.emplace_back(std::byte{
+                static_cast<std::uint8_t>(accum_ << (8u - count_))});
+            accum_ = 0u;
+            count_ = 0u;
+        }
+    }
+
+    GolombWriter(Space& output) noexcept
+        : output_(output)
+        , accum_(0)
+        , count_(0)
+    {
+    }
+
+private:
+    static constexpr auto max_write_ = std::size_t{56};
+
+    Space& output_;
+    // Pending bits are right-aligned. Fewer than 8 bits are pending between
+    // calls to write().
+    std::uint64_t accum_;
+    std::size_t count_;
+
+    static constexpr auto mask(const std::uint64_t n) noexcept -> std::uint64_t
+    {
+        return (64u <= n) ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1u;
+    }
+
+    auto write(const std::size_t n, const std::uint64_t value) noexcept -> void
+    {
+        accum_ = (accum_ << n) | value;
+        count_ += n;
+        const auto bytes = count_ >> 3u;
+
+        if (0u == bytes) { return; }
+
+        const auto word =
+            std::uint64_t{be::native_to_big(accum_ << (64u - count_))};
+        const auto* start = reinterpret_cast<const std::byte*>(&word);
+        output_.insert(output_.end(), start, start + bytes);
+        count_ &= 7u;
+    }
+
+    GolombWriter() = delete;
+    GolombWriter(const GolombWriter&) = delete;
+    GolombWriter(GolombWriter&&) = delete;
+    auto operator=(const GolombWriter&) -> GolombWriter& = delete;
+    auto operator=(GolombWriter&&) -> GolombWriter& = delete;
+};
+
 auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(false)
     -> std::uint64_t;
 auto golomb_encode(
     const std::uint8_t P,
     const std::uint64_t value,
     BitWriter& stream) noexcept -> void;
-auto siphash(
-    const api::Core& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> std::uint64_t;
+constexpr auto rotl(const std::uint64_t x, const unsigned int b) noexcept
+    -> std::uint64_t
+{
+    return (x << b) | (x >> (64u - b));
+}
+auto load_le64(const std::uint8_t* in) noexcept -> std::uint64_t;
+auto multiply_high(const std::uint64_t lhs, const std::uint64_t rhs) noexcept
+    -> std::uint64_t;
 
 auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(false)
     -> std::uint64_t
@@ -250,6 +452,32 @@ auto GolombDecode(
     const std::uint32_t N,
     const std::uint8_t P,
     const Space& encoded) noexcept(false) -> std::vector<std::uint64_t>
+{
+    return GolombDecode(N, P, reader(encoded));
+}
+
+auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded) noexcept(false) -> std::vector<std::uint64_t>
+{
+    auto output = std::vector<std::uint64_t>{};
+    output.reserve(N);
+    auto stream = GolombReader{encoded};
+    auto last = std::uint64_t{0};
+
+    for (auto i = std::size_t{0}; i < N; ++i) {
+        last += stream.decode(P);
+        output.emplace_back(last);
+    }
+
+    return output;
+}
+
+auto GolombDecodeReference(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Space& encoded) noexcept(false) -> std::vector<std::uint64_t>
 {
     auto output = std::vector<std::uint64_t>{};
     auto stream = BitReader(encoded);
@@ -270,14 +498,14 @@ auto GolombEncode(
     const std::vector<std::uint64_t>& hashedSet) noexcept(false) -> Space
 {
     auto output = Space{};
-    output.reserve(hashedSet.size() * P * 2u);
-    auto stream = BitWriter{output};
+    output.reserve(hashedSet.size() * (P + 2u) / 8u + 1u);
+    auto stream = GolombWriter{output};
     auto last = std::uint64_t{0};
 
     for (const auto& item : hashedSet) {
-        auto delta = std::uint64_t{item - last};
+        const auto delta = std::uint64_t{item - last};
 
-        if (delta != 0) { golomb_encode(P, delta, stream); }
+        if (delta != 0) { stream.encode(P, delta); }
 
         last = item;
     }
@@ -287,55 +515,158 @@ auto GolombEncode(
     return output;
 }
 
-auto siphash(
-    const api::Core& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> std::uint64_t
+auto GolombEncodeReference(
+    const std::uint8_t P,
+    const std::vector<std::uint64_t>& hashedSet) noexcept(false) -> Space
 {
-    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
+    auto output = Space{};
+    output.reserve(hashedSet.size() * P * 2u);
+    auto stream = BitWriter{output};
+    auto last = std::uint64_t{0};
 
-    auto output = std::uint64_t{};
-    auto writer = preallocated(sizeof(output), &output);
+    for (const auto& item : hashedSet) {
+        auto delta = std::uint64_t{item - last};
 
-    if (false == api.Crypto().Hash().HMAC(
-                     crypto::HashType::SipHash24, key, item, writer)) {
-        throw std::runtime_error("siphash failed");
+        if (delta != 0) { golomb_encode(P, delta, stream); }
+
+        last = item;
     }
 
+    stream.flush();
+
     return output;
 }
 
 auto HashToRange(
-    const api::Core& api,
-    const ReadView key,
+    const SipHash& hasher,
+    const std::uint64_t range,
+    const ReadView item) noexcept -> std::uint64_t
+{
+    return multiply_high(hasher(item), range);
+}
+
+auto HashToRange(
+    const SipHash& hasher,
     const std::uint64_t range,
-    const ReadView item) noexcept(false) -> std::uint64_t
+    const std::vector<ReadView>& items) noexcept -> std::vector<std::uint64_t>
 {
-    return ((bmp::uint128_t{siphash(api, key, item)} * bmp::uint128_t{range}) >>
-            64u)
-        .convert_to<std::uint64_t>();
+    auto output = std::vector<std::uint64_t>{};
+    output.reserve(items.size());
+
+    for (const auto& item : items) {
+        output.emplace_back(multiply_high(hasher(item), range));
+    }
+
+    return output;
 }
 
 auto HashedSetConstruct(
-    const api::Core& api,
-    const ReadView key,
+    const SipHash& hasher,
     const std::uint32_t N,
     const std::uint32_t M,
-    const std::vector<ReadView> items) noexcept(false)
-    -> std::vector<std::uint64_t>
+    const std::vector<ReadView>& items) noexcept -> std::vector<std::uint64_t>
 {
-    auto output = std::vector<std::uint64_t>{};
-    std::transform(
-        std::begin(items),
-        std::end(items),
-        std::back_inserter(output),
-        [&](const auto& item) {
-            return HashToRange(api, key, range(N, M), item);
-        });
+    auto output = HashToRange(hasher, range(N, M), items);
     std::sort(output.begin(), output.end());
 
     return output;
 }
+
+auto load_le64(const std::uint8_t* in) noexcept -> std::uint64_t
+{
+    auto output = std::uint64_t{};
+    std::memcpy(&output, in, sizeof(output));
+
+    return be::little_to_native(output);
+}
+
+auto multiply_high(const std::uint64_t lhs, const std::uint64_t rhs) noexcept
+    -> std::uint64_t
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+
+    return static_cast<std::uint64_t>((uint128{lhs} * uint128{rhs}) >> 64u);
+#else
+    const auto lhsLow = lhs & 0xffffffffu;
+    const auto lhsHigh = lhs >> 32u;
+    const auto rhsLow = rhs & 0xffffffffu;
+    const auto rhsHigh = rhs >> 32u;
+    const auto low = lhsLow * rhsLow;
+    const auto midA = lhsLow * rhsHigh;
+    const auto midB = lhsHigh * rhsLow;
+    const auto carry =
+        ((low >> 32u) + (midA & 0xffffffffu) + (midB & 0xffffffffu)) >> 32u;
+
+    return (lhsHigh * rhsHigh) + (midA >> 32u) + (midB >> 32u) + carry;
+#endif
+}
+
+SipHash::SipHash(const ReadView key) noexcept(false)
+    : v_()
+{
+    if (16u != key.size()) {
+        throw std::runtime_error(
+            "Invalid key size: " + std::to_string(key.size()));
+    }
+
+    const auto* k = reinterpret_cast<const std::uint8_t*>(key.data());
+    const auto k0 = load_le64(k);
+    const auto k1 = load_le64(k + 8u);
+    v_[0] = k0 ^ 0x736f6d6570736575u;
+    v_[1] = k1 ^ 0x646f72616e646f6du;
+    v_[2] = k0 ^ 0x6c7967656e657261u;
+    v_[3] = k1 ^ 0x7465646279746573u;
+}
+
+auto SipHash::operator()(const ReadView item) const noexcept -> std::uint64_t
+{
+    auto [v0, v1, v2, v3] = v_;
+    const auto round = [&] {
+        v0 += v1;
+        v1 = rotl(v1, 13u);
+        v1 ^= v0;
+        v0 = rotl(v0, 32u);
+        v2 += v3;
+        v3 = rotl(v3, 16u);
+        v3 ^= v2;
+        v0 += v3;
+        v3 = rotl(v3, 21u);
+        v3 ^= v0;
+        v2 += v1;
+        v1 = rotl(v1, 17u);
+        v1 ^= v2;
+        v2 = rotl(v2, 32u);
+    };
+    const auto compress = [&](const std::uint64_t m) {
+        v3 ^= m;
+        round();
+        round();
+        v0 ^= m;
+    };
+    const auto size = item.size();
+    const auto tail = size % 8u;
+    const auto* i = reinterpret_cast<const std::uint8_t*>(item.data());
+    const auto* const end = i + (size - tail);
+
+    for (; i != end; i += 8u) { compress(load_le64(i)); }
+
+    auto last = std::uint64_t{0};
+
+    if (0u < tail) {
+        std::memcpy(&last, i, tail);
+        last = be::little_to_native(last);
+    }
+
+    compress(last | (static_cast<std::uint64_t>(size) << 56u));
+    v2 ^= 0xffu;
+    round();
+    round();
+    round();
+    round();
+
+    return v0 ^ v1 ^ v2 ^ v3;
+}
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::implementation
@@ -352,6 +683,7 @@ GCS::GCS(
     , bits_(bits)
     , false_positive_rate_(fpRate)
     , count_(filterElementCount)
+    , hasher_(key)
     , elements_()
     , compressed_(api_.Factory().Data(encoded))
     , key_(api_.Factory().Data(key))
@@ -373,9 +705,9 @@ GCS::GCS(
     , bits_(bits)
     , false_positive_rate_(fpRate)
     , count_(static_cast<std::uint32_t>(elements.size()))
+    , hasher_(key)
     , elements_(gcs::HashedSetConstruct(
-          api_,
-          key,
+          hasher_,
           static_cast<std::uint32_t>(elements.size()),
           false_positive_rate_,
           elements))
@@ -406,23 +738,6 @@ auto GCS::Compressed() const noexcept -> Space
             compressed_->size()};
 }
 
-auto GCS::decompress() const noexcept -> const Elements&
-{
-    if (false == elements_.has_value()) {
-        auto& set = const_cast<std::optional<Elements>&>(elements_);
-        set = gcs::GolombDecode(
-            count_,
-            bits_,
-            Space{
-                reinterpret_cast<const std::byte*>(compressed_->data()),
-                reinterpret_cast<const std::byte*>(compressed_->data()) +
-                    compressed_->size()});
-        std::sort(set.value().begin(), set.value().end());
-    }
-
-    return elements_.value();
-}
-
 auto GCS::Encode() const noexcept -> OTData
 {
     using CompactSize = network::blockchain::bitcoin::CompactSize;
@@ -454,13 +769,7 @@ auto GCS::hashed_set_construct(const std::vector<ReadView>& elements)
     const noexcept -> std::vector<std::uint64_t>
 {
     return gcs::HashedSetConstruct(
-        api_, key_->Bytes(), count_, false_positive_rate_, elements);
-}
-
-auto GCS::hash_to_range(const ReadView in) const noexcept -> std::uint64_t
-{
-    return gcs::HashToRange(
-        api_, key_->Bytes(), range(count_, false_positive_rate_), in);
+        hasher_, count_, false_positive_rate_, elements);
 }
 
 auto GCS::Header(const ReadView previous) const noexcept -> OTData
@@ -470,33 +779,60 @@ auto GCS::Header(const ReadView previous) const noexcept -> OTData
 
 auto GCS::Match(const Targets& targets) const noexcept -> Matches
 {
+    using Hashed = std::pair<std::uint64_t, Targets::const_iterator>;
+
     auto output = Matches{};
-    auto hashed = std::vector<std::uint64_t>{};
-    auto matches = std::vector<std::uint64_t>{};
-    auto map = std::map<std::uint64_t, Targets::const_iterator>{};
-    const auto& set = decompress();
+    auto hashed = std::vector<Hashed>{};
+    hashed.reserve(targets.size());
+    const auto hashes = gcs::HashToRange(
+        hasher_, range(count_, false_positive_rate_), targets);
 
-    for (auto i = targets.cbegin(); i != targets.cend(); ++i) {
-        const auto& hash = hashed.emplace_back(hash_to_range(*i));
-        map.emplace(hash, i);
+    for (auto i = std::size_t{0}; i < hashes.size(); ++i) {
+        hashed.emplace_back(hashes.at(i), std::next(targets.cbegin(), i));
     }
 
-    std::sort(std::begin(hashed), std::end(hashed));
-    std::set_intersection(
+    std::sort(
         std::begin(hashed),
         std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
-    std::transform(
-        std::begin(matches),
-        std::end(matches),
-        std::back_inserter(output),
-        [&](const auto& in) { return map.at(in); });
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    auto target = hashed.cbegin();
+    scan([&](const auto element) {
+        while ((hashed.cend() != target) && (target->first < element)) {
+            ++target;
+        }
+
+        while ((hashed.cend() != target) && (target->first == element)) {
+            output.emplace_back(target->second);
+            ++target;
+        }
+
+        return hashed.cend() != target;
+    });
 
     return output;
 }
 
+template <typename Visitor>
+auto GCS::scan(Visitor visitor) const noexcept -> void
+{
+    if (elements_.has_value()) {
+        for (const auto& element : elements_.value()) {
+            if (false == visitor(element)) { return; }
+        }
+
+        return;
+    }
+
+    auto stream = gcs::GolombReader{compressed_->Bytes()};
+    auto element = std::uint64_t{0};
+
+    for (auto i = std::uint32_t{0}; i < count_; ++i) {
+        element += stream.decode(bits_);
+
+        if (false == visitor(element)) { return; }
+    }
+}
+
 auto GCS::Serialize(proto::GCS& output) const noexcept -> bool
 {
     output.set_version(version_);
@@ -526,23 +862,7 @@ auto GCS::Test(const Data& target) const noexcept -> bool
 
 auto GCS::Test(const ReadView target) const noexcept -> bool
 {
-    const auto set = hashed_set_construct({target});
-
-    OT_ASSERT(1 == set.size());
-
-    const auto& hash = set.front();
-
-    for (const auto& element : decompress()) {
-        if (element == hash) {
-
-            return true;
-        } else if (element > hash) {
-
-            return false;
-        }
-    }
-
-    return false;
+    return test(hashed_set_construct({target}));
 }
 
 auto GCS::Test(const std::vector<OTData>& targets) const noexcept -> bool
@@ -557,16 +877,21 @@ auto GCS::Test(const std::vector<Space>& targets) const noexcept -> bool
 
 auto GCS::test(const std::vector<std::uint64_t>& targets) const noexcept -> bool
 {
-    const auto& set = decompress();
-    auto matches = std::vector<std::uint64_t>{};
-    std::set_intersection(
-        std::begin(targets),
-        std::end(targets),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    auto output{false};
+    auto target = targets.cbegin();
+    scan([&](const auto element) {
+        while ((targets.cend() != target) && (*target < element)) { ++target; }
+
+        if ((targets.cend() != target) && (*target == element)) {
+            output = true;
 
-    return 0 < matches.size();
+            return false;
+        }
+
+        return targets.cend() != target;
+    });
+
+    return output;
 }
 
 auto GCS::transform(const std::vector<OTData>& in) noexcept
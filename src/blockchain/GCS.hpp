@@ -72,6 +72,7 @@ private:
     const std::uint8_t bits_;
     const std::uint32_t false_positive_rate_;
     const std::uint32_t count_;
+    const gcs::SipHash hasher_;
     const std::optional<Elements> elements_;
     const OTData compressed_;
     const OTData key_;
@@ -81,7 +82,6 @@ private:
     static auto transform(const std::vector<Space>& in) noexcept
         -> std::vector<ReadView>;
 
-    auto decompress() const noexcept -> const Elements&;
     auto hashed_set_construct(const std::vector<OTData>& elements)
         const noexcept -> std::vector<std::uint64_t>;
     auto hashed_set_construct(const std::vector<Space>& elements) const noexcept
@@ -90,7 +90,11 @@ private:
         const noexcept -> std::vector<std::uint64_t>;
     auto test(const std::vector<std::uint64_t>& targetHashes) const noexcept
         -> bool;
-    auto hash_to_range(const ReadView in) const noexcept -> std::uint64_t;
+    // Visits filter elements in ascending order until the visitor returns
+    // false, decoding them from the compressed filter on the fly unless the
+    // filter was constructed from its elements.
+    template <typename Visitor>
+    auto scan(Visitor visitor) const noexcept -> void;
 
     GCS() = delete;
     GCS(const GCS&) = delete;
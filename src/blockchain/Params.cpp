@@ -15,6 +15,7 @@
 #include <memory>
 #include <set>
 #include <type_traits>
+#include <vector>
 
 #include "display/Scale.hpp"
 #include "opentxs/Bytes.hpp"
@@ -186,6 +187,30 @@ auto MerkleHash(
     }
 }
 
+auto MerkleHashes(
+    const api::Core& api,
+    const Type chain,
+    const std::vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool
+{
+    switch (chain) {
+        case Type::Unknown:
+        case Type::Bitcoin:
+        case Type::Bitcoin_testnet3:
+        case Type::BitcoinCash:
+        case Type::BitcoinCash_testnet3:
+        case Type::Ethereum_frontier:
+        case Type::Ethereum_ropsten:
+        case Type::Litecoin:
+        case Type::Litecoin_testnet4:
+        case Type::UnitTest:
+        default: {
+            return api.Crypto().Hash().DigestBatch(
+                opentxs::crypto::HashType::Sha256D, inputs, output);
+        }
+    }
+}
+
 auto P2PMessageHash(
     const api::Core& api,
     const Type chain,
@@ -367,6 +392,32 @@ auto TransactionHash(
         }
     }
 }
+
+auto TransactionHashes(
+    const api::Core& api,
+    const Type chain,
+    const std::vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool
+{
+    switch (chain) {
+        case Type::Unknown:
+        case Type::Bitcoin:
+        case Type::Bitcoin_testnet3:
+        case Type::BitcoinCash:
+        case Type::BitcoinCash_testnet3:
+        case Type::Ethereum_frontier:
+        case Type::Ethereum_ropsten:
+        case Type::Litecoin:
+        case Type::Litecoin_testnet4:
+        case Type::PKT:
+        case Type::PKT_testnet:
+        case Type::UnitTest:
+        default: {
+            return api.Crypto().Hash().DigestBatch(
+                opentxs::crypto::HashType::Sha256D, inputs, output);
+        }
+    }
+}
 }  // namespace opentxs::blockchain
 
 namespace opentxs::blockchain::block
@@ -475,6 +475,94 @@ auto EncodedTransaction::Deserialize(
     return output;
 }
 
+auto EncodedTransaction::Scan(
+    const ReadView in,
+    Space& preimage) noexcept(false) -> std::size_t
+{
+    if ((nullptr == in.data()) || (0 == in.size())) {
+        throw std::runtime_error("Invalid bytes");
+    }
+
+    const auto size = in.size();
+    const auto start = reinterpret_cast<ByteIterator>(in.data());
+    auto it{start};
+    auto expectedSize = std::size_t{0};
+    const auto skip = [&](const std::size_t bytes, const char* error) {
+        expectedSize += bytes;
+
+        if (size < expectedSize) { throw std::runtime_error(error); }
+
+        std::advance(it, bytes);
+    };
+    const auto count = [&](const char* error) {
+        auto output = std::size_t{0};
+        expectedSize += 1;
+
+        if ((size < expectedSize) ||
+            (false == network::blockchain::bitcoin::DecodeSize(
+                          it, expectedSize, size, output))) {
+            throw std::runtime_error(error);
+        }
+
+        return output;
+    };
+    constexpr auto versionBytes = sizeof(be::little_int32_buf_t);
+    constexpr auto lockTimeBytes = sizeof(be::little_uint32_buf_t);
+    skip(versionBytes, "Partial transaction (version)");
+    const auto segwit = HasSegwit(it, expectedSize, size).has_value();
+    const auto bodyStart{it};
+    const auto inputs = count("Failed to decode txin count");
+
+    for (auto i = std::size_t{0}; i < inputs; ++i) {
+        skip(sizeof(EncodedInput::outpoint_), "Partial input (outpoint)");
+        skip(count("Failed to decode input script bytes"),
+             "Partial input (script)");
+        skip(sizeof(EncodedInput::sequence_), "Partial input (sequence)");
+    }
+
+    const auto outputs = count("Failed to decode txout count");
+
+    for (auto i = std::size_t{0}; i < outputs; ++i) {
+        skip(sizeof(EncodedOutput::value_), "Partial output (value)");
+        skip(count("Failed to decode output script bytes"),
+             "Partial output (script)");
+    }
+
+    const auto bodyEnd{it};
+
+    if (segwit) {
+        for (auto i = std::size_t{0}; i < inputs; ++i) {
+            const auto items = count("Failed to decode witness item count");
+
+            for (auto w = std::size_t{0}; w < items; ++w) {
+                skip(count("Failed to decode witness item bytes"),
+                     "Partial witness item");
+            }
+        }
+    }
+
+    const auto lockTime{it};
+    skip(lockTimeBytes, "Partial transaction (lock time)");
+    const auto txBytes = static_cast<std::size_t>(std::distance(start, it));
+    preimage.clear();
+
+    if (segwit) {
+        // NOTE the txid of a segwit transaction excludes the marker, flag, and
+        // witness data so it must be hashed from a separate preimage
+        const auto body =
+            static_cast<std::size_t>(std::distance(bodyStart, bodyEnd));
+        preimage.resize(versionBytes + body + lockTimeBytes);
+        auto out = preimage.data();
+        std::memcpy(out, start, versionBytes);
+        std::advance(out, versionBytes);
+        std::memcpy(out, bodyStart, body);
+        std::advance(out, body);
+        std::memcpy(out, lockTime, lockTimeBytes);
+    }
+
+    return txBytes;
+}
+
 auto EncodedTransaction::wtxid_preimage() const noexcept -> Space
 {
     auto output = space(size());
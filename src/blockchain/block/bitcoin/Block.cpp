@@ -8,6 +8,7 @@
 #include "blockchain/block/bitcoin/Block.hpp"  // IWYU pragma: associated
 
 #include <boost/endian/buffers.hpp>
+#include <robin_hood.h>
 #include <algorithm>
 #include <array>
 #include <cstddef>
@@ -18,6 +19,7 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <sstream>
@@ -29,6 +31,7 @@
 
 #include "blockchain/block/Block.hpp"
 #include "blockchain/block/bitcoin/BlockParser.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "opentxs/api/Core.hpp"
@@ -214,15 +217,17 @@ auto parse_normal_block(
     const auto& header = *pHeader;
     auto sizeData = ReturnType::CalculatedSize{
         in.size(), network::blockchain::bitcoin::CompactSize{}};
-    auto [index, transactions] = parse_transactions(
-        api, blockchain, chain, in, header, sizeData, it, expectedSize);
+    auto [index, locations] = parse_transactions(
+        api, chain, in, header, sizeData, it, expectedSize);
 
     return std::make_shared<ReturnType>(
         api,
+        blockchain,
         chain,
         std::move(pHeader),
+        in,
         std::move(index),
-        std::move(transactions),
+        std::move(locations),
         std::move(sizeData));
 }
 }  // namespace opentxs::factory
@@ -336,24 +341,91 @@ Block::Block(
     TxidIndex&& index,
     TransactionMap&& transactions,
     std::optional<CalculatedSize>&& size) noexcept(false)
+    : Block(
+          api,
+          nullptr,
+          chain,
+          std::move(header),
+          Space{},
+          std::move(index),
+          TransactionLocations{},
+          std::move(transactions),
+          std::move(size))
+{
+}
+
+Block::Block(
+    const api::Core& api,
+    const api::client::Blockchain& blockchain,
+    const blockchain::Type chain,
+    std::unique_ptr<const internal::Header> header,
+    const ReadView raw,
+    TxidIndex&& index,
+    TransactionLocations&& locations,
+    std::optional<CalculatedSize>&& size) noexcept(false)
+    : Block(
+          api,
+          &blockchain,
+          chain,
+          std::move(header),
+          space(raw),
+          std::move(index),
+          std::move(locations),
+          TransactionMap{},
+          std::move(size))
+{
+}
+
+Block::Block(
+    const api::Core& api,
+    const api::client::Blockchain* blockchain,
+    const blockchain::Type chain,
+    std::unique_ptr<const internal::Header> header,
+    Space&& raw,
+    TxidIndex&& index,
+    TransactionLocations&& locations,
+    TransactionMap&& transactions,
+    std::optional<CalculatedSize>&& size) noexcept(false)
     : block::implementation::Block(api, *header)
+    , blockchain_(blockchain)
+    , chain_(chain)
     , header_p_(std::move(header))
     , header_(*header_p_)
+    , raw_(std::move(raw))
     , index_(std::move(index))
+    , locations_(std::move(locations))
+    , lock_()
     , transactions_(std::move(transactions))
+    , sorted_()
     , size_(std::move(size))
 {
-    if (index_.size() != transactions_.size()) {
-        throw std::runtime_error("Invalid transaction index");
-    }
-
     if (false == bool(header_p_)) {
         throw std::runtime_error("Invalid header");
     }
 
-    for (const auto& [txid, tx] : transactions_) {
-        if (false == bool(tx)) {
-            throw std::runtime_error("Invalid transaction");
+    if (is_lazy()) {
+        if (nullptr == blockchain_) {
+            throw std::runtime_error("Invalid blockchain api");
+        }
+
+        if (index_.size() != locations_.size()) {
+            throw std::runtime_error("Invalid transaction index");
+        }
+
+        for (const auto& [offset, bytes] : locations_) {
+            if ((offset > raw_.size()) || (bytes > (raw_.size() - offset))) {
+                throw std::runtime_error("Invalid transaction location");
+            }
+        }
+    } else {
+        if (index_.size() != transactions_.size()) {
+            throw std::runtime_error("Invalid transaction index");
+        }
+
+        for (const auto& [txid, tx] : transactions_) {
+            if (false == bool(tx)) {
+                throw std::runtime_error("Invalid transaction");
+            }
         }
     }
 }
@@ -365,7 +437,7 @@ auto Block::at(const std::size_t index) const noexcept -> const value_type&
             throw std::out_of_range("invalid index " + std::to_string(index));
         }
 
-        return at(reader(index_.at(index)));
+        return get(index);
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -377,7 +449,7 @@ auto Block::at(const ReadView txid) const noexcept -> const value_type&
 {
     try {
 
-        return transactions_.at(txid);
+        return get(find(txid));
     } catch (...) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": transaction ")(
             api_.Factory().Data(txid)->asHex())(" not found in block ")(
@@ -388,36 +460,7 @@ auto Block::at(const ReadView txid) const noexcept -> const value_type&
     }
 }
 
-template <typename HashType>
-auto Block::calculate_merkle_hash(
-    const api::Core& api,
-    const Type chain,
-    const HashType& lhs,
-    const HashType& rhs,
-    AllocateOutput out) -> bool
-{
-    auto preimage = std::array<std::byte, 64>{};
-    constexpr auto chunk = preimage.size() / 2u;
-
-    if (chunk != lhs.size()) {
-        throw std::runtime_error("Invalid lhs hash size");
-    }
-    if (chunk != rhs.size()) {
-        throw std::runtime_error("Invalid rhs hash size");
-    }
-
-    auto it = preimage.data();
-    std::memcpy(it, lhs.data(), chunk);
-    std::advance(it, chunk);
-    std::memcpy(it, rhs.data(), chunk);
-
-    return MerkleHash(
-        api,
-        chain,
-        {reinterpret_cast<const char*>(preimage.data()), preimage.size()},
-        out);
-}
-
+// NOTE every pair in the row is hashed in a single batch
 template <typename InputContainer, typename OutputContainer>
 auto Block::calculate_merkle_row(
     const api::Core& api,
@@ -425,23 +468,43 @@ auto Block::calculate_merkle_row(
     const InputContainer& in,
     OutputContainer& out) -> bool
 {
-    out.clear();
+    using Preimage = std::array<std::byte, 64>;
+    constexpr auto chunk = std::tuple_size<Preimage>::value / 2u;
     const auto count{in.size()};
+    const auto pairs = (count + 1u) / 2u;
+    auto preimages = std::vector<Preimage>(pairs);
+    auto views = std::vector<ReadView>{};
+    views.reserve(pairs);
 
     for (auto i = std::size_t{0}; i < count; i += 2u) {
         const auto offset = std::size_t{(1u == (count - i)) ? 0u : 1u};
-        auto& next = out.emplace_back();
-        const auto hashed = calculate_merkle_hash(
-            api,
-            chain,
-            in.at(i),
-            in.at(i + offset),
-            preallocated(next.size(), next.data()));
+        const auto& lhs = in.at(i);
+        const auto& rhs = in.at(i + offset);
+
+        if (chunk != lhs.size()) {
+            throw std::runtime_error("Invalid lhs hash size");
+        }
+        if (chunk != rhs.size()) {
+            throw std::runtime_error("Invalid rhs hash size");
+        }
 
-        if (false == hashed) { return false; }
+        auto& preimage = preimages.at(i / 2u);
+        auto it = preimage.data();
+        std::memcpy(it, lhs.data(), chunk);
+        std::advance(it, chunk);
+        std::memcpy(it, rhs.data(), chunk);
+        views.emplace_back(
+            reinterpret_cast<const char*>(preimage.data()), preimage.size());
     }
 
-    return true;
+    out.clear();
+    out.resize(pairs);
+    static_assert(
+        sizeof(typename OutputContainer::value_type) == chunk,
+        "output elements must be contiguous hashes");
+
+    return MerkleHashes(
+        api, chain, views, preallocated(pairs * chunk, out.data()));
 }
 
 auto Block::calculate_merkle_value(
@@ -481,16 +544,23 @@ auto Block::calculate_merkle_value(
 auto Block::calculate_size() const noexcept -> CalculatedSize
 {
     auto output = CalculatedSize{
-        0, network::blockchain::bitcoin::CompactSize(transactions_.size())};
+        0, network::blockchain::bitcoin::CompactSize(index_.size())};
     auto& [bytes, cs] = output;
-    auto cb = [](const auto& previous, const auto& in) -> std::size_t {
-        return previous + in.second->CalculateSize();
-    };
-    bytes = std::accumulate(
-        std::begin(transactions_),
-        std::end(transactions_),
-        header_bytes_ + cs.Size() + extra_bytes(),
-        cb);
+    bytes = header_bytes_ + cs.Size() + extra_bytes();
+
+    if (is_lazy()) {
+        auto cb = [](const auto& previous, const auto& in) -> std::size_t {
+            return previous + in.second;
+        };
+        bytes = std::accumulate(
+            std::begin(locations_), std::end(locations_), bytes, cb);
+    } else {
+        auto cb = [](const auto& previous, const auto& in) -> std::size_t {
+            return previous + in.second->CalculateSize();
+        };
+        bytes = std::accumulate(
+            std::begin(transactions_), std::end(transactions_), bytes, cb);
+    }
 
     return output;
 }
@@ -499,11 +569,26 @@ auto Block::ExtractElements(const FilterType style) const noexcept
     -> std::vector<Space>
 {
     auto output = std::vector<Space>{};
-    LogTrace(OT_METHOD)(__FUNCTION__)(": processing ")(transactions_.size())(
+    LogTrace(OT_METHOD)(__FUNCTION__)(": processing ")(index_.size())(
         " transactions")
         .Flush();
 
-    for (const auto& [txid, tx] : transactions_) {
+    for (auto i = std::size_t{0}; i < index_.size(); ++i) {
+        // NOTE transactions which are only needed to construct a filter are
+        // not retained
+        const auto tx = [&]() -> value_type {
+            try {
+
+                return peek(i);
+            } catch (const std::exception& e) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+                return {};
+            }
+        }();
+
+        if (false == bool(tx)) { return {}; }
+
         auto temp = tx->ExtractElements(style);
         output.insert(
             output.end(),
@@ -519,6 +604,34 @@ auto Block::ExtractElements(const FilterType style) const noexcept
     return output;
 }
 
+auto Block::find(const ReadView txid) const noexcept(false) -> std::size_t
+{
+    auto lock = Lock{lock_};
+
+    if (sorted_.empty()) {
+        sorted_.resize(index_.size());
+        std::iota(std::begin(sorted_), std::end(sorted_), std::size_t{0});
+        std::sort(
+            std::begin(sorted_), std::end(sorted_), [&](auto lhs, auto rhs) {
+                return reader(index_.at(lhs)) < reader(index_.at(rhs));
+            });
+    }
+
+    const auto it = std::lower_bound(
+        std::begin(sorted_),
+        std::end(sorted_),
+        txid,
+        [&](auto lhs, const auto& rhs) {
+            return reader(index_.at(lhs)) < rhs;
+        });
+
+    if ((std::end(sorted_) == it) || (reader(index_.at(*it)) != txid)) {
+        throw std::out_of_range("transaction not found");
+    }
+
+    return *it;
+}
+
 auto Block::FindMatches(
     const FilterType style,
     const Patterns& outpoints,
@@ -528,13 +641,20 @@ auto Block::FindMatches(
 
     LogTrace(OT_METHOD)(__FUNCTION__)(": Verifying ")(
         patterns.size() + outpoints.size())(" potential matches in ")(
-        transactions_.size())(" transactions")
+        index_.size())(" transactions")
         .Flush();
     auto output = Matches{};
     auto& [inputs, outputs] = output;
     const auto parsed = ParsedPatterns{patterns};
+    const auto candidates = screen(outpoints, parsed);
+
+    for (auto i = std::size_t{0}; i < index_.size(); ++i) {
+        if (false == candidates.at(i)) { continue; }
+
+        const auto& tx = at(i);
+
+        if (false == bool(tx)) { continue; }
 
-    for (const auto& [txid, tx] : transactions_) {
         auto temp = tx->FindMatches(style, outpoints, parsed);
         inputs.insert(
             inputs.end(),
@@ -552,6 +672,24 @@ auto Block::FindMatches(
     return output;
 }
 
+auto Block::get(const std::size_t position) const noexcept(false)
+    -> const value_type&
+{
+    const auto txid = reader(index_.at(position));
+    auto lock = Lock{lock_};
+
+    if (auto it = transactions_.find(txid); transactions_.end() != it) {
+
+        return it->second;
+    }
+
+    if (false == is_lazy()) {
+        throw std::out_of_range("transaction not found");
+    }
+
+    return transactions_.emplace(txid, instantiate(position)).first->second;
+}
+
 auto Block::get_or_calculate_size() const noexcept -> CalculatedSize
 {
     if (false == size_.has_value()) { size_ = calculate_size(); }
@@ -561,6 +699,49 @@ auto Block::get_or_calculate_size() const noexcept -> CalculatedSize
     return size_.value();
 }
 
+auto Block::instantiate(const std::size_t position) const noexcept(false)
+    -> value_type
+{
+    OT_ASSERT(is_lazy());
+    OT_ASSERT(nullptr != blockchain_);
+
+    const auto& [offset, bytes] = locations_.at(position);
+    auto tx = factory::BitcoinTransaction(
+        api_,
+        *blockchain_,
+        chain_,
+        position,
+        header_.Timestamp(),
+        blockchain::bitcoin::EncodedTransaction::Deserialize(
+            api_,
+            chain_,
+            ReadView{
+                reinterpret_cast<const char*>(std::next(raw_.data(), offset)),
+                bytes}));
+
+    if (false == bool(tx)) {
+        throw std::runtime_error(
+            "failed to instantiate transaction " + std::to_string(position));
+    }
+
+    return tx;
+}
+
+auto Block::peek(const std::size_t position) const noexcept(false)
+    -> value_type
+{
+    if (false == is_lazy()) { return get(position); }
+
+    {
+        auto lock = Lock{lock_};
+        const auto it = transactions_.find(reader(index_.at(position)));
+
+        if (transactions_.end() != it) { return it->second; }
+    }
+
+    return instantiate(position);
+}
+
 auto Block::Print() const noexcept -> std::string
 {
     auto out = std::stringstream{};
@@ -577,6 +758,62 @@ auto Block::Print() const noexcept -> std::string
     return out.str();
 }
 
+auto Block::screen(const Patterns& outpoints, const ParsedPatterns& patterns)
+    const noexcept -> std::vector<bool>
+{
+    // NOTE every pattern which FindMatches can detect in a transaction appears
+    // verbatim in its serialized form so only transactions which contain the
+    // prefix of at least one pattern need to be instantiated
+    using Prefix = std::uint64_t;
+    constexpr auto prefixBytes = sizeof(Prefix);
+    auto output = std::vector<bool>(index_.size(), true);
+
+    if (false == is_lazy()) { return output; }
+
+    auto prefixes = robin_hood::unordered_flat_set<Prefix>{};
+    const auto add = [&](const auto& data) {
+        if (data.size() < prefixBytes) { return false; }
+
+        auto prefix = Prefix{};
+        std::memcpy(&prefix, data.data(), prefixBytes);
+        prefixes.emplace(prefix);
+
+        return true;
+    };
+
+    for (const auto& [element, outpoint] : outpoints) {
+        if (false == add(outpoint)) { return output; }
+    }
+
+    for (const auto& pattern : patterns.data_) {
+        if (false == add(pattern)) { return output; }
+    }
+
+    for (auto i = std::size_t{0}; i < locations_.size(); ++i) {
+        const auto& [offset, bytes] = locations_.at(i);
+        auto candidate{false};
+
+        if (bytes >= prefixBytes) {
+            const auto* it = std::next(raw_.data(), offset);
+            const auto* const stop = std::next(it, bytes - prefixBytes);
+
+            for (; it <= stop; std::advance(it, 1)) {
+                auto prefix = Prefix{};
+                std::memcpy(&prefix, it, prefixBytes);
+
+                if (0u < prefixes.count(prefix)) {
+                    candidate = true;
+                    break;
+                }
+            }
+        }
+
+        output[i] = candidate;
+    }
+
+    return output;
+}
+
 auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
 {
     if (false == bool(bytes)) {
@@ -631,29 +868,46 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
     remaining -= txCount.Size();
     std::advance(it, txCount.Size());
 
-    for (const auto& txid : index_) {
-        try {
-            const auto& pTX = transactions_.at(reader(txid));
-
-            OT_ASSERT(pTX);
-
-            const auto& tx = *pTX;
-            const auto encoded = tx.Serialize(preallocated(remaining, it));
-
-            if (false == encoded.has_value()) {
+    if (is_lazy()) {
+        for (const auto& [offset, bytes] : locations_) {
+            if (remaining < bytes) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": failed to serialize transaction ")(tx.ID().asHex())
+                    ": Insufficient space for transaction")
                     .Flush();
 
                 return false;
             }
 
-            remaining -= encoded.value();
-            std::advance(it, encoded.value());
-        } catch (...) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": missing transaction").Flush();
+            std::memcpy(it, std::next(raw_.data(), offset), bytes);
+            remaining -= bytes;
+            std::advance(it, bytes);
+        }
+    } else {
+        for (const auto& txid : index_) {
+            try {
+                const auto& pTX = transactions_.at(reader(txid));
+
+                OT_ASSERT(pTX);
+
+                const auto& tx = *pTX;
+                const auto encoded = tx.Serialize(preallocated(remaining, it));
+
+                if (false == encoded.has_value()) {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": failed to serialize transaction ")(tx.ID().asHex())
+                        .Flush();
+
+                    return false;
+                }
 
-            return false;
+                remaining -= encoded.value();
+                std::advance(it, encoded.value());
+            } catch (...) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": missing transaction")
+                    .Flush();
+
+                return false;
+            }
         }
     }
 
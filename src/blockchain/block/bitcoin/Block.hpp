@@ -9,6 +9,7 @@
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
@@ -63,17 +64,13 @@ public:
     using CalculatedSize =
         std::pair<std::size_t, network::blockchain::bitcoin::CompactSize>;
     using TxidIndex = std::vector<Space>;
+    // NOTE offset and size of each transaction in the serialized block
+    using TransactionLocations =
+        std::vector<std::pair<std::size_t, std::size_t>>;
     using TransactionMap = std::map<ReadView, value_type>;
 
     static const std::size_t header_bytes_;
 
-    template <typename HashType>
-    static auto calculate_merkle_hash(
-        const api::Core& api,
-        const Type chain,
-        const HashType& lhs,
-        const HashType& rhs,
-        AllocateOutput out) -> bool;
     template <typename InputContainer, typename OutputContainer>
     static auto calculate_merkle_row(
         const api::Core& api,
@@ -118,6 +115,16 @@ public:
         TxidIndex&& index,
         TransactionMap&& transactions,
         std::optional<CalculatedSize>&& size = {}) noexcept(false);
+    // Transactions are instantiated from raw on demand
+    Block(
+        const api::Core& api,
+        const api::client::Blockchain& blockchain,
+        const blockchain::Type chain,
+        std::unique_ptr<const internal::Header> header,
+        const ReadView raw,
+        TxidIndex&& index,
+        TransactionLocations&& locations,
+        std::optional<CalculatedSize>&& size = {}) noexcept(false);
     ~Block() override;
 
 protected:
@@ -126,18 +133,43 @@ protected:
 private:
     static const value_type null_tx_;
 
+    const api::client::Blockchain* blockchain_;
+    const blockchain::Type chain_;
     const std::unique_ptr<const internal::Header> header_p_;
     const internal::Header& header_;
+    const Space raw_;
     const TxidIndex index_;
-    const TransactionMap transactions_;
+    const TransactionLocations locations_;
+    mutable std::mutex lock_;
+    mutable TransactionMap transactions_;
+    mutable std::vector<std::size_t> sorted_;
     mutable std::optional<CalculatedSize> size_;
 
     auto calculate_size() const noexcept -> CalculatedSize;
     virtual auto extra_bytes() const noexcept -> std::size_t { return 0; }
+    auto find(const ReadView txid) const noexcept(false) -> std::size_t;
+    auto get(const std::size_t position) const noexcept(false)
+        -> const value_type&;
     auto get_or_calculate_size() const noexcept -> CalculatedSize;
+    auto instantiate(const std::size_t position) const noexcept(false)
+        -> value_type;
+    auto is_lazy() const noexcept -> bool { return false == raw_.empty(); }
+    auto peek(const std::size_t position) const noexcept(false) -> value_type;
+    auto screen(const Patterns& outpoints, const ParsedPatterns& patterns)
+        const noexcept -> std::vector<bool>;
     virtual auto serialize_post_header(ByteIterator& it, std::size_t& remaining)
         const noexcept -> bool;
 
+    Block(
+        const api::Core& api,
+        const api::client::Blockchain* blockchain,
+        const blockchain::Type chain,
+        std::unique_ptr<const internal::Header> header,
+        Space&& raw,
+        TxidIndex&& index,
+        TransactionLocations&& locations,
+        TransactionMap&& transactions,
+        std::optional<CalculatedSize>&& size) noexcept(false);
     Block() = delete;
     Block(const Block&) = delete;
     Block(Block&&) = delete;
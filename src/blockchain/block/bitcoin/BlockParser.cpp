@@ -10,7 +10,6 @@
 #include <algorithm>
 #include <iterator>
 #include <limits>
-#include <map>
 #include <stdexcept>
 #include <string_view>
 #include <vector>
@@ -60,7 +59,6 @@ auto parse_header(
 
 auto parse_transactions(
     const api::Core& api,
-    const api::client::Blockchain& blockchain,
     const blockchain::Type chain,
     const ReadView in,
     const blockchain::block::bitcoin::Header& header,
@@ -89,29 +87,49 @@ auto parse_transactions(
         throw std::runtime_error("too many transactions");
     }
 
-    auto counter = int{-1};
+    const auto start = reinterpret_cast<ByteIterator>(in.data());
     auto output = ParsedTransactions{};
-    auto& [index, transactions] = output;
-
-    while (transactions.size() < transactionCount) {
-        auto data = blockchain::bitcoin::EncodedTransaction::Deserialize(
-            api,
-            chain,
+    auto& [index, locations] = output;
+    auto preimages = std::vector<Space>(transactionCount);
+    auto views = std::vector<ReadView>{};
+    locations.reserve(transactionCount);
+    views.reserve(transactionCount);
+
+    while (locations.size() < transactionCount) {
+        auto& preimage = preimages.at(locations.size());
+        const auto txBytes = blockchain::bitcoin::EncodedTransaction::Scan(
             ReadView{
-                reinterpret_cast<const char*>(it), in.size() - expectedSize});
-        const auto txBytes = data.size();
+                reinterpret_cast<const char*>(it), in.size() - expectedSize},
+            preimage);
+
+        if (preimage.empty()) {
+            views.emplace_back(reinterpret_cast<const char*>(it), txBytes);
+        } else {
+            views.emplace_back(reader(preimage));
+        }
+
+        locations.emplace_back(
+            static_cast<std::size_t>(std::distance(start, it)), txBytes);
         std::advance(it, txBytes);
         expectedSize += txBytes;
-        auto& txid = index.emplace_back(data.txid_);
-        transactions.emplace(
-            reader(txid),
-            BitcoinTransaction(
-                api,
-                blockchain,
-                chain,
-                ++counter,
-                header.Timestamp(),
-                std::move(data)));
+    }
+
+    // NOTE every txid in the block is calculated in a single batch
+    auto txids = Space{};
+
+    if (false ==
+        blockchain::TransactionHashes(api, chain, views, writer(txids))) {
+        throw std::runtime_error("Failed to calculate txids");
+    }
+
+    const auto hashBytes = txids.size() / transactionCount;
+    auto txid = txids.cbegin();
+    index.reserve(transactionCount);
+
+    for (auto i = std::size_t{0}; i < transactionCount; ++i) {
+        auto next = std::next(txid, hashBytes);
+        index.emplace_back(txid, next);
+        txid = next;
     }
 
     const auto merkle = ReturnType::calculate_merkle_value(api, chain, index);
@@ -88,16 +88,18 @@ auto parse_pkt_block(
     const auto proofEnd{it};
     auto sizeData = ReturnType::CalculatedSize{
         in.size(), network::blockchain::bitcoin::CompactSize{}};
-    auto [index, transactions] = parse_transactions(
-        api, blockchain, chain, in, header, sizeData, it, expectedSize);
+    auto [index, locations] = parse_transactions(
+        api, chain, in, header, sizeData, it, expectedSize);
 
     return std::make_shared<ReturnType>(
         api,
+        blockchain,
         chain,
         std::move(pHeader),
         std::move(proofs),
+        in,
         std::move(index),
-        std::move(transactions),
+        std::move(locations),
         static_cast<std::size_t>(std::distance(proofStart, proofEnd)),
         std::move(sizeData));
 }
@@ -107,19 +109,23 @@ namespace opentxs::blockchain::block::pkt
 {
 Block::Block(
     const api::Core& api,
+    const api::client::Blockchain& blockchain,
     const blockchain::Type chain,
     std::unique_ptr<const bitcoin::internal::Header> header,
     Proofs&& proofs,
+    const ReadView raw,
     TxidIndex&& index,
-    TransactionMap&& transactions,
+    TransactionLocations&& locations,
     std::optional<std::size_t>&& proofBytes,
     std::optional<CalculatedSize>&& size) noexcept(false)
     : ot_super(
           api,
+          blockchain,
           chain,
           std::move(header),
+          raw,
           std::move(index),
-          std::move(transactions),
+          std::move(locations),
           std::move(size))
     , proofs_(std::move(proofs))
     , proof_bytes_(std::move(proofBytes))
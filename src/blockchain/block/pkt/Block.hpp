@@ -58,11 +58,13 @@ public:
 
     Block(
         const api::Core& api,
+        const api::client::Blockchain& blockchain,
         const blockchain::Type chain,
         std::unique_ptr<const bitcoin::internal::Header> header,
         Proofs&& proofs,
+        const ReadView raw,
         TxidIndex&& index,
-        TransactionMap&& transactions,
+        TransactionLocations&& locations,
         std::optional<std::size_t>&& proofBytes = {},
         std::optional<CalculatedSize>&& size = {}) noexcept(false);
 
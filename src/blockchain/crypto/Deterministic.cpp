@@ -251,11 +251,10 @@ auto Deterministic::check_lookahead(
     const PasswordPrompt& reason) const noexcept(false) -> void
 {
 #if OT_CRYPTO_WITH_BIP32
-    auto needed = need_lookahead(lock, type);
+    const auto needed = need_lookahead(lock, type);
 
-    while (0u < needed) {
-        generated.emplace_back(generate_next(lock, type, reason));
-        --needed;
+    if (0u < needed) {
+        generate(lock, type, generated_.at(type), needed, reason, generated);
     }
 #endif  // OT_CRYPTO_WITH_BIP32
 }
@@ -292,6 +291,24 @@ auto Deterministic::confirm(
     }
 }
 
+auto Deterministic::derive_keys(
+    const rLock&,
+    const Subchain type,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept(false) -> std::vector<ECKey>
+{
+    auto output = std::vector<ECKey>{};
+    output.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        output.emplace_back(
+            PrivateKey(type, first + static_cast<Bip32Index>(i), reason));
+    }
+
+    return output;
+}
+
 auto Deterministic::element(
     const rLock&,
     const Subchain type,
@@ -383,36 +400,62 @@ auto Deterministic::generate(
     const Bip32Index desired,
     const PasswordPrompt& reason) const noexcept(false) -> Bip32Index
 {
+#if OT_CRYPTO_WITH_BIP32
+    auto generated = Batch{};
+    generate(lock, type, desired, 1u, reason, generated);
+
+    OT_ASSERT(1u == generated.size());
+
+    return generated.front();
+#else
+    return {};
+#endif  // OT_CRYPTO_WITH_BIP32
+}
+
+auto Deterministic::generate(
+    const rLock& lock,
+    const Subchain type,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason,
+    Batch& generated) const noexcept(false) -> void
+{
 #if OT_CRYPTO_WITH_BIP32
     auto& index = generated_.at(type);
 
-    OT_ASSERT(desired == index);
+    OT_ASSERT(first == index);
 
-    if (max_index_ <= index) { throw std::runtime_error("Account is full"); }
+    if ((max_index_ <= index) || ((max_index_ - index) < count)) {
+        throw std::runtime_error("Account is full");
+    }
 
-    auto pKey = PrivateKey(type, index, reason);
+    const auto keys = derive_keys(lock, type, first, count, reason);
 
-    if (false == bool(pKey)) {
-        throw std::runtime_error("Failed to generate key");
+    if (keys.size() != count) {
+        throw std::runtime_error("Failed to generate keys");
     }
 
-    const auto& key = *pKey;
     auto& addressMap = (data_.internal_.type_ == type) ? data_.internal_.map_
                                                        : data_.external_.map_;
     const auto& blockchain = parent_.ParentInternal().Parent();
-    const auto [it, added] = addressMap.emplace(
-        std::piecewise_construct,
-        std::forward_as_tuple(index),
-        std::forward_as_tuple(std::make_unique<implementation::Element>(
-            api_, blockchain, *this, chain_, type, index, key)));
 
-    if (false == added) { throw std::runtime_error("Failed to add key"); }
+    for (const auto& pKey : keys) {
+        if (false == bool(pKey)) {
+            throw std::runtime_error("Failed to generate key");
+        }
 
-    set_deterministic_contact(*(it->second));
+        const auto& key = *pKey;
+        const auto [it, added] = addressMap.emplace(
+            std::piecewise_construct,
+            std::forward_as_tuple(index),
+            std::forward_as_tuple(std::make_unique<implementation::Element>(
+                api_, blockchain, *this, chain_, type, index, key)));
 
-    return index++;
-#else
-    return {};
+        if (false == added) { throw std::runtime_error("Failed to add key"); }
+
+        set_deterministic_contact(*(it->second));
+        generated.emplace_back(index++);
+    }
 #endif  // OT_CRYPTO_WITH_BIP32
 }
 
@@ -216,6 +216,16 @@ private:
         const rLock& lock,
         const Subchain type,
         const Bip32Index index) noexcept -> void final;
+    // Returns count keys for consecutive indices starting at first. New
+    // elements only need public keys since private keys are derived on
+    // demand by Element::PrivateKey.
+    virtual auto derive_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> std::vector<ECKey>;
     [[nodiscard]] auto finish_allocation(const rLock& lock, Batch& generated)
         const noexcept -> bool;
     [[nodiscard]] auto generate(
@@ -223,6 +233,13 @@ private:
         const Subchain type,
         const Bip32Index index,
         const PasswordPrompt& reason) const noexcept(false) -> Bip32Index;
+    auto generate(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason,
+        Batch& generated) const noexcept(false) -> void;
     [[nodiscard]] auto generate_next(
         const rLock& lock,
         const Subchain type,
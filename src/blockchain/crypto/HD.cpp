@@ -13,6 +13,7 @@
 #include <stdexcept>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "blockchain/crypto/Deterministic.hpp"
 #include "blockchain/crypto/Element.hpp"
@@ -166,6 +167,32 @@ auto HD::account_already_exists(const rLock&) const noexcept -> bool
     return 0 < existing.count(id_->str());
 }
 
+auto HD::derive_keys(
+    const rLock&,
+    const Subchain type,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept(false) -> std::vector<ECKey>
+{
+    auto output = std::vector<ECKey>{};
+#if OT_CRYPTO_WITH_BIP32
+    const auto change =
+        (internalType == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
+    auto keys = api_.Seeds().AccountChildPublicKeys(
+        path_, change, first, count, reason);
+
+    if (keys.size() != count) {
+        throw std::runtime_error("Failed to derive public keys");
+    }
+
+    output.reserve(keys.size());
+
+    for (auto& key : keys) { output.emplace_back(std::move(key)); }
+#endif  // OT_CRYPTO_WITH_BIP32
+
+    return output;
+}
+
 auto HD::PrivateKey(
     const Subchain type,
     const Bip32Index index,
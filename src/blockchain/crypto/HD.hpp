@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -93,6 +94,13 @@ private:
     mutable std::unique_ptr<opentxs::crypto::key::HD> cached_external_;
 
     auto account_already_exists(const rLock& lock) const noexcept -> bool final;
+    auto derive_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> std::vector<ECKey> final;
     auto save(const rLock& lock) const noexcept -> bool final;
 
     HD(const HD&) = delete;
@@ -0,0 +1,277 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                       // IWYU pragma: associated
+#include "1_Internal.hpp"                     // IWYU pragma: associated
+#include "blockchain/database/BestChain.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <utility>
+
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+#define OT_METHOD "opentxs::blockchain::database::BestChain::"
+
+namespace opentxs::blockchain::database
+{
+BestChain::BestChain() noexcept
+    : lock_()
+    , snapshot_([] {
+        auto output = std::make_shared<Snapshot>();
+        output->index_ = std::make_shared<Index>(0u);
+
+        return output;
+    }())
+{
+}
+
+BestChain::Index::Index(const std::size_t minimum) noexcept
+    : mask_([&] {
+        // NOTE keep the table no more than half full so probe sequences stay
+        // short and always end at an empty slot
+        auto size = min_slots_;
+
+        while (size < (2u * minimum)) { size *= 2u; }
+
+        return size - 1u;
+    }())
+    , slots_(mask_ + 1u)
+    , used_(0)
+{
+}
+
+auto BestChain::Apply(
+    const block::Height parent,
+    const node::BestHashes& chain) noexcept -> bool
+{
+    auto lock = Lock{lock_};
+    const auto current = get();
+    const auto& old = *current;
+    const auto floor = std::min(parent, old.tip_);
+
+    if (false == chain.empty()) {
+        auto expected = chain.cbegin()->first;
+
+        if ((0 > expected) || (expected > (floor + 1))) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Gap before height ")(
+                expected)
+                .Flush();
+
+            return false;
+        }
+
+        for (const auto& [height, hash] : chain) {
+            if (height != expected++) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Gap before height ")(
+                    height)
+                    .Flush();
+
+                return false;
+            }
+        }
+    }
+
+    const auto tip = chain.empty() ? floor : chain.crbegin()->first;
+    auto next = std::make_shared<Snapshot>(old);
+    auto modified = std::map<std::size_t, std::shared_ptr<Chunk>>{};
+    next->tip_ = tip;
+    next->chunks_.resize(
+        (0 > tip) ? 0u : (static_cast<std::size_t>(tip) / chunk_size_) + 1u);
+
+    for (const auto& [height, hash] : chain) {
+        const auto key = convert(hash);
+        const auto offset = static_cast<std::size_t>(height);
+        const auto index = offset / chunk_size_;
+        auto it = modified.find(index);
+
+        if (modified.end() == it) {
+            // NOTE chunks are shared with previous snapshots which may still
+            // be in use by readers so they are copied before being modified
+            const auto& existing = next->chunks_.at(index);
+            auto chunk = existing ? std::make_shared<Chunk>(*existing)
+                                  : std::make_shared<Chunk>();
+            it = modified.emplace(index, std::move(chunk)).first;
+        }
+
+        it->second->at(offset % chunk_size_) = key;
+    }
+
+    for (auto& [index, chunk] : modified) {
+        next->chunks_.at(index) = std::move(chunk);
+    }
+
+    // NOTE the hash index must contain every entry of the new snapshot
+    // before the snapshot is published. Readers of older snapshots may be
+    // probing the shared table concurrently, which is safe because existing
+    // slots are never modified.
+    if ((2u * (next->index_->used_ + chain.size())) >
+        next->index_->slots_.size()) {
+        next->index_ = rebuild(*next);
+    } else {
+        for (const auto& [height, hash] : chain) {
+            next->index_->insert(convert(hash), height);
+        }
+    }
+
+    std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>{next});
+
+    return true;
+}
+
+auto BestChain::convert(const block::Hash& hash) noexcept -> Bytes
+{
+    auto output = Bytes{};
+    std::memcpy(
+        output.data(), hash.data(), std::min(hash.size(), output.size()));
+
+    return output;
+}
+
+auto BestChain::convert(const Bytes& hash) noexcept -> block::pHash
+{
+    return Data::Factory(hash.data(), hash.size());
+}
+
+auto BestChain::get() const noexcept -> std::shared_ptr<const Snapshot>
+{
+    return std::atomic_load(&snapshot_);
+}
+
+auto BestChain::Hash(const block::Height height) const noexcept
+    -> block::pHash
+{
+    const auto snapshot = get();
+
+    if ((0 > height) || (height > snapshot->tip_)) { return Data::Factory(); }
+
+    return convert(snapshot->get(height));
+}
+
+auto BestChain::Hashes(
+    const block::Height start,
+    const block::Hash& stop,
+    const std::size_t limit) const noexcept -> std::vector<block::pHash>
+{
+    const auto snapshot = get();
+    auto output = std::vector<block::pHash>{};
+    const auto first = std::max(start, block::Height{0});
+
+    if (first > snapshot->tip_) { return output; }
+
+    const auto available =
+        static_cast<std::size_t>(snapshot->tip_ - first) + 1u;
+    const auto count = (0u == limit) ? available : std::min(limit, available);
+    const auto key = convert(stop);
+    output.reserve(count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        const auto& hash =
+            snapshot->get(first + static_cast<block::Height>(i));
+        output.emplace_back(convert(hash));
+
+        if ((false == stop.empty()) && (key == hash)) { break; }
+    }
+
+    return output;
+}
+
+auto BestChain::Height(const block::Hash& hash) const noexcept
+    -> block::Height
+{
+    const auto key = convert(hash);
+    const auto snapshot = get();
+    const auto& index = *snapshot->index_;
+
+    for (auto i = index.start(key);; i = (i + 1u) & index.mask_) {
+        const auto value = index.slots_[i].load(std::memory_order_acquire);
+
+        if (0 == value) { return -1; }
+
+        const auto height = value - 1;
+
+        if ((height <= snapshot->tip_) && (key == snapshot->get(height))) {
+
+            return height;
+        }
+    }
+}
+
+auto BestChain::Index::insert(
+    const Bytes& key,
+    const block::Height height) noexcept -> void
+{
+    auto i = start(key);
+
+    while (0 != slots_[i].load(std::memory_order_relaxed)) {
+        i = (i + 1u) & mask_;
+    }
+
+    slots_[i].store(height + 1, std::memory_order_release);
+    ++used_;
+}
+
+auto BestChain::Index::start(const Bytes& key) const noexcept -> std::size_t
+{
+    // NOTE block hashes are already uniformly distributed
+    auto output = std::size_t{};
+    std::memcpy(&output, key.data(), sizeof(output));
+
+    return output & mask_;
+}
+
+auto BestChain::Recent(const std::size_t count) const noexcept
+    -> std::vector<block::pHash>
+{
+    const auto snapshot = get();
+    auto output = std::vector<block::pHash>{};
+    const auto available = static_cast<std::size_t>(snapshot->tip_ + 1);
+    output.reserve(std::min(count, available));
+
+    for (auto height{snapshot->tip_};
+         (0 <= height) && (output.size() < count);
+         --height) {
+        output.emplace_back(convert(snapshot->get(height)));
+    }
+
+    return output;
+}
+
+auto BestChain::rebuild(const Snapshot& snapshot) noexcept
+    -> std::shared_ptr<Index>
+{
+    const auto count = static_cast<std::size_t>(snapshot.tip_ + 1);
+    auto output = std::make_shared<Index>(2u * count);
+
+    for (auto height = block::Height{0}; height <= snapshot.tip_; ++height) {
+        output->insert(snapshot.get(height), height);
+    }
+
+    return output;
+}
+
+auto BestChain::Snapshot::get(const block::Height height) const noexcept
+    -> const Bytes&
+{
+    const auto offset = static_cast<std::size_t>(height);
+
+    return chunks_.at(offset / chunk_size_)->at(offset % chunk_size_);
+}
+
+auto BestChain::Tip() const noexcept -> block::Position
+{
+    const auto snapshot = get();
+
+    if (0 > snapshot->tip_) { return {-1, block::BlankHash()}; }
+
+    return {snapshot->tip_, convert(snapshot->get(snapshot->tip_))};
+}
+}  // namespace opentxs::blockchain::database
@@ -0,0 +1,103 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+
+namespace opentxs::blockchain::database
+{
+// In-memory copy of the best chain hashes, indexed by height and by hash.
+//
+// Readers never block. Every update publishes a new immutable snapshot of the
+// height index with a single atomic store, and the hash index is published
+// along with it. The hash index is an insert-only table of heights which may
+// be shared by several snapshots, so an entry is only trusted after it has
+// been confirmed against the snapshot which was used to find it.
+class OPENTXS_EXPORT BestChain
+{
+public:
+    // Returns a blank hash if the height is not in the best chain
+    auto Hash(const block::Height height) const noexcept -> block::pHash;
+    auto Hashes(
+        const block::Height start,
+        const block::Hash& stop,
+        const std::size_t limit) const noexcept -> std::vector<block::pHash>;
+    // Returns -1 if the hash is not in the best chain
+    auto Height(const block::Hash& hash) const noexcept -> block::Height;
+    auto Recent(const std::size_t count) const noexcept
+        -> std::vector<block::pHash>;
+    auto Tip() const noexcept -> block::Position;
+
+    // Removes every entry above parent, then adds the supplied positions. The
+    // highest supplied position becomes the new tip.
+    auto Apply(
+        const block::Height parent,
+        const node::BestHashes& chain) noexcept -> bool;
+
+    BestChain() noexcept;
+
+    ~BestChain() = default;
+
+private:
+    static constexpr auto hash_bytes_ = std::size_t{32};
+    static constexpr auto chunk_size_ = std::size_t{2048};
+
+    using Bytes = std::array<std::byte, hash_bytes_>;
+    using Chunk = std::array<Bytes, chunk_size_>;
+
+    static constexpr auto min_slots_ = std::size_t{4096};
+
+    // Open addressing table of height + 1, where 0 marks an empty slot. Only
+    // the writer inserts and no entry is ever removed. Entries for heights
+    // which have been reorganized away remain until the table is rebuilt.
+    struct Index {
+        const std::size_t mask_;
+        std::vector<std::atomic<block::Height>> slots_;
+        std::size_t used_;
+
+        auto start(const Bytes& key) const noexcept -> std::size_t;
+
+        // Only called by the writer
+        auto insert(const Bytes& key, const block::Height height) noexcept
+            -> void;
+
+        Index(const std::size_t minimum) noexcept;
+    };
+
+    struct Snapshot {
+        std::vector<std::shared_ptr<const Chunk>> chunks_{};
+        block::Height tip_{-1};
+        std::shared_ptr<Index> index_{};
+
+        auto get(const block::Height height) const noexcept -> const Bytes&;
+    };
+
+    // Serializes writers only
+    std::mutex lock_;
+    std::shared_ptr<const Snapshot> snapshot_;
+
+    static auto convert(const block::Hash& hash) noexcept -> Bytes;
+    static auto convert(const Bytes& hash) noexcept -> block::pHash;
+    static auto rebuild(const Snapshot& snapshot) noexcept
+        -> std::shared_ptr<Index>;
+
+    auto get() const noexcept -> std::shared_ptr<const Snapshot>;
+
+    BestChain(const BestChain&) = delete;
+    BestChain(BestChain&&) = delete;
+    auto operator=(const BestChain&) -> BestChain& = delete;
+    auto operator=(BestChain&&) -> BestChain& = delete;
+};
+}  // namespace opentxs::blockchain::database
@@ -186,6 +186,22 @@ public:
     {
         return headers_.BestBlock(position);
     }
+    auto BestBlocks(
+        const block::Height start,
+        const block::Hash& stop,
+        const std::size_t limit) const noexcept -> node::HashVector final
+    {
+        return headers_.BestBlocks(start, stop, limit);
+    }
+    auto BestHeight(const block::Hash& hash) const noexcept
+        -> block::Height final
+    {
+        return headers_.BestHeight(hash);
+    }
+    auto BestPosition() const noexcept -> block::Position final
+    {
+        return headers_.BestPosition();
+    }
     auto BlockExists(const block::Hash& block) const noexcept -> bool final
     {
         return common_.BlockExists(block);
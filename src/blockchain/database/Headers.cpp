@@ -63,6 +63,7 @@ Headers::Headers(
     , common_(common)
     , lmdb_(lmdb)
     , lock_()
+    , best_chain_()
 {
     import_genesis(type);
 
@@ -73,6 +74,19 @@ Headers::Headers(
         OT_ASSERT(0 <= best.first);
     }
 
+    {
+        Lock lock(lock_);
+        const auto loaded = load_best_chain(lock);
+
+        OT_ASSERT(loaded);
+
+        const auto best = this->best(lock);
+        const auto tip = best_chain_.Tip();
+
+        OT_ASSERT(best.first == tip.first);
+        OT_ASSERT(best.second == tip.second);
+    }
+
     {
         const auto header = CurrentBest();
 
@@ -92,7 +106,7 @@ auto Headers::ApplyUpdate(const node::UpdateTransaction& update) noexcept
     }
 
     Lock lock(lock_);
-    const auto initialHeight = best(lock).first;
+    const auto initialHeight = best_chain_.Tip().first;
     auto parentTxn = lmdb_.TransactionRW();
 
     if (update.HaveCheckpoint()) {
@@ -236,7 +250,21 @@ auto Headers::ApplyUpdate(const node::UpdateTransaction& update) noexcept
         return false;
     }
 
-    const auto position = best(lock);
+    // NOTE the in-memory index must be updated before any notifications are
+    // sent so that recipients observe the new best chain
+    const auto parent =
+        update.HaveReorg() ? update.ReorgParent().first : initialHeight;
+
+    if (false == best_chain_.Apply(parent, update.BestChain())) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to update best chain index, reloading from database")
+            .Flush();
+        const auto loaded = load_best_chain(lock);
+
+        OT_ASSERT(loaded);
+    }
+
+    const auto position = best_chain_.Tip();
 
     if (update.HaveReorg()) {
         const auto [height, hash] = update.ReorgParent();
@@ -267,22 +295,10 @@ auto Headers::ApplyUpdate(const node::UpdateTransaction& update) noexcept
 auto Headers::BestBlock(const block::Height position) const noexcept(false)
     -> block::pHash
 {
-    auto output = Data::Factory();
-
-    if (0 > position) { return output; }
-
-    lmdb_.Load(
-        BlockHeaderBest,
-        tsv(static_cast<std::size_t>(position)),
-        [&](const auto in) -> void { output->Assign(in.data(), in.size()); });
-
-    if (output->empty()) {
-        // TODO some callers which should be catching this exception aren't.
-        // Clean up those call sites then start throwing this exception.
-        // throw std::out_of_range("No best hash at specified height");
-    }
-
-    return output;
+    // TODO some callers which should be catching an exception aren't. Clean
+    // up those call sites then start throwing std::out_of_range if there is
+    // no best hash at the specified height.
+    return best_chain_.Hash(position);
 }
 
 auto Headers::best() const noexcept -> block::Position
@@ -530,6 +546,30 @@ auto Headers::load_header(const block::Hash& hash) const
     return output;
 }
 
+auto Headers::load_best_chain(const Lock& lock) noexcept -> bool
+{
+    const auto tip = best(lock);
+    auto chain = node::BestHashes{};
+    lmdb_.Read(
+        BlockHeaderBest,
+        [&](const auto key, const auto value) -> bool {
+            auto height = std::size_t{0};
+            std::memcpy(
+                &height, key.data(), std::min(key.size(), sizeof(height)));
+
+            if (static_cast<block::Height>(height) > tip.first) {
+                return false;
+            }
+
+            chain.emplace(height, Data::Factory(value.data(), value.size()));
+
+            return true;
+        },
+        opentxs::storage::lmdb::LMDB::Dir::Forward);
+
+    return best_chain_.Apply(-1, chain);
+}
+
 auto Headers::pop_best(const std::size_t i, MDB_txn* parent) const noexcept
     -> bool
 {
@@ -562,25 +602,7 @@ auto Headers::push_best(
 
 auto Headers::RecentHashes() const noexcept -> std::vector<block::pHash>
 {
-    Lock lock(lock_);
-
-    return recent_hashes(lock);
-}
-
-auto Headers::recent_hashes(const Lock& lock) const noexcept
-    -> std::vector<block::pHash>
-{
-    auto output = std::vector<block::pHash>{};
-    lmdb_.Read(
-        BlockHeaderBest,
-        [&](const auto, const auto value) -> bool {
-            output.emplace_back(Data::Factory(value.data(), value.size()));
-
-            return 100 > output.size();
-        },
-        opentxs::storage::lmdb::LMDB::Dir::Backward);
-
-    return output;
+    return best_chain_.Recent(100);
 }
 
 auto Headers::SiblingHashes() const noexcept -> node::Hashes
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "Proto.hpp"
+#include "blockchain/database/BestChain.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/crypto/Crypto.hpp"
 #include "internal/blockchain/database/Database.hpp"
@@ -76,9 +77,24 @@ struct Headers {
 public:
     auto BestBlock(const block::Height position) const noexcept(false)
         -> block::pHash;
+    auto BestBlocks(
+        const block::Height start,
+        const block::Hash& stop,
+        const std::size_t limit) const noexcept -> node::HashVector
+    {
+        return best_chain_.Hashes(start, stop, limit);
+    }
+    auto BestHeight(const block::Hash& hash) const noexcept -> block::Height
+    {
+        return best_chain_.Height(hash);
+    }
+    auto BestPosition() const noexcept -> block::Position
+    {
+        return best_chain_.Tip();
+    }
     auto CurrentBest() const noexcept -> std::unique_ptr<block::Header>
     {
-        return load_header(best().second);
+        return load_header(best_chain_.Tip().second);
     }
     auto CurrentCheckpoint() const noexcept -> block::Position;
     auto DisconnectedHashes() const noexcept -> node::DisconnectedList;
@@ -118,6 +134,7 @@ private:
     const common::Database& common_;
     const opentxs::storage::lmdb::LMDB& lmdb_;
     mutable std::mutex lock_;
+    BestChain best_chain_;
 
     auto best() const noexcept -> block::Position;
     auto best(const Lock& lock) const noexcept -> block::Position;
@@ -135,7 +152,7 @@ private:
         const block::Position next,
         const bool setTip,
         MDB_txn* parent) const noexcept -> bool;
-    auto recent_hashes(const Lock& lock) const noexcept
-        -> std::vector<block::pHash>;
+
+    auto load_best_chain(const Lock& lock) noexcept -> bool;
 };
 }  // namespace opentxs::blockchain::database
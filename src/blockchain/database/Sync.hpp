@@ -61,9 +61,13 @@ namespace blockchain
 namespace sync
 {
 class Block;
-class Data;
 }  // namespace sync
 }  // namespace blockchain
+
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
 }  // namespace network
 
 namespace storage
@@ -81,7 +85,7 @@ class Sync
 {
 public:
     using Items = std::vector<network::blockchain::sync::Block>;
-    using Message = network::blockchain::sync::Data;
+    using Message = network::zeromq::Message;
 
     auto Load(const block::Height height, Message& output) const noexcept
         -> bool;
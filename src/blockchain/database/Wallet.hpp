@@ -97,7 +97,7 @@ class Identifier;
 
 namespace opentxs::blockchain::database
 {
-class Wallet
+class OPENTXS_EXPORT Wallet
 {
 public:
     using Parent = node::internal::WalletDatabase;
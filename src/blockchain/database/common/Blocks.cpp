@@ -8,6 +8,7 @@
 #include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -106,7 +107,8 @@ auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
         return true;
     };
     auto tx = lmdb_.TransactionRW();
-    auto view = bulk_.WriteView(tx, index, std::move(cb), bytes);
+    auto bulkLock = Lock{bulk_.Mutex()};
+    auto view = bulk_.WriteView(bulkLock, tx, index, std::move(cb), bytes);
 
     if (false == view.valid()) {
         LogOutput(OT_METHOD)(__FUNCTION__)(
@@ -18,6 +18,10 @@ namespace opentxs::blockchain::database::common
 {
 struct Bulk::Imp final : private util::MappedFileStorage {
     auto Mutex() const noexcept -> std::mutex& { return lock_; }
+    auto Usage(const Lock&) const noexcept -> Bulk::Report
+    {
+        return report(tables_);
+    }
     auto ReadView(const Lock&, const util::IndexData& index) const noexcept
         -> opentxs::ReadView
     {
@@ -33,26 +37,48 @@ struct Bulk::Imp final : private util::MappedFileStorage {
         return get_write_view(tx, index, std::move(cb), size);
     }
 
+    auto Compact(const Lock&) noexcept -> bool { return compact(tables_); }
+
     Imp(storage::lmdb::LMDB& lmdb, const std::string& path) noexcept(false)
         : MappedFileStorage(
               lmdb,
               path,
               "blk",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextBlockAddress))
+              static_cast<std::size_t>(Database::Key::NextBlockAddress),
+              static_cast<std::size_t>(Database::Key::BlockFreeSpace),
+              static_cast<std::size_t>(Database::Key::BlockStorageGeneration))
         , lock_()
     {
     }
 
 private:
+    // Every table which contains IndexData referencing this storage
+    static const IndexTables tables_;
+
     mutable std::mutex lock_;
 };
 
+const Bulk::Imp::IndexTables Bulk::Imp::tables_{
+    Table::BlockIndex,
+    Table::HeaderIndex,
+    Table::FilterIndexBasic,
+    Table::FilterIndexBCH,
+    Table::FilterIndexES,
+};
+
 Bulk::Bulk(storage::lmdb::LMDB& lmdb, const std::string& path) noexcept(false)
     : imp_(std::make_unique<Imp>(lmdb, path))
 {
 }
 
+auto Bulk::Compact() noexcept -> bool
+{
+    auto lock = Lock{imp_->Mutex()};
+
+    return imp_->Compact(lock);
+}
+
 auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
 
 auto Bulk::ReadView(const util::IndexData& index) const noexcept
@@ -69,6 +95,13 @@ auto Bulk::ReadView(const Lock& lock, const util::IndexData& index)
     return imp_->ReadView(lock, index);
 }
 
+auto Bulk::Usage() const noexcept -> Bulk::Report
+{
+    auto lock = Lock{imp_->Mutex()};
+
+    return imp_->Usage(lock);
+}
+
 auto Bulk::WriteView(
     storage::lmdb::LMDB::Transaction& tx,
     util::IndexData& index,
@@ -14,6 +14,7 @@
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Types.hpp"
 #include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
 
 namespace opentxs
 {
@@ -24,11 +25,6 @@ namespace lmdb
 class LMDB;
 }  // namespace lmdb
 }  // namespace storage
-
-namespace util
-{
-struct IndexData;
-}  // namespace util
 }  // namespace opentxs
 
 namespace opentxs::blockchain::database::common
@@ -36,10 +32,12 @@ namespace opentxs::blockchain::database::common
 class Bulk
 {
 public:
+    using Report = util::MappedFileStorage::Report;
     using UpdateCallback =
         std::function<bool(storage::lmdb::LMDB::Transaction&)>;
 
     auto Mutex() const noexcept -> std::mutex&;
+    auto Usage() const noexcept -> Report;
     auto ReadView(const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
     auto ReadView(const Lock& lock, const util::IndexData& index) const noexcept
@@ -56,6 +54,9 @@ public:
         UpdateCallback&& cb,
         std::size_t size) const noexcept -> WritableView;
 
+    // NOTE must not be called while any views are in use
+    auto Compact() noexcept -> bool;
+
     Bulk(storage::lmdb::LMDB& lmdb, const std::string& path) noexcept(false);
 
     ~Bulk();
@@ -81,6 +81,20 @@ struct Database::Imp {
     Wallet wallet_;
     Configuration config_;
 
+    static auto compact_arg(const ArgList& args) noexcept -> bool
+    {
+        return 0 < args.count(OPENTXS_ARG_COMPACT_BLOCK_DB);
+    }
+    static auto log_report(const Bulk::Report& report) noexcept -> void
+    {
+        for (const auto& file : report) {
+            LogNormal("Block storage file ")(file.file_)(": ")(file.used_)(
+                " bytes used, ")(file.live_)(" bytes live, ")(file.dead())(
+                " bytes dead, ")(file.free_)(" bytes available for reuse")
+                .Flush();
+        }
+    }
+
     static auto block_storage_enabled() noexcept -> bool
     {
         return 1 == OPENTXS_BLOCK_STORAGE_ENABLED;
@@ -354,6 +368,17 @@ struct Database::Imp {
     {
         OT_ASSERT(crypto_shorthash_KEYBYTES == siphash_key_.size());
 
+        if (compact_arg(args)) {
+            LogNormal("Compacting block storage").Flush();
+            log_report(bulk_.Usage());
+
+            if (bulk_.Compact()) {
+                log_report(bulk_.Usage());
+            } else {
+                LogOutput("Failed to compact block storage").Flush();
+            }
+        }
+
         static_assert(
             sizeof(opentxs::blockchain::PatternID) == crypto_shorthash_BYTES);
     }
@@ -576,7 +601,7 @@ auto Database::LookupContact(const Data& pubkeyHash) const noexcept
 auto Database::LoadSync(
     const Chain chain,
     const Height height,
-    opentxs::network::blockchain::sync::Data& output) const noexcept -> bool
+    opentxs::network::zeromq::Message& output) const noexcept -> bool
 {
 #if OPENTXS_BLOCK_STORAGE_ENABLED
     return imp_.sync_.Load(chain, height, output);
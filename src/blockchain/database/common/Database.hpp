@@ -73,9 +73,13 @@ namespace blockchain
 namespace sync
 {
 class Block;
-class Data;
 }  // namespace sync
 }  // namespace blockchain
+
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
 }  // namespace network
 
 namespace proto
@@ -89,7 +93,7 @@ class Data;
 
 namespace opentxs::blockchain::database::common
 {
-class Database final
+class OPENTXS_EXPORT Database final
 {
 public:
     enum class Key : std::size_t {
@@ -98,6 +102,10 @@ public:
         SiphashKey = 2,
         NextSyncAddress = 3,
         SyncServerEndpoint = 4,
+        BlockFreeSpace = 5,
+        BlockStorageGeneration = 6,
+        SyncFreeSpace = 7,
+        SyncStorageGeneration = 8,
     };
 
     using BlockHash = opentxs::blockchain::block::Hash;
@@ -155,8 +163,7 @@ public:
     auto LoadSync(
         const Chain chain,
         const Height height,
-        opentxs::network::blockchain::sync::Data& output) const noexcept
-        -> bool;
+        opentxs::network::zeromq::Message& output) const noexcept -> bool;
     auto LoadTransaction(const ReadView txid) const noexcept
         -> std::optional<proto::BlockchainTransaction>;
     auto LookupContact(const Data& pubkeyHash) const noexcept
@@ -19,10 +19,12 @@ extern "C" {
 #include <sodium.h>
 }
 
+#include "Proto.tpp"
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/network/Factory.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
@@ -35,6 +37,11 @@ extern "C" {
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/network/blockchain/sync/Block.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/protobuf/BlockchainP2PSync.pb.h"
+#include "opentxs/protobuf/Check.hpp"
+#include "opentxs/protobuf/verify/BlockchainP2PSync.hpp"
 #include "util/ByteLiterals.hpp"
 #include "util/LMDB.hpp"
 
@@ -49,6 +56,8 @@ auto tsv(const Input& in) noexcept -> ReadView
 }
 
 const std::array<unsigned char, 16> Sync::checksum_key_{};
+const std::size_t Sync::segment_bytes_{1_MiB};
+const std::size_t Sync::cache_bytes_{64_MiB};
 
 Sync::Sync(
     const api::Core& api,
@@ -59,7 +68,9 @@ Sync::Sync(
           path,
           "sync",
           Table::Config,
-          static_cast<std::size_t>(Database::Key::NextSyncAddress))
+          static_cast<std::size_t>(Database::Key::NextSyncAddress),
+          static_cast<std::size_t>(Database::Key::SyncFreeSpace),
+          static_cast<std::size_t>(Database::Key::SyncStorageGeneration))
     , api_(api)
     , tip_table_(Table::SyncTips)
     , lock_()
@@ -72,6 +83,10 @@ Sync::Sync(
 
         return output;
     }())
+    , cache_lock_()
+    , segments_()
+    , segment_order_()
+    , cached_bytes_(0)
 {
     auto cb = [&](const auto key, const auto value) {
         auto chain = std::size_t{};
@@ -145,13 +160,12 @@ auto Sync::import_genesis(const Chain chain) noexcept -> void
     Store(chain, items);
 }
 
-auto Sync::Load(const Chain chain, const Height height, Message& output)
-    const noexcept -> bool
+auto Sync::build(const Chain chain, const Height height, SharedLock& lock)
+    const noexcept -> pSegment
 {
+    auto output = std::make_shared<Segment>();
+    auto& segment = *output;
     const auto start = static_cast<std::size_t>(height + 1);
-    auto haveOne{false};
-    auto total = std::size_t{};
-    auto lock = SharedLock{lock_};
     const auto cb = [&](const auto key, const auto value) {
         if ((nullptr == key.data()) || (sizeof(std::size_t) != key.size())) {
             throw std::runtime_error("Invalid key");
@@ -190,12 +204,27 @@ auto Sync::Load(const Chain chain, const Height height, Message& output)
                 throw std::runtime_error("checksum failure");
             }
 
-            if (false == output.Add(view)) { return false; }
+            const auto proto = proto::Factory<proto::BlockchainP2PSync>(view);
 
-            haveOne = true;
-            total += view.size();
+            if (false == proto::Validate(proto, VERBOSE)) {
+                throw std::runtime_error("Invalid sync packet");
+            }
+
+            const auto expected = segment.packets_.empty()
+                                      ? static_cast<Height>(start)
+                                      : segment.last_ + 1;
+
+            if ((static_cast<Height>(height) != expected) ||
+                (static_cast<Height>(proto.height()) != expected)) {
+                throw std::runtime_error("Non-contiguous sync data");
+            }
 
-            return total < 1_MiB;
+            segment.packets_.emplace_back(space(view));
+            segment.last_ = expected;
+            segment.bytes_ += view.size();
+            segment.full_ = segment.bytes_ >= segment_bytes_;
+
+            return false == segment.full_;
         } catch (const std::exception& e) {
             LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -210,7 +239,121 @@ auto Sync::Load(const Chain chain, const Height height, Message& output)
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
     }
 
-    return haveOne;
+    if (segment.packets_.empty()) { return {}; }
+
+    return output;
+}
+
+auto Sync::cache(const SegmentKey& key, pSegment segment) const noexcept
+    -> void
+{
+    auto lock = Lock{cache_lock_};
+    const auto bytes = segment->bytes_;
+    auto [it, added] = segments_.try_emplace(key, segment);
+
+    if (added) {
+        segment_order_.emplace_back(key);
+    } else {
+        cached_bytes_ -= it->second->bytes_;
+        it->second = std::move(segment);
+    }
+
+    cached_bytes_ += bytes;
+
+    // NOTE evicted segments remain valid for as long as any frames which
+    // refer to them are queued for delivery
+    while ((cached_bytes_ > cache_bytes_) &&
+           (false == segment_order_.empty())) {
+        const auto i = segments_.find(segment_order_.front());
+        segment_order_.pop_front();
+
+        OT_ASSERT(segments_.end() != i);
+
+        cached_bytes_ -= i->second->bytes_;
+        segments_.erase(i);
+    }
+}
+
+auto Sync::cached(const SegmentKey& key) const noexcept -> pSegment
+{
+    auto lock = Lock{cache_lock_};
+
+    try {
+
+        return segments_.at(key);
+    } catch (...) {
+
+        return {};
+    }
+}
+
+auto Sync::invalidate(const Chain chain, const Height height) const noexcept
+    -> void
+{
+    auto lock = Lock{cache_lock_};
+    auto removed = std::set<SegmentKey>{};
+
+    for (auto i = segments_.begin(); i != segments_.end();) {
+        const auto& [key, segment] = *i;
+
+        // NOTE segments which are not full ended at the previous tip and
+        // would be extended by new data
+        if ((key.first == chain) &&
+            ((false == segment->full_) || (segment->last_ > height))) {
+            cached_bytes_ -= segment->bytes_;
+            removed.emplace(key);
+            i = segments_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+
+    if (removed.empty()) { return; }
+
+    segment_order_.erase(
+        std::remove_if(
+            segment_order_.begin(),
+            segment_order_.end(),
+            [&](const auto& key) { return 0u < removed.count(key); }),
+        segment_order_.end());
+}
+
+auto Sync::Load(const Chain chain, const Height height, Message& output)
+    const noexcept -> bool
+{
+    const auto key = SegmentKey{chain, height};
+    auto segment = [&] {
+        // NOTE a shared lock prevents Store and Reorg from modifying the chain
+        // between the cache lookup and the use of the segment without
+        // serializing concurrent readers the way an upgrade lock would
+        auto lock = ReadLock{lock_};
+
+        return cached(key);
+    }();
+
+    if (false == bool(segment)) {
+        auto lock = SharedLock{lock_};
+        // NOTE another thread may have built the segment while this one was
+        // waiting for the lock
+        segment = cached(key);
+
+        if (false == bool(segment)) {
+            segment = build(chain, height, lock);
+
+            if (false == bool(segment)) { return false; }
+
+            cache(key, segment);
+        }
+    }
+
+    for (const auto& packet : segment->packets_) {
+        output.AddFrame();
+        output.Replace(
+            output.size() - 1u,
+            OTZMQFrame{factory::ZMQFrame(segment, reader(packet))});
+    }
+
+    return true;
 }
 
 auto Sync::Reorg(const Chain chain, const Height height) const noexcept -> bool
@@ -255,6 +398,7 @@ auto Sync::reorg(const Chain chain, const Height height) const noexcept -> bool
     }
 
     tip = height;
+    invalidate(chain, height);
 
     return true;
 }
@@ -352,6 +496,7 @@ auto Sync::Store(const Chain chain, const Items& items) const noexcept -> bool
     }
 
     tips_.at(chain) = tip;
+    invalidate(chain, items.front().Height() - 1);
 
     if (false == txn.Finalize(true)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Finalize error").Flush();
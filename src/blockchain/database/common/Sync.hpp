@@ -7,15 +7,19 @@
 
 #include <boost/thread/thread.hpp>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <iosfwd>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "internal/blockchain/node/Node.hpp"
@@ -27,7 +31,6 @@
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/network/blockchain/sync/Block.hpp"
-#include "opentxs/network/blockchain/sync/Data.hpp"
 #include "util/LMDB.hpp"
 #include "util/MappedFileStorage.hpp"
 
@@ -45,9 +48,13 @@ namespace blockchain
 namespace sync
 {
 class Block;
-class Data;
 }  // namespace sync
 }  // namespace blockchain
+
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
 }  // namespace network
 
 namespace storage
@@ -67,9 +74,10 @@ public:
     using Chain = opentxs::blockchain::Type;
     using Height = opentxs::blockchain::block::Height;
     using Block = opentxs::network::blockchain::sync::Block;
-    using Message = opentxs::network::blockchain::sync::Data;
+    using Message = opentxs::network::zeromq::Message;
     using Items = std::vector<Block>;
 
+    // Appends one frame per sync packet following the specified height
     auto Load(const Chain chain, const Height height, Message& output)
         const noexcept -> bool;
     // Delete all entries with a height greater than specified
@@ -84,10 +92,25 @@ public:
 
 private:
     using Mutex = boost::upgrade_mutex;
+    using ReadLock = boost::shared_lock<Mutex>;
     using SharedLock = boost::upgrade_lock<Mutex>;
     using ExclusiveLock = boost::unique_lock<Mutex>;
     using Tips = std::map<Chain, Height>;
 
+    // A contiguous run of verified sync packets which is served to every
+    // client requesting the same start height. Frames refer to the packets
+    // directly so a segment must never be modified once it has been built.
+    struct Segment {
+        std::vector<Space> packets_{};
+        Height last_{-1};
+        std::size_t bytes_{};
+        bool full_{false};
+    };
+
+    using pSegment = std::shared_ptr<const Segment>;
+    using SegmentKey = std::pair<Chain, Height>;
+    using Segments = std::map<SegmentKey, pSegment>;
+
     struct Data {
         util::IndexData index_;
         std::uint64_t checksum_;
@@ -124,13 +147,29 @@ private:
     };
 
     static const std::array<unsigned char, 16> checksum_key_;
+    static const std::size_t segment_bytes_;
+    static const std::size_t cache_bytes_;
 
     const api::Core& api_;
     const int tip_table_;
     mutable Mutex lock_;
     mutable Tips tips_;
-
+    mutable std::mutex cache_lock_;
+    mutable Segments segments_;
+    mutable std::deque<SegmentKey> segment_order_;
+    mutable std::size_t cached_bytes_;
+
+    auto cache(const SegmentKey& key, pSegment segment) const noexcept -> void;
+    // WARNING make sure a lock on lock_ is held
+    auto cached(const SegmentKey& key) const noexcept -> pSegment;
+    // WARNING make sure a lock on lock_ is held
+    auto build(const Chain chain, const Height height, SharedLock& lock)
+        const noexcept -> pSegment;
     auto import_genesis(const Chain chain) noexcept -> void;
+    // Remove cached segments which are affected by a change to the chain
+    // above the specified height
+    auto invalidate(const Chain chain, const Height height) const noexcept
+        -> void;
     // WARNING make sure an exclusive lock is held
     auto reorg(const Chain chain, const Height height) const noexcept -> bool;
 };
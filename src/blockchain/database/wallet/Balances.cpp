@@ -0,0 +1,142 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                             // IWYU pragma: associated
+#include "1_Internal.hpp"                           // IWYU pragma: associated
+#include "blockchain/database/wallet/Balances.hpp"  // IWYU pragma: associated
+
+#include <utility>
+
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Log.hpp"
+
+// #define OT_METHOD "opentxs::blockchain::database::wallet::Balances::"
+
+namespace opentxs::blockchain::database::wallet
+{
+Balances::Balances() noexcept
+    : total_()
+    , accounts_()
+    , nyms_()
+    , changed_()
+{
+}
+
+auto Balances::Account(const Identifier& account) const noexcept -> Balance
+{
+    const auto it = accounts_.find(account);
+
+    if (accounts_.end() == it) { return {}; }
+
+    return it->second.balance();
+}
+
+auto Balances::Add(const TxoState state, const std::uint64_t value) noexcept
+    -> void
+{
+    total_.add(state, value);
+}
+
+auto Balances::AddAccount(
+    const Identifier& account,
+    const TxoState state,
+    const std::uint64_t value,
+    Contributions& output) noexcept -> void
+{
+    auto& totals = accounts_[account];
+    totals.add(state, value);
+    output.accounts_.emplace_back(&totals);
+}
+
+auto Balances::AddNym(
+    const identifier::Nym& nym,
+    const TxoState state,
+    const std::uint64_t value,
+    Contributions& output) noexcept -> void
+{
+    auto& totals = *nyms_.try_emplace(nym).first;
+    totals.second.add(state, value);
+    output.nyms_.emplace_back(&totals);
+    changed_.emplace(totals.first);
+}
+
+auto Balances::Chain() const noexcept -> Balance { return total_.balance(); }
+
+auto Balances::Change(
+    const Contributions& output,
+    const TxoState from,
+    const TxoState to,
+    const std::uint64_t value) noexcept -> void
+{
+    total_.move(from, to, value);
+
+    for (auto* totals : output.accounts_) { totals->move(from, to, value); }
+
+    for (auto* totals : output.nyms_) {
+        totals->second.move(from, to, value);
+        changed_.emplace(totals->first);
+    }
+}
+
+auto Balances::Nym(const identifier::Nym& owner) const noexcept -> Balance
+{
+    const auto it = nyms_.find(owner);
+
+    if (nyms_.end() == it) { return {}; }
+
+    return it->second.balance();
+}
+
+auto Balances::TakeChanged() noexcept -> NymBalances
+{
+    auto output = NymBalances{};
+
+    for (const auto& nym : changed_) { output[nym] = Nym(nym); }
+
+    changed_.clear();
+
+    return output;
+}
+
+auto Balances::Totals::add(
+    const TxoState state,
+    const std::uint64_t value) noexcept -> void
+{
+    get(state) += value;
+}
+
+auto Balances::Totals::balance() const noexcept -> Balance
+{
+    const auto& confirmed = get(TxoState::ConfirmedNew);
+
+    return {
+        confirmed + get(TxoState::UnconfirmedSpend),
+        confirmed + get(TxoState::UnconfirmedNew)};
+}
+
+auto Balances::Totals::get(const TxoState state) const noexcept
+    -> const std::uint64_t&
+{
+    return values_.at(static_cast<std::size_t>(state));
+}
+
+auto Balances::Totals::get(const TxoState state) noexcept -> std::uint64_t&
+{
+    return values_.at(static_cast<std::size_t>(state));
+}
+
+auto Balances::Totals::move(
+    const TxoState from,
+    const TxoState to,
+    const std::uint64_t value) noexcept -> void
+{
+    auto& source = get(from);
+
+    OT_ASSERT(source >= value);
+
+    source -= value;
+    get(to) += value;
+}
+}  // namespace opentxs::blockchain::database::wallet
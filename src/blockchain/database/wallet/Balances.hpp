@@ -0,0 +1,101 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/node/Wallet.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+
+namespace opentxs::blockchain::database::wallet
+{
+// Running totals of output values for the whole chain and for each account
+// and nym, so balance queries never need to visit individual outputs
+class OPENTXS_EXPORT Balances
+{
+public:
+    using TxoState = node::Wallet::TxoState;
+    using NymBalances = std::map<OTNymID, Balance>;
+
+    // Sum of the values of a set of outputs, indexed by state
+    class Totals
+    {
+    public:
+        auto balance() const noexcept -> Balance;
+
+        auto add(const TxoState state, const std::uint64_t value) noexcept
+            -> void;
+        auto move(
+            const TxoState from,
+            const TxoState to,
+            const std::uint64_t value) noexcept -> void;
+
+    private:
+        std::array<std::uint64_t, 6> values_{};
+
+        auto get(const TxoState state) const noexcept -> const std::uint64_t&;
+        auto get(const TxoState state) noexcept -> std::uint64_t&;
+    };
+
+    using AccountTotals = std::map<OTIdentifier, Totals>;
+    using NymTotals = std::map<OTNymID, Totals>;
+
+    // Every set of totals, other than the chain total, which includes an
+    // output. Stored alongside the output.
+    struct Contributions {
+        std::vector<Totals*> accounts_{};
+        std::vector<NymTotals::value_type*> nyms_{};
+    };
+
+    auto Account(const Identifier& account) const noexcept -> Balance;
+    auto Chain() const noexcept -> Balance;
+    auto Nym(const identifier::Nym& owner) const noexcept -> Balance;
+
+    // Adds a newly created output to the chain total
+    auto Add(const TxoState state, const std::uint64_t value) noexcept -> void;
+    // NOTE only call these the first time an output is associated with a
+    // particular account or nym
+    auto AddAccount(
+        const Identifier& account,
+        const TxoState state,
+        const std::uint64_t value,
+        Contributions& output) noexcept -> void;
+    auto AddNym(
+        const identifier::Nym& nym,
+        const TxoState state,
+        const std::uint64_t value,
+        Contributions& output) noexcept -> void;
+    auto Change(
+        const Contributions& output,
+        const TxoState from,
+        const TxoState to,
+        const std::uint64_t value) noexcept -> void;
+    // Returns the balance of every nym whose totals changed since the
+    // previous call
+    auto TakeChanged() noexcept -> NymBalances;
+
+    Balances() noexcept;
+
+private:
+    Totals total_;
+    AccountTotals accounts_;
+    NymTotals nyms_;
+    std::set<OTNymID> changed_;
+
+    Balances(const Balances&) = delete;
+    Balances(Balances&&) = delete;
+    auto operator=(const Balances&) -> Balances& = delete;
+    auto operator=(Balances&&) -> Balances& = delete;
+};
+}  // namespace opentxs::blockchain::database::wallet
@@ -11,13 +11,13 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <deque>
 #include <iosfwd>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <mutex>
-#include <numeric>
 #include <ostream>
-#include <set>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -25,6 +25,7 @@
 #include <utility>
 #include <variant>
 
+#include "blockchain/database/wallet/Balances.hpp"
 #include "blockchain/database/wallet/Proposal.hpp"
 #include "blockchain/database/wallet/Subchain.hpp"
 #include "blockchain/database/wallet/Transaction.hpp"
@@ -55,7 +56,6 @@
 #include "opentxs/iterator/Bidirectional.hpp"
 #include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"
 #include "opentxs/protobuf/BlockchainWalletKey.pb.h"
-#include "util/Container.hpp"
 
 #define OT_METHOD "opentxs::blockchain::database::Output::"
 
@@ -214,8 +214,8 @@ struct Output::Imp {
             }
 
             try {
-                auto& serialized = find_output(lock, outpoint);
-                const auto& [state, position, proto] = serialized;
+                auto& item = find_item(lock, outpoint);
+                const auto& [state, position, proto] = item.output_;
 
                 if (!copy.AssociatePreviousOutput(
                         blockchain_, inputIndex, proto)) {
@@ -226,8 +226,7 @@ struct Output::Imp {
                     return false;
                 }
 
-                if (false ==
-                    change_state(lock, outpoint, serialized, consumed, block)) {
+                if (false == change_state(lock, item, consumed, block)) {
                     LogOutput(OT_METHOD)(__FUNCTION__)(
                         ": Error updating consumed output state")
                         .Flush();
@@ -257,10 +256,9 @@ struct Output::Imp {
             OT_ASSERT(outpoint.Index() == index);
 
             try {
-                auto& serialized = find_output(lock, outpoint);
+                auto& item = find_item(lock, outpoint);
 
-                if (false ==
-                    change_state(lock, outpoint, serialized, created, block)) {
+                if (false == change_state(lock, item, created, block)) {
                     LogOutput(OT_METHOD)(__FUNCTION__)(
                         ": Error updating created output state")
                         .Flush();
@@ -313,7 +311,7 @@ struct Output::Imp {
         // NOTE do not call this function except for debugging: print(lock);
         blockchain_.UpdateBalance(chain_, get_balance(lock));
 
-        for (const auto& [nym, balance] : get_balances(lock)) {
+        for (const auto& [nym, balance] : get_changed_balances(lock)) {
             blockchain_.UpdateBalance(nym, chain_, balance);
         }
 
@@ -363,7 +361,9 @@ struct Output::Imp {
             const auto& outpoint = input.PreviousOutput();
 
             try {
-                if (proposalID != proposal_reverse_index_.at(outpoint)) {
+                const auto& item = find_item(lock, outpoint);
+
+                if (proposalID != proposal_reverse_index_.at(item.handle_)) {
                     LogOutput(OT_METHOD)(__FUNCTION__)(
                         ": Incorrect proposal ID")
                         .Flush();
@@ -400,19 +400,15 @@ struct Output::Imp {
                     .Flush();
             }
 
-            const auto [it, added] = pending.emplace(
-                transaction.ID().Bytes(), static_cast<std::uint32_t>(index));
-            const auto& outpoint = *it;
+            const auto outpoint = Outpoint{
+                transaction.ID().Bytes(), static_cast<std::uint32_t>(index)};
 
             try {
-                auto& serialized = find_output(lock, outpoint);
+                auto& item = find_item(lock, outpoint);
+                const auto changed =
+                    change_state(lock, item, TxoState::UnconfirmedNew, blank_);
 
-                if (false == change_state(
-                                 lock,
-                                 outpoint,
-                                 serialized,
-                                 TxoState::UnconfirmedNew,
-                                 blank_)) {
+                if (false == changed) {
                     LogOutput(OT_METHOD)(__FUNCTION__)(
                         ": Error updating created output state")
                         .Flush();
@@ -434,6 +430,8 @@ struct Output::Imp {
                 }
             }
 
+            add_handle(pending, handles_.at(outpoint));
+
             for (const auto& key : output.Keys()) {
                 const auto& owner = blockchain_.Owner(key);
 
@@ -469,7 +467,7 @@ struct Output::Imp {
         print(lock);
         blockchain_.UpdateBalance(chain_, get_balance(lock));
 
-        for (const auto& [nym, balance] : get_balances(lock)) {
+        for (const auto& [nym, balance] : get_changed_balances(lock)) {
             blockchain_.UpdateBalance(nym, chain_, balance);
         }
 
@@ -481,30 +479,32 @@ struct Output::Imp {
         auto& reserved = proposal_spent_index_[id];
         auto& created = proposal_created_index_[id];
 
-        for (const auto& id : reserved) {
+        for (const auto handle : reserved) {
             if (false == change_state(
                              lock,
-                             id,
+                             handle,
                              TxoState::UnconfirmedSpend,
                              TxoState::ConfirmedNew)) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": failed to reclaim outpoint ")(id.str())
+                    ": failed to reclaim outpoint ")(
+                    slab_.at(handle).outpoint_.str())
                     .Flush();
 
                 return false;
             }
 
-            proposal_reverse_index_.erase(id);
+            proposal_reverse_index_.erase(handle);
         }
 
-        for (const auto& id : created) {
+        for (const auto handle : created) {
             if (false == change_state(
                              lock,
-                             id,
+                             handle,
                              TxoState::UnconfirmedNew,
                              TxoState::OrphanedNew)) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": failed to orphan canceled outpoint ")(id.str())
+                    ": failed to orphan canceled outpoint ")(
+                    slab_.at(handle).outpoint_.str())
                     .Flush();
 
                 return false;
@@ -524,29 +524,31 @@ struct Output::Imp {
         // TODO implement smarter selection algorithms
         auto lock = eLock{lock_};
         auto output = std::optional<UTXO>{std::nullopt};
-        const auto choose = [&](const auto outpoint) -> std::optional<UTXO> {
-            auto& serialized = find_output(lock, outpoint);
-            const auto& [state, position, data] = serialized;
+        const auto choose = [&](const auto handle) -> std::optional<UTXO> {
+            auto& item = slab_.at(handle);
+            const auto& [state, position, data] = item.output_;
 
             if (false == owns(spender, data)) { return std::nullopt; }
 
-            auto output = std::make_optional<UTXO>(outpoint, data);
-            const auto changed = change_state(
-                lock, outpoint, serialized, TxoState::UnconfirmedSpend, blank_);
+            auto output = std::make_optional<UTXO>(item.outpoint_, data);
+            const auto changed =
+                change_state(lock, item, TxoState::UnconfirmedSpend, blank_);
 
             OT_ASSERT(changed);
 
-            proposal_spent_index_[id].emplace(outpoint);
-            proposal_reverse_index_.emplace(outpoint, id);
+            add_handle(proposal_spent_index_[id], handle);
+            proposal_reverse_index_.emplace(handle, id);
             LogVerbose(OT_METHOD)(__FUNCTION__)(": Reserving output ")(
-                outpoint.str())
+                item.outpoint_.str())
                 .Flush();
 
             return output;
         };
         const auto select = [&](const auto& group) -> std::optional<UTXO> {
-            for (const auto& outpoint : group) {
-                auto utxo = choose(outpoint);
+            // NOTE choose() modifies group if an output is selected so the
+            // loop must exit immediately afterwards
+            for (const auto handle : group) {
+                auto utxo = choose(handle);
 
                 if (utxo.has_value()) { return utxo; }
             }
@@ -580,13 +582,13 @@ struct Output::Imp {
         const block::Position& position) noexcept -> bool
     {
         // TODO rebroadcast transactions which have become unconfirmed
-        const auto outpoints = [&] {
-            auto out = std::vector<Outpoint>{};
+        const auto handles = [&] {
+            auto out = Handles{};
 
             try {
-                for (const auto& outpoint : position_index_.at(position)) {
-                    if (belongs_to(lock, outpoint, subchain)) {
-                        insert_sorted(out, outpoint);
+                for (const auto handle : position_index_.at(position)) {
+                    if (belongs_to(lock, handle, subchain)) {
+                        out.emplace_back(handle);
                     }
                 }
             } catch (...) {
@@ -595,10 +597,11 @@ struct Output::Imp {
             return out;
         }();
 
-        for (const auto& id : outpoints) {
-            auto& serialized = find_output(lock, id);
+        for (const auto handle : handles) {
+            auto& item = slab_.at(handle);
+            const auto& id = item.outpoint_;
             const auto state = [&]() -> std::optional<TxoState> {
-                switch (std::get<0>(serialized)) {
+                switch (std::get<0>(item.output_)) {
                     case TxoState::ConfirmedNew:
                     case TxoState::OrphanedNew: {
 
@@ -617,8 +620,7 @@ struct Output::Imp {
             }();
 
             if (state.has_value() &&
-                (!change_state(
-                    lock, id, serialized, state.value(), position))) {
+                (!change_state(lock, item, state.value(), position))) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(
                     ": Failed to update output state")
                     .Flush();
@@ -627,7 +629,7 @@ struct Output::Imp {
             }
 
             const auto& txid = api_.Factory().Data(id.Txid());
-            const auto& [opState, opPosition, data] = serialized;
+            const auto& [opState, opPosition, data] = item.output_;
 
             for (const auto& sKey : data.key()) {
                 using Subchain = blockchain::crypto::Subchain;
@@ -670,7 +672,8 @@ struct Output::Imp {
             return out;
         }())
         , lock_()
-        , outputs_()
+        , slab_()
+        , handles_()
         , account_index_()
         , nym_index_()
         , position_index_()
@@ -679,6 +682,7 @@ struct Output::Imp {
         , proposal_reverse_index_()
         , state_index_()
         , subchain_index_()
+        , balances_()
     {
     }
 
@@ -686,24 +690,47 @@ private:
     using SubchainID = Identifier;
     using pSubchainID = OTIdentifier;
     using Outpoint = block::Outpoint;
-    using Outpoints = std::set<Outpoint>;
     using TxoState = node::Wallet::TxoState;
     using Output = std::
         tuple<TxoState, block::Position, proto::BlockchainTransactionOutput>;
-    using OutputMap =
-        robin_hood::unordered_flat_map<Outpoint, std::unique_ptr<Output>>;
-    using AccountIndex = std::map<OTIdentifier, Outpoints>;
-    using NymIndex = std::map<OTNymID, Outpoints>;
-    using PositionIndex = std::map<block::Position, Outpoints>;
-    using ProposalIndex = std::map<OTIdentifier, Outpoints>;
-    using ProposalReverseIndex = std::map<Outpoint, OTIdentifier>;
-    using StateIndex = std::map<TxoState, Outpoints>;
-    using SubchainIndex =
-        robin_hood::unordered_flat_map<pSubchainID, Outpoints>;
-    using NymBalances = std::map<OTNymID, Balance>;
+    // Position of an output in slab_. Outputs are never removed so a handle
+    // remains valid for the lifetime of the database.
+    using Handle = std::uint32_t;
+    // Sorted by value
+    using Handles = std::vector<Handle>;
+    using HandleSet = robin_hood::unordered_flat_set<Handle>;
+    using HandleMap = robin_hood::unordered_flat_map<Outpoint, Handle>;
+    using AccountIndex = robin_hood::unordered_flat_map<OTIdentifier, Handles>;
+    using NymIndex = robin_hood::unordered_flat_map<OTNymID, Handles>;
+    using PositionIndex =
+        robin_hood::unordered_flat_map<block::Position, Handles>;
+    using ProposalIndex = std::map<OTIdentifier, Handles>;
+    using ProposalReverseIndex =
+        robin_hood::unordered_flat_map<Handle, OTIdentifier>;
+    using StateIndex = std::array<HandleSet, 6>;
+    using SubchainIndex = robin_hood::unordered_flat_map<pSubchainID, Handles>;
+    using NymBalances = wallet::Balances::NymBalances;
+
+    struct Item {
+        const Handle handle_;
+        const Outpoint outpoint_;
+        Output output_;
+        wallet::Balances::Contributions balances_;
+
+        Item(const Handle handle, const Outpoint& id, Output&& output) noexcept
+            : handle_(handle)
+            , outpoint_(id)
+            , output_(std::move(output))
+            , balances_()
+        {
+        }
+    };
+    // NOTE std::deque does not invalidate references to existing elements
+    // when new elements are appended
+    using Slab = std::deque<Item>;
     using KeyID = blockchain::crypto::Key;
     using States = std::vector<TxoState>;
-    using Matches = std::vector<Outpoint>;
+    using Matches = std::vector<Handle>;
 
     const api::Core& api_;
     const api::client::internal::Blockchain& blockchain_;
@@ -713,7 +740,8 @@ private:
     wallet::Transaction& transactions_;
     const block::Position blank_;
     mutable std::shared_mutex lock_;
-    OutputMap outputs_;
+    Slab slab_;
+    HandleMap handles_;
     AccountIndex account_index_;
     NymIndex nym_index_;
     PositionIndex position_index_;
@@ -722,7 +750,41 @@ private:
     ProposalReverseIndex proposal_reverse_index_;
     StateIndex state_index_;
     SubchainIndex subchain_index_;
+    wallet::Balances balances_;
+
+    static auto add_handle(Handles& handles, const Handle handle) noexcept
+        -> bool
+    {
+        // NOTE handles are allocated in increasing order so new outputs are
+        // usually appended
+        if (handles.empty() || (handles.back() < handle)) {
+            handles.emplace_back(handle);
+
+            return true;
+        }
 
+        const auto it =
+            std::lower_bound(handles.begin(), handles.end(), handle);
+
+        if ((handles.end() != it) && (*it == handle)) { return false; }
+
+        handles.insert(it, handle);
+
+        return true;
+    }
+    static auto has_handle(const Handles& handles, const Handle handle) noexcept
+        -> bool
+    {
+        return std::binary_search(handles.begin(), handles.end(), handle);
+    }
+    static auto remove_handle(Handles& handles, const Handle handle) noexcept
+        -> void
+    {
+        const auto it =
+            std::lower_bound(handles.begin(), handles.end(), handle);
+
+        if ((handles.end() != it) && (*it == handle)) { handles.erase(it); }
+    }
     static auto owns(
         const identifier::Nym& spender,
         const proto::BlockchainTransactionOutput& output) noexcept -> bool
@@ -757,20 +819,14 @@ private:
 
     auto belongs_to(
         const eLock& lock,
-        const Outpoint& id,
+        const Handle handle,
         const SubchainID& subchain) const noexcept -> bool
     {
         const auto it1 = subchain_index_.find(subchain);
 
         if (subchain_index_.cend() == it1) { return false; }
 
-        const auto& vector = it1->second;
-
-        for (const auto& outpoint : vector) {
-            if (id == outpoint) { return true; }
-        }
-
-        return false;
+        return has_handle(it1->second, handle);
     }
     auto effective_position(
         const TxoState state,
@@ -791,9 +847,9 @@ private:
     }
     template <typename LockType>
     auto find_account(const LockType& lock, const AccountID& id) const noexcept
-        -> const Outpoints&
+        -> const Handles&
     {
-        static const auto empty = Outpoints{};
+        static const auto empty = Handles{};
 
         try {
 
@@ -805,9 +861,9 @@ private:
     }
     template <typename LockType>
     auto find_nym(const LockType& lock, const identifier::Nym& id)
-        const noexcept -> const Outpoints&
+        const noexcept -> const Handles&
     {
-        static const auto empty = Outpoints{};
+        static const auto empty = Handles{};
 
         try {
 
@@ -818,20 +874,20 @@ private:
         }
     }
     template <typename LockType>
-    auto find_output(const LockType& lock, const Outpoint& id) const
-        noexcept(false) -> const Output&
+    auto find_item(const LockType& lock, const Outpoint& id) const
+        noexcept(false) -> const Item&
     {
-        return *outputs_.at(id);
+        return slab_.at(handles_.at(id));
     }
     template <typename LockType>
     auto find_state(const LockType& lock, TxoState state) const noexcept
-        -> const Outpoints&
+        -> const HandleSet&
     {
-        static const auto empty = Outpoints{};
+        static const auto empty = HandleSet{};
 
         try {
 
-            return state_index_.at(state);
+            return state_index_.at(static_cast<std::size_t>(state));
         } catch (...) {
 
             return empty;
@@ -839,9 +895,9 @@ private:
     }
     template <typename LockType>
     auto find_subchain(const LockType& lock, const NodeID& id) const noexcept
-        -> const Outpoints&
+        -> const Handles&
     {
-        static const auto empty = Outpoints{};
+        static const auto empty = Handles{};
 
         try {
 
@@ -872,53 +928,12 @@ private:
         const identifier::Nym& owner,
         const AccountID& account) const noexcept -> Balance
     {
-        auto output = Balance{};
-        auto& [confirmed, unconfirmed] = output;
-        const auto* pNym = owner.empty() ? nullptr : &owner;
-        const auto* pAcct = account.empty() ? nullptr : &account;
-        auto cb = [&](const auto previous, const auto& outpoint) -> auto
-        {
-            const auto& [state, position, data] = find_output(lock, outpoint);
+        // NOTE an account match implies a nym match
+        if (false == account.empty()) { return balances_.Account(account); }
 
-            return previous + data.value();
-        };
-
-        const auto unconfirmedSpendTotal = [&] {
-            const auto txos =
-                match(lock, {TxoState::UnconfirmedSpend}, pNym, pAcct, nullptr);
+        if (false == owner.empty()) { return balances_.Nym(owner); }
 
-            return std::accumulate(
-                txos.begin(), txos.end(), std::uint64_t{0}, cb);
-        }();
-
-        {
-            const auto txos =
-                match(lock, {TxoState::ConfirmedNew}, pNym, pAcct, nullptr);
-            confirmed =
-                unconfirmedSpendTotal +
-                std::accumulate(txos.begin(), txos.end(), std::uint64_t{0}, cb);
-        }
-
-        {
-            const auto txos =
-                match(lock, {TxoState::UnconfirmedNew}, pNym, pAcct, nullptr);
-            unconfirmed =
-                std::accumulate(txos.begin(), txos.end(), confirmed, cb) -
-                unconfirmedSpendTotal;
-        }
-
-        return output;
-    }
-    template <typename LockType>
-    auto get_balances(const LockType& lock) const noexcept -> NymBalances
-    {
-        auto output = NymBalances{};
-
-        for (const auto& [nym, outpoints] : nym_index_) {
-            output[nym] = get_balance(lock, nym);
-        }
-
-        return output;
+        return balances_.Chain();
     }
     auto get_outputs(
         const sLock& lock,
@@ -930,9 +945,10 @@ private:
         const auto matches = match(lock, states, owner, account, subchain);
         auto output = std::vector<UTXO>{};
 
-        for (const auto& outpoint : matches) {
-            const auto& [state, position, data] = find_output(lock, outpoint);
-            output.emplace_back(outpoint, data);
+        for (const auto handle : matches) {
+            const auto& item = slab_.at(handle);
+            const auto& [state, position, data] = item.output_;
+            output.emplace_back(item.outpoint_, data);
         }
 
         return output;
@@ -955,25 +971,25 @@ private:
     auto has_account(
         const LockType& lock,
         const AccountID& id,
-        const Outpoint& outpoint) const noexcept -> bool
+        const Handle handle) const noexcept -> bool
     {
-        return 0 < find_account<LockType>(lock, id).count(outpoint);
+        return has_handle(find_account<LockType>(lock, id), handle);
     }
     template <typename LockType>
     auto has_nym(
         const LockType& lock,
         const identifier::Nym& id,
-        const Outpoint& outpoint) const noexcept -> bool
+        const Handle handle) const noexcept -> bool
     {
-        return 0 < find_nym<LockType>(lock, id).count(outpoint);
+        return has_handle(find_nym<LockType>(lock, id), handle);
     }
     template <typename LockType>
     auto has_subchain(
         const LockType& lock,
         const NodeID& id,
-        const Outpoint& outpoint) const noexcept -> bool
+        const Handle handle) const noexcept -> bool
     {
-        return 0 < find_subchain<LockType>(lock, id).count(outpoint);
+        return has_handle(find_subchain<LockType>(lock, id), handle);
     }
     template <typename LockType>
     auto match(
@@ -989,23 +1005,27 @@ private:
         const auto allNyms = (nullptr == owner);
 
         for (const auto state : states) {
-            for (const auto& outpoint : find_state(lock, state)) {
+            for (const auto handle : find_state(lock, state)) {
                 // NOTE if a more specific conditions is requested then it's
                 // not necessary to test any more general conditions. A subchain
                 // match implies an account match implies a nym match
                 const auto goodSub =
-                    allSubs || has_subchain(lock, *subchain, outpoint);
+                    allSubs || has_subchain(lock, *subchain, handle);
                 const auto goodAcct = (!allSubs) || allAccts ||
-                                      has_account(lock, *account, outpoint);
+                                      has_account(lock, *account, handle);
                 const auto goodNym = (!allSubs) || (!allAccts) || allNyms ||
-                                     has_nym(lock, *owner, outpoint);
+                                     has_nym(lock, *owner, handle);
 
                 if (goodNym && goodAcct && goodSub) {
-                    output.emplace_back(outpoint);
+                    output.emplace_back(handle);
                 }
             }
         }
 
+        // NOTE the state index is unordered so sort the results to return
+        // outputs in the order they were added
+        std::sort(output.begin(), output.end());
+
         return output;
     }
     template <typename LockType>
@@ -1017,9 +1037,9 @@ private:
         };
         auto output = std::map<TxoState, Output>{};
 
-        for (const auto& data : outputs_) {
-            const auto& outpoint = data.first;
-            const auto& [state, position, proto] = *data.second;
+        for (const auto& item : slab_) {
+            const auto& outpoint = item.outpoint_;
+            const auto& [state, position, proto] = item.output_;
             auto& out = output[state];
             out.text_ << "\n * " << outpoint.str() << ' ';
             out.text_ << " value: " << std::to_string(proto.value());
@@ -1094,10 +1114,24 @@ private:
         OT_ASSERT(false == accountID.empty());
         OT_ASSERT(false == subchainID.empty());
 
-        account_index_[accountID].emplace(outpoint);
-        subchain_index_[subchainID].emplace(outpoint);
+        try {
+            auto& item = find_item(lock, outpoint);
+            add_handle(subchain_index_[subchainID], item.handle_);
 
-        return true;
+            if (add_handle(account_index_[accountID], item.handle_)) {
+                const auto& [state, position, data] = item.output_;
+                balances_.AddAccount(
+                    accountID, state, data.value(), item.balances_);
+            }
+
+            return true;
+        } catch (...) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": outpoint ")(outpoint.str())(
+                " does not exist")
+                .Flush();
+
+            return false;
+        }
     }
     auto associate(
         const eLock& lock,
@@ -1106,37 +1140,50 @@ private:
     {
         OT_ASSERT(false == nymID.empty());
 
-        nym_index_[nymID].emplace(outpoint);
+        try {
+            auto& item = find_item(lock, outpoint);
 
-        return true;
+            if (add_handle(nym_index_[nymID], item.handle_)) {
+                const auto& [state, position, data] = item.output_;
+                balances_.AddNym(nymID, state, data.value(), item.balances_);
+            }
+
+            return true;
+        } catch (...) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": outpoint ")(outpoint.str())(
+                " does not exist")
+                .Flush();
+
+            return false;
+        }
     }
     // Only used by CancelProposal
     auto change_state(
         const eLock& lock,
-        const Outpoint& id,
+        const Handle handle,
         const TxoState oldState,
         const TxoState newState) noexcept -> bool
     {
-        try {
-            auto& serialized = find_output(lock, id);
-            const auto& [state, position, data] = serialized;
+        if (handle >= slab_.size()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": output ")(handle)(
+                " does not exist")
+                .Flush();
 
-            if (state != oldState) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": incorrect state for outpoint ")(id.str())
-                    .Flush();
+            return false;
+        }
 
-                return false;
-            }
+        auto& item = slab_[handle];
+        const auto& [state, position, data] = item.output_;
 
-            return change_state(lock, id, serialized, newState, blank_);
-        } catch (...) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": outpoint ")(id.str())(
-                " does not exist")
+        if (state != oldState) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": incorrect state for outpoint ")(item.outpoint_.str())
                 .Flush();
 
             return false;
         }
+
+        return change_state(lock, item, newState, blank_);
     }
     auto change_state(
         const eLock& lock,
@@ -1145,9 +1192,9 @@ private:
         const block::Position newPosition) noexcept -> bool
     {
         try {
-            auto& serialized = find_output(lock, id);
+            auto& item = find_item(lock, id);
 
-            return change_state(lock, id, serialized, newState, newPosition);
+            return change_state(lock, item, newState, newPosition);
         } catch (...) {
             LogOutput(OT_METHOD)(__FUNCTION__)(": outpoint ")(id.str())(
                 " does not exist")
@@ -1158,26 +1205,34 @@ private:
     }
     auto change_state(
         const eLock& lock,
-        const Outpoint& id,
-        Output& serialized,
+        Item& item,
         const TxoState newState,
         const block::Position newPosition) noexcept -> bool
     {
-        auto& [oldState, oldPosition, data] = serialized;
+        auto& [oldState, oldPosition, data] = item.output_;
+        const auto handle = item.handle_;
         const auto effective =
             effective_position(newState, oldPosition, newPosition);
 
         if (newState != oldState) {
-            auto& from = state_index_[oldState];
-            auto& to = state_index_[newState];
-            to.insert(from.extract(id));
+            state_index(lock, oldState).erase(handle);
+            state_index(lock, newState).emplace(handle);
+            balances_.Change(
+                item.balances_, oldState, newState, data.value());
             oldState = newState;
         }
 
         if (effective != oldPosition) {
-            auto& from = position_index_[oldPosition];
-            auto& to = position_index_[effective];
-            to.insert(from.extract(id));
+            auto it = position_index_.find(oldPosition);
+
+            if (position_index_.end() != it) {
+                auto& from = it->second;
+                remove_handle(from, handle);
+
+                if (from.empty()) { position_index_.erase(it); }
+            }
+
+            add_handle(position_index_[effective], handle);
             oldPosition = effective;
         }
 
@@ -1192,14 +1247,21 @@ private:
     {
         if (-1 == block.first) { return true; }
 
-        if (0 == proposal_reverse_index_.count(outpoint)) { return true; }
+        const auto handle = handles_.find(outpoint);
+
+        if (handles_.end() == handle) { return true; }
+
+        const auto reverse = proposal_reverse_index_.find(handle->second);
 
-        auto proposalID{proposal_reverse_index_.at(outpoint)};
+        if (proposal_reverse_index_.end() == reverse) { return true; }
+
+        auto proposalID{reverse->second};
 
         if (0 < proposal_created_index_.count(proposalID)) {
             auto& created = proposal_created_index_.at(proposalID);
 
-            for (const auto& newOutpoint : created) {
+            for (const auto newOutput : created) {
+                const auto& newOutpoint = slab_.at(newOutput).outpoint_;
                 const auto rhs = api_.Factory().Data(newOutpoint.Txid());
 
                 if (txid != rhs) {
@@ -1222,8 +1284,8 @@ private:
         if (0 < proposal_spent_index_.count(proposalID)) {
             auto& spent = proposal_spent_index_.at(proposalID);
 
-            for (const auto& spentOutpoint : spent) {
-                proposal_reverse_index_.erase(spentOutpoint);
+            for (const auto spentOutput : spent) {
+                proposal_reverse_index_.erase(spentOutput);
             }
 
             proposal_spent_index_.erase(proposalID);
@@ -1238,7 +1300,7 @@ private:
         const block::Position position,
         const block::bitcoin::Output& output) noexcept -> bool
     {
-        if (0 < outputs_.count(id)) {
+        if (0 < handles_.count(id)) {
             LogOutput(OT_METHOD)(__FUNCTION__)(
                 ": Outpoint already exists in db")
                 .Flush();
@@ -1246,7 +1308,14 @@ private:
             return false;
         }
 
+        if (std::numeric_limits<Handle>::max() <= slab_.size()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Too many outputs").Flush();
+
+            return false;
+        }
+
         const auto& effective = effective_position(state, blank_, position);
+        const auto handle = static_cast<Handle>(slab_.size());
 
         {
             auto data = block::bitcoin::Output::SerializeType{};
@@ -1259,22 +1328,30 @@ private:
                 return false;
             }
 
-            outputs_.emplace(
-                std::piecewise_construct,
-                std::forward_as_tuple(id),
-                std::forward_as_tuple(std::make_unique<Output>(
-                    state, effective, std::move(data))));
+            balances_.Add(state, data.value());
+            slab_.emplace_back(
+                handle, id, Output{state, effective, std::move(data)});
         }
 
-        state_index_[state].emplace(id);
-        position_index_[effective].emplace(id);
+        handles_.emplace(id, handle);
+        state_index(lock, state).emplace(handle);
+        add_handle(position_index_[effective], handle);
 
         return true;
     }
-    auto find_output(const eLock& lock, const Outpoint& id) noexcept(false)
-        -> Output&
+    auto find_item(const eLock& lock, const Outpoint& id) noexcept(false)
+        -> Item&
+    {
+        return slab_.at(handles_.at(id));
+    }
+    auto get_changed_balances(const eLock& lock) noexcept -> NymBalances
+    {
+        return balances_.TakeChanged();
+    }
+    auto state_index(const eLock& lock, const TxoState state) noexcept
+        -> HandleSet&
     {
-        return *outputs_.at(id);
+        return state_index_.at(static_cast<std::size_t>(state));
     }
 };
 
@@ -34,6 +34,7 @@ namespace opentxs::factory
 auto BlockOracle(
     const api::Core& api,
     const api::network::internal::Blockchain& network,
+    const blockchain::node::internal::Config& config,
     const blockchain::node::internal::Network& node,
     const blockchain::node::internal::HeaderOracle& header,
     const blockchain::node::internal::BlockDatabase& db,
@@ -44,7 +45,7 @@ auto BlockOracle(
     using ReturnType = blockchain::node::implementation::BlockOracle;
 
     return std::make_unique<ReturnType>(
-        api, network, node, header, db, chain, shutdown);
+        api, network, config, node, header, db, chain, shutdown);
 }
 }  // namespace opentxs::factory
 
@@ -53,6 +54,7 @@ namespace opentxs::blockchain::node::implementation
 BlockOracle::BlockOracle(
     const api::Core& api,
     const api::network::internal::Blockchain& network,
+    const internal::Config& config,
     const internal::Network& node,
     const internal::HeaderOracle& header,
     const internal::BlockDatabase& db,
@@ -62,7 +64,15 @@ BlockOracle::BlockOracle(
     , node_(node)
     , db_(db)
     , lock_()
-    , cache_(api, node, db, network.BlockQueueUpdate(), chain)
+    , received_lock_()
+    , received_()
+    , cache_(
+          api,
+          node,
+          db,
+          network.BlockQueueUpdate(),
+          chain,
+          config.block_cache_bytes_)
     , block_downloader_([&]() -> std::unique_ptr<BlockDownloader> {
         using Policy = database::BlockStorage;
 
@@ -78,6 +88,11 @@ BlockOracle::BlockOracle(
     init_executor({shutdown});
 }
 
+auto BlockOracle::CacheStatistics() const noexcept -> CacheStats
+{
+    return cache_.Statistics();
+}
+
 auto BlockOracle::GetBlockJob() const noexcept -> BlockJob
 {
     auto lock = Lock{lock_};
@@ -150,13 +165,7 @@ auto BlockOracle::pipeline(const zmq::Message& in) noexcept -> void
 
     switch (task) {
         case Task::ProcessBlock: {
-            if (2 > body.size()) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(": No block").Flush();
-
-                OT_FAIL;
-            }
-
-            cache_.ReceiveBlock(body.at(1));
+            process_blocks();
             [[fallthrough]];
         }
         case Task::StateMachine: {
@@ -173,6 +182,18 @@ auto BlockOracle::pipeline(const zmq::Message& in) noexcept -> void
     }
 }
 
+auto BlockOracle::process_blocks() noexcept -> void
+{
+    auto blocks = std::vector<BitcoinBlock_p>{};
+
+    {
+        auto lock = Lock{received_lock_};
+        blocks.swap(received_);
+    }
+
+    for (auto& block : blocks) { cache_.ReceiveBlock(std::move(block)); }
+}
+
 auto BlockOracle::shutdown(std::promise<void>& promise) noexcept -> void
 {
     {
@@ -198,11 +219,19 @@ auto BlockOracle::state_machine() noexcept -> bool
     return cache_.StateMachine();
 }
 
-auto BlockOracle::SubmitBlock(const ReadView in) const noexcept -> void
+auto BlockOracle::SubmitBlock(BitcoinBlock_p in) const noexcept -> void
 {
-    auto work = MakeWork(Task::ProcessBlock);
-    work->AddFrame(in.data(), in.size());
-    pipeline_->Push(work);
+    if (false == running_.get()) { return; }
+
+    // NOTE the parsed block is queued rather than serialized into the message
+    // so the worker does not parse it again. Storing it happens on the worker
+    // so the calling peer is not blocked by the database.
+    {
+        auto lock = Lock{received_lock_};
+        received_.emplace_back(std::move(in));
+    }
+
+    pipeline_->Push(MakeWork(Task::ProcessBlock));
 }
 
 BlockOracle::~BlockOracle() { Shutdown().get(); }
@@ -5,10 +5,8 @@
 
 #pragma once
 
-#include <boost/container/flat_map.hpp>
 #include <chrono>
 #include <cstddef>
-#include <deque>
 #include <functional>
 #include <future>
 #include <iosfwd>
@@ -18,7 +16,10 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
+#include "blockchain/node/blockoracle/Mem.hpp"
+#include "blockchain/node/blockoracle/Sequence.hpp"
 #include "core/Worker.hpp"
 #include "internal/blockchain/node/Node.hpp"
 #include "opentxs/Bytes.hpp"
@@ -87,6 +88,7 @@ public:
         statemachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
     };
 
+    auto CacheStatistics() const noexcept -> CacheStats final;
     auto DownloadQueue() const noexcept -> std::size_t final
     {
         return cache_.DownloadQueue();
@@ -97,7 +99,7 @@ public:
         -> BitcoinBlockFuture final;
     auto LoadBitcoin(const BlockHashes& hashes) const noexcept
         -> BitcoinBlockFutures final;
-    auto SubmitBlock(const ReadView in) const noexcept -> void final;
+    auto SubmitBlock(BitcoinBlock_p in) const noexcept -> void final;
     auto Tip() const noexcept -> block::Position final
     {
         return db_.BlockTip();
@@ -116,6 +118,7 @@ public:
     BlockOracle(
         const api::Core& api,
         const api::network::internal::Blockchain& network,
+        const internal::Config& config,
         const internal::Network& node,
         const internal::HeaderOracle& header,
         const internal::BlockDatabase& db,
@@ -133,13 +136,13 @@ private:
 
     struct Cache {
         auto DownloadQueue() const noexcept -> std::size_t;
-        auto ReceiveBlock(const zmq::Frame& in) const noexcept -> void;
         auto ReceiveBlock(BitcoinBlock_p in) const noexcept -> void;
         auto Request(const block::Hash& block) const noexcept
             -> BitcoinBlockFuture;
         auto Request(const BlockHashes& hashes) const noexcept
             -> BitcoinBlockFutures;
         auto StateMachine() const noexcept -> bool;
+        auto Statistics() const noexcept -> CacheStats;
 
         auto Shutdown() noexcept -> void;
 
@@ -148,33 +151,14 @@ private:
             const internal::Network& node,
             const internal::BlockDatabase& db,
             const network::zeromq::socket::Publish& socket,
-            const blockchain::Type chain) noexcept;
+            const blockchain::Type chain,
+            const std::size_t limit) noexcept;
         ~Cache() { Shutdown(); }
 
     private:
-        static const std::size_t cache_limit_;
+        static const std::size_t prefetch_count_;
         static const std::chrono::seconds download_timeout_;
 
-        struct Mem {
-            auto find(const ReadView& id) const noexcept -> BitcoinBlockFuture;
-
-            auto clear() noexcept -> void;
-            auto push(block::pHash&& id, BitcoinBlockFuture&& future) noexcept
-                -> void;
-
-            Mem(const std::size_t limit) noexcept;
-
-        private:
-            using Completed =
-                std::deque<std::pair<block::pHash, BitcoinBlockFuture>>;
-            using Index = boost::container::
-                flat_map<ReadView, Completed::const_reverse_iterator>;
-
-            const std::size_t limit_;
-            Completed queue_;
-            Index index_;
-        };
-
         const api::Core& api_;
         const internal::Network& node_;
         const internal::BlockDatabase& db_;
@@ -182,16 +166,29 @@ private:
         const blockchain::Type chain_;
         mutable std::mutex lock_;
         mutable Pending pending_;
-        mutable Mem mem_;
+        mutable blockoracle::Mem mem_;
+        mutable blockoracle::Sequence sequence_;
+        mutable BlockHashes prefetch_;
+        mutable std::size_t hits_;
+        mutable std::size_t misses_;
+        mutable std::size_t prefetched_;
         bool running_;
 
+        auto check_sequential(const BlockHashes& hashes) const noexcept
+            -> void;
         auto download(const block::Hash& block) const noexcept -> bool;
+        auto prefetch() const noexcept -> void;
         auto publish(std::size_t cache) const noexcept -> void;
+        auto remember(block::pHash&& id, BitcoinBlockFuture&& future)
+            const noexcept -> void;
     };
 
     const internal::Network& node_;
     const internal::BlockDatabase& db_;
     mutable std::mutex lock_;
+    mutable std::mutex received_lock_;
+    // NOTE blocks submitted by peers which the worker has not yet processed
+    mutable std::vector<BitcoinBlock_p> received_;
     Cache cache_;
     std::unique_ptr<BlockDownloader> block_downloader_;
     const std::unique_ptr<const internal::BlockValidator> validator_;
@@ -202,6 +199,7 @@ private:
         -> std::unique_ptr<const internal::BlockValidator>;
 
     auto pipeline(const zmq::Message& in) noexcept -> void;
+    auto process_blocks() noexcept -> void;
     auto shutdown(std::promise<void>& promise) noexcept -> void;
     auto state_machine() noexcept -> bool;
 
@@ -150,15 +150,6 @@ FilterOracle::FilterOracle(
         auto lock = rLock{lock_};
         new_tip(lock, type, pos);
     })
-    , thread_pool_([&] {
-        auto socket = api_.Network().ZeroMQ().PushSocket(
-            zmq::socket::Socket::Direction::Connect);
-        const auto started = socket->Start(api_.ThreadPool().Endpoint());
-
-        OT_ASSERT(started);
-
-        return socket;
-    }())
     , filter_downloader_([&]() -> std::unique_ptr<FilterDownloader> {
         if (config.download_cfilters_) {
             return std::make_unique<FilterDownloader>(
@@ -204,8 +195,7 @@ FilterOracle::FilterOracle(
                 chain,
                 default_type_,
                 shutdown,
-                cb_,
-                thread_pool_);
+                cb_);
         } else {
             return {};
         }
@@ -499,39 +489,14 @@ auto FilterOracle::ProcessBlock(BlockIndexerData& data) const noexcept -> void
             throw std::runtime_error("Failed to instantiate gcs");
         }
 
-        const auto& gcs = *pGCS;
-        data.filter_hash_ = gcs.Hash();
+        data.filter_hash_ = pGCS->Hash();
         filterHashView = data.filter_hash_->Bytes();
-        auto& previous = task.previous_;
-        constexpr auto limit = std::chrono::minutes{1};
-        using State = std::future_status;
-
-        if (auto status = previous.wait_for(limit); State::ready != status) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(
-                ": Timeout waiting for previous ")(DisplayString(chain_))(
-                " cfheader #")(height - 1)
-                .Flush();
-
-            throw std::runtime_error("timeout");
-        }
-
-        filterHeader = gcs.Header(previous.get()->Bytes());
-
-        if (filterHeader->empty()) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": failed to calculate ")(
-                DisplayString(chain_))(" cfheader #")(height)
-                .Flush();
-
-            throw std::runtime_error("Failed to calculate cfheader");
-        }
-
         LogTrace(OT_METHOD)(__FUNCTION__)(
-            ": Finished calculating cfheader and cfilter for ")(
-            DisplayString(chain_))(" block at height ")(height)
+            ": Finished calculating cfilter for ")(DisplayString(chain_))(
+            " block at height ")(height)
             .Flush();
-        task.process(filter::pHeader{filterHeader});
     } catch (...) {
-        task.process(std::current_exception());
+        data.error_ = std::current_exception();
     }
 }
 
@@ -610,13 +575,12 @@ auto FilterOracle::ProcessSyncData(
             if (false == running_) { return; }
 
             using Pool = api::internal::ThreadPool;
-            auto work = Pool::MakeWork(
-                api_.Network().ZeroMQ(),
-                value(Pool::Work::SyncDataFiltersIncoming));
-            work->AddFrame(reinterpret_cast<std::uintptr_t>(this));
-            work->AddFrame(reinterpret_cast<std::uintptr_t>(&job));
-            thread_pool_->Send(work);
             ++jobCounter;
+            const auto queued = api_.ThreadPool().Submit(
+                value(Pool::Work::SyncDataFiltersIncoming),
+                [this, &job] { ProcessSyncData(job); });
+
+            if (false == queued) { --jobCounter; }
         }
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
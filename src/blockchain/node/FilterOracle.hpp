@@ -37,7 +37,6 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "util/JobCounter.hpp"
 #include "util/Work.hpp"
@@ -205,7 +204,6 @@ private:
     mutable std::recursive_mutex lock_;
     OTZMQPublishSocket new_filters_;
     const NotifyCallback cb_;
-    OTZMQPushSocket thread_pool_;
     mutable std::unique_ptr<FilterDownloader> filter_downloader_;
     mutable std::unique_ptr<HeaderDownloader> header_downloader_;
     mutable std::unique_ptr<BlockIndexer> block_indexer_;
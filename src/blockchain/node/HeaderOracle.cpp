@@ -92,8 +92,7 @@ HeaderOracle::HeaderOracle(
     , chain_(type)
     , lock_()
 {
-    Lock lock(lock_);
-    const auto best = best_chain(lock);
+    const auto best = best_chain();
 
     OT_ASSERT(0 <= best.first);
 }
@@ -106,12 +105,12 @@ auto HeaderOracle::Ancestors(
     Lock lock(lock_);
     const auto check =
         std::max<block::Height>(std::min(start.first, target.first), 0);
-    const auto fast = is_in_best_chain(lock, target.second).first &&
-                      is_in_best_chain(lock, start.second).first &&
+    const auto fast = is_in_best_chain(target.second).first &&
+                      is_in_best_chain(start.second).first &&
                       (start.first < target.first);
 
     if (fast) {
-        auto output = best_chain(lock, start, limit);
+        auto output = best_chain(start, limit);
         lock.unlock();
 
         while ((1 < output.size()) && (output.back().first > target.first)) {
@@ -343,42 +342,34 @@ auto HeaderOracle::apply_checkpoint(
     }
 }
 
-auto HeaderOracle::best_chain(const Lock& lock) const noexcept
-    -> block::Position
+auto HeaderOracle::best_chain() const noexcept -> block::Position
 {
-    return database_.CurrentBest()->Position();
+    return database_.BestPosition();
 }
 
 auto HeaderOracle::BestChain() const noexcept -> block::Position
 {
-    Lock lock(lock_);
-
-    return best_chain(lock);
+    return best_chain();
 }
 
 auto HeaderOracle::BestChain(
     const block::Position& tip,
     const std::size_t limit) const noexcept(false) -> Positions
 {
-    Lock lock(lock_);
-
-    return best_chain(lock, tip, limit);
+    return best_chain(tip, limit);
 }
 
 auto HeaderOracle::best_chain(
-    const Lock& lock,
     const block::Position& tip,
     const std::size_t limit) const noexcept -> Positions
 {
-    const auto [youngest, best] = common_parent(lock, tip);
+    const auto [youngest, best] = common_parent(tip);
     static const auto blank = api_.Factory().Data();
     auto height{youngest.first};
     auto output = Positions{};
 
-    for (auto& hash : best_hashes(lock, height, blank, 0)) {
+    for (auto& hash : best_hashes(height, blank, limit)) {
         output.emplace_back(height++, std::move(hash));
-
-        if ((0u < limit) && (output.size() == limit)) { break; }
     }
 
     return output;
@@ -387,8 +378,6 @@ auto HeaderOracle::best_chain(
 auto HeaderOracle::BestHash(const block::Height height) const noexcept
     -> block::pHash
 {
-    Lock lock(lock_);
-
     try {
         return database_.BestBlock(height);
     } catch (...) {
@@ -402,9 +391,7 @@ auto HeaderOracle::BestHashes(
 {
     static const auto blank = api_.Factory().Data();
 
-    Lock lock(lock_);
-
-    return best_hashes(lock, start, blank, limit);
+    return best_hashes(start, blank, limit);
 }
 
 auto HeaderOracle::BestHashes(
@@ -412,9 +399,7 @@ auto HeaderOracle::BestHashes(
     const block::Hash& stop,
     const std::size_t limit) const noexcept -> Hashes
 {
-    Lock lock(lock_);
-
-    return best_hashes(lock, start, stop, limit);
+    return best_hashes(start, stop, limit);
 }
 
 auto HeaderOracle::BestHashes(
@@ -422,11 +407,10 @@ auto HeaderOracle::BestHashes(
     const block::Hash& stop,
     const std::size_t limit) const noexcept -> Hashes
 {
-    Lock lock(lock_);
     auto start = std::size_t{0};
 
     for (const auto& hash : previous) {
-        const auto [best, height] = is_in_best_chain(lock, hash);
+        const auto [best, height] = is_in_best_chain(hash);
 
         if (best) {
             start = height;
@@ -434,40 +418,15 @@ auto HeaderOracle::BestHashes(
         }
     }
 
-    return best_hashes(lock, start, stop, limit);
+    return best_hashes(start, stop, limit);
 }
 
 auto HeaderOracle::best_hashes(
-    const Lock& lock,
     const block::Height start,
     const block::Hash& stop,
     const std::size_t limit) const noexcept -> Hashes
 {
-    auto output = Hashes{};
-    const auto limitIsZero = (0 == limit);
-    auto current{start};
-    const auto last{
-        current + static_cast<block::Height>(limit) -
-        static_cast<block::Height>(1)};
-
-    while (limitIsZero || (current <= last)) {
-        try {
-            auto hash = database_.BestBlock(current++);
-
-            // TODO this check shouldn't be necessary but BestBlock doesn't
-            // throw the exception documented in its declaration.
-            if (hash->empty()) { break; }
-
-            const auto stopHere = stop.empty() ? false : (stop == hash);
-            output.emplace_back(std::move(hash));
-
-            if (stopHere) { break; }
-        } catch (...) {
-            break;
-        }
-    }
-
-    return output;
+    return database_.BestBlocks(start, stop, limit);
 }
 
 auto HeaderOracle::CalculateReorg(const block::Position tip) const
@@ -476,7 +435,7 @@ auto HeaderOracle::CalculateReorg(const block::Position tip) const
     auto output = Positions{};
     Lock lock(lock_);
 
-    if (is_in_best_chain(lock, tip)) { return output; }
+    if (is_in_best_chain(tip)) { return output; }
 
     output.emplace_back(tip);
 
@@ -501,7 +460,7 @@ auto HeaderOracle::CalculateReorg(const block::Position tip) const
 
         auto parent = block::Position{height - 1, header.ParentHash()};
 
-        if (is_in_best_chain(lock, parent)) { break; }
+        if (is_in_best_chain(parent)) { break; }
 
         output.emplace_back(std::move(parent));
     }
@@ -596,19 +555,15 @@ auto HeaderOracle::choose_candidate(
 auto HeaderOracle::CommonParent(const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
-    Lock lock(lock_);
-
-    return common_parent(lock, position);
+    return common_parent(position);
 }
 
-auto HeaderOracle::common_parent(
-    const Lock& lock,
-    const block::Position& position) const noexcept
+auto HeaderOracle::common_parent(const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
     const auto& database = database_;
     std::pair<block::Position, block::Position> output{
-        {0, GenesisBlockHash(chain_)}, best_chain(lock)};
+        {0, GenesisBlockHash(chain_)}, best_chain()};
     auto& [parent, best] = output;
     auto test{position};
     auto pHeader = database.TryLoadHeader(test.second);
@@ -616,7 +571,7 @@ auto HeaderOracle::common_parent(
     if (false == bool(pHeader)) { return output; }
 
     while (0 < test.first) {
-        if (is_in_best_chain(lock, test.second).first) {
+        if (is_in_best_chain(test)) {
             parent = test;
 
             return output;
@@ -813,17 +768,13 @@ auto HeaderOracle::initialize_candidate(
 
 auto HeaderOracle::IsInBestChain(const block::Hash& hash) const noexcept -> bool
 {
-    Lock lock(lock_);
-
-    return is_in_best_chain(lock, hash).first;
+    return is_in_best_chain(hash).first;
 }
 
 auto HeaderOracle::IsInBestChain(const block::Position& position) const noexcept
     -> bool
 {
-    Lock lock(lock_);
-
-    return is_in_best_chain(lock, position.first, position.second);
+    return is_in_best_chain(position.first, position.second);
 }
 
 auto HeaderOracle::is_disconnected(
@@ -846,27 +797,21 @@ auto HeaderOracle::is_disconnected(
     }
 }
 
-auto HeaderOracle::is_in_best_chain(const Lock& lock, const block::Hash& hash)
-    const noexcept -> std::pair<bool, block::Height>
+auto HeaderOracle::is_in_best_chain(const block::Hash& hash) const noexcept
+    -> std::pair<bool, block::Height>
 {
-    const auto pHeader = database_.TryLoadHeader(hash);
-
-    if (false == bool(pHeader)) { return {false, -1}; }
+    const auto height = database_.BestHeight(hash);
 
-    const auto& header = *pHeader;
-
-    return {is_in_best_chain(lock, header.Height(), hash), header.Height()};
+    return {0 <= height, height};
 }
 
-auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
-    const block::Position& position) const noexcept -> bool
+auto HeaderOracle::is_in_best_chain(const block::Position& position)
+    const noexcept -> bool
 {
-    return is_in_best_chain(lock, position.first, position.second);
+    return is_in_best_chain(position.first, position.second);
 }
 
 auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
     const block::Height height,
     const block::Hash& hash) const noexcept -> bool
 {
@@ -939,7 +884,7 @@ auto HeaderOracle::ProcessSyncData(
             const auto& hash = hashes.emplace_back(header.Hash());
             previous = hash;
 
-            if (is_in_best_chain(lock, hash).first) { continue; }
+            if (is_in_best_chain(hash).first) { continue; }
         }
 
         if (false == add_header(lock, update, std::move(pHeader))) {
@@ -153,26 +153,21 @@ private:
         const block::Header& current,
         const block::Header& candidate) noexcept -> bool;
 
-    auto best_chain(const Lock& lock) const noexcept -> block::Position;
-    auto best_chain(
-        const Lock& lock,
-        const block::Position& tip,
-        const std::size_t limit) const noexcept -> Positions;
+    auto best_chain() const noexcept -> block::Position;
+    auto best_chain(const block::Position& tip, const std::size_t limit)
+        const noexcept -> Positions;
     auto best_hashes(
-        const Lock& lock,
         const block::Height start,
         const block::Hash& stop,
         const std::size_t limit) const noexcept -> Hashes;
-    auto common_parent(const Lock& lock, const block::Position& position)
-        const noexcept -> std::pair<block::Position, block::Position>;
-    auto is_in_best_chain(const Lock& lock, const block::Hash& hash)
-        const noexcept -> std::pair<bool, block::Height>;
-    auto is_in_best_chain(const Lock& lock, const block::Position& position)
+    auto common_parent(const block::Position& position) const noexcept
+        -> std::pair<block::Position, block::Position>;
+    auto is_in_best_chain(const block::Hash& hash) const noexcept
+        -> std::pair<bool, block::Height>;
+    auto is_in_best_chain(const block::Position& position) const noexcept
+        -> bool;
+    auto is_in_best_chain(const block::Height height, const block::Hash& hash)
         const noexcept -> bool;
-    auto is_in_best_chain(
-        const Lock& lock,
-        const block::Height height,
-        const block::Hash& hash) const noexcept -> bool;
 
     auto add_header(
         const Lock& lock,
@@ -10,24 +10,37 @@
 #include <robin_hood.h>
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <optional>
 #include <queue>
 #include <set>
 #include <shared_mutex>
 #include <string_view>
+#include <tuple>
 #include <utility>
 
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
+#include "opentxs/blockchain/block/bitcoin/Input.hpp"
+#include "opentxs/blockchain/block/bitcoin/Inputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Output.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
 #include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
 #include "opentxs/util/WorkType.hpp"
 
+#define OT_METHOD "opentxs::blockchain::node::Mempool::"
+
 namespace opentxs::blockchain::node
 {
 struct Mempool::Imp {
@@ -41,14 +54,28 @@ struct Mempool::Imp {
         -> std::shared_ptr<const block::bitcoin::Transaction>
     {
         auto lock = sLock{lock_};
+        const auto id = Hash{txid};
+
+        if (auto i = transactions_.find(id); transactions_.end() != i) {
 
-        try {
+            return i->second.tx_;
+        }
 
-            return transactions_.at(Hash{txid});
-        } catch (...) {
+        if (auto i = wtxid_.find(id); wtxid_.end() != i) {
+            if (auto j = transactions_.find(i->second);
+                transactions_.end() != j) {
 
-            return {};
+                return j->second.tx_;
+            }
         }
+
+        return {};
+    }
+    auto Stats() const noexcept -> Statistics
+    {
+        auto lock = sLock{lock_};
+
+        return stats();
     }
     auto Submit(ReadView txid) const noexcept -> bool
     {
@@ -65,8 +92,7 @@ struct Mempool::Imp {
         auto lock = eLock{lock_};
 
         for (const auto& txid : txids) {
-            const auto [it, added] =
-                transactions_.try_emplace(Hash{txid}, nullptr);
+            const auto [it, added] = transactions_.try_emplace(Hash{txid});
 
             if (added) {
                 unexpired_txid_.emplace(Clock::now(), txid);
@@ -85,20 +111,47 @@ struct Mempool::Imp {
     {
         if (!tx) { return; }
 
+        const auto now = Clock::now();
         auto txid = Hash{tx->ID().Bytes()};
         auto lock = eLock{lock_};
-        const auto [it, added] = transactions_.try_emplace(txid, nullptr);
+        const auto [it, added] = transactions_.try_emplace(txid);
+
+        if (added) { unexpired_txid_.emplace(now, txid); }
 
-        if (added) { unexpired_txid_.emplace(Clock::now(), txid); }
+        auto& entry = it->second;
 
-        auto& existing = it->second;
+        if (entry.tx_) { return; }
 
-        if (!existing) {
-            existing = std::move(tx);
-            notify(txid);
-            active_.emplace(txid);
-            unexpired_tx_.emplace(Clock::now(), std::move(txid));
+        entry.bytes_ = tx->CalculateSize();
+        entry.fee_rate_ = fee_rate(*tx, entry.bytes_);
+        entry.received_ = now;
+        entry.wtxid_ = tx->WTXID().Bytes();
+        entry.tx_ = std::move(tx);
+        add(txid, entry);
+        unexpired_tx_.emplace(now, txid);
+        trim();
+
+        // NOTE a transaction which was evicted to stay within the budget is
+        // not announced to peers
+        if (0u < active_.count(txid)) { notify(txid); }
+    }
+    auto Transactions() const noexcept
+        -> std::vector<std::shared_ptr<const block::bitcoin::Transaction>>
+    {
+        auto output =
+            std::vector<std::shared_ptr<const block::bitcoin::Transaction>>{};
+        auto lock = sLock{lock_};
+        output.reserve(active_.size());
+
+        for (const auto& txid : active_) {
+            if (auto i = transactions_.find(txid); transactions_.end() != i) {
+                const auto& tx = i->second.tx_;
+
+                if (tx) { output.emplace_back(tx); }
+            }
         }
+
+        return output;
     }
 
     auto Heartbeat() noexcept -> void
@@ -111,12 +164,7 @@ struct Mempool::Imp {
 
             if ((now - time) < tx_limit_) { break; }
 
-            try {
-                transactions_.at(txid).reset();
-            } catch (...) {
-            }
-
-            active_.erase(txid);
+            remove(txid);
             unexpired_tx_.pop();
         }
 
@@ -125,31 +173,53 @@ struct Mempool::Imp {
 
             if ((now - time) < txid_limit_) { break; }
 
+            remove(txid);
             transactions_.erase(txid);
-            active_.erase(txid);
             unexpired_txid_.pop();
         }
+
+        publish();
     }
 
     Imp(const api::Core& api,
         const network::zeromq::socket::Publish& socket,
-        const Type chain) noexcept
+        const Type chain,
+        const std::size_t limit) noexcept
         : api_(api)
         , chain_(chain)
+        , limit_(limit)
         , lock_()
         , transactions_()
+        , wtxid_()
+        , spenders_()
+        , by_fee_()
         , active_()
         , unexpired_txid_()
         , unexpired_tx_()
+        , bytes_(0)
+        , published_()
         , socket_(socket)
     {
     }
 
 private:
     using Hash = std::string;
-    using TransactionMap = robin_hood::unordered_flat_map<
-        Hash,
-        std::shared_ptr<const block::bitcoin::Transaction>>;
+
+    struct Entry {
+        std::shared_ptr<const block::bitcoin::Transaction> tx_{};
+        Hash wtxid_{};
+        std::size_t bytes_{};
+        Amount fee_rate_{};
+        Time received_{};
+    };
+
+    // NOTE a blank entry records a txid which has been seen but for which the
+    // transaction is not held
+    using TransactionMap = robin_hood::unordered_flat_map<Hash, Entry>;
+    using WtxidMap = robin_hood::unordered_flat_map<Hash, Hash>;
+    using SpenderMap = robin_hood::unordered_node_map<Hash, std::set<Hash>>;
+    // NOTE ordered by eviction priority: cheapest first, then oldest first
+    using FeeIndex = std::set<std::tuple<Amount, Time, Hash>>;
     using Data = std::pair<Time, Hash>;
     using Cache = std::queue<Data>;
 
@@ -158,13 +228,77 @@ private:
 
     const api::Core& api_;
     const Type chain_;
+    const std::size_t limit_;
     mutable std::shared_mutex lock_;
     mutable TransactionMap transactions_;
+    mutable WtxidMap wtxid_;
+    mutable SpenderMap spenders_;
+    mutable FeeIndex by_fee_;
     mutable std::set<Hash> active_;
     mutable Cache unexpired_txid_;
     mutable Cache unexpired_tx_;
+    mutable std::size_t bytes_;
+    std::optional<Statistics> published_;
     const network::zeromq::socket::Publish& socket_;
 
+    auto add(const Hash& txid, const Entry& entry) const noexcept -> void
+    {
+        active_.emplace(txid);
+        by_fee_.emplace(entry.fee_rate_, entry.received_, txid);
+        bytes_ += entry.bytes_;
+
+        if (entry.wtxid_ != txid) { wtxid_.emplace(entry.wtxid_, txid); }
+
+        for (const auto& input : entry.tx_->Inputs()) {
+            spenders_[Hash{input.PreviousOutput().Txid()}].emplace(txid);
+        }
+    }
+    // NOTE fee rates can only be calculated when the value of every spent
+    // output is known, either because the parent transaction is in the
+    // mempool or because the input was created by the local wallet. A
+    // transaction does not carry its own fee, so when any parent is unknown
+    // the fee rate is reported as zero and the transaction is evicted before
+    // every transaction with a known fee.
+    auto fee_rate(
+        const block::bitcoin::Transaction& tx,
+        const std::size_t bytes) const noexcept -> Amount
+    {
+        using Input = block::bitcoin::internal::Input;
+        auto input = Amount{0};
+        auto output = Amount{0};
+
+        for (const auto& in : tx.Inputs()) {
+            const auto& outpoint = in.PreviousOutput();
+            const auto value = [&]() -> std::optional<std::int64_t> {
+                try {
+                    const auto i = transactions_.find(Hash{outpoint.Txid()});
+
+                    if ((transactions_.end() != i) && i->second.tx_) {
+                        const auto& parent = *i->second.tx_;
+
+                        return parent.Outputs().at(outpoint.Index()).Value();
+                    }
+
+                    return dynamic_cast<const Input&>(in).Spends().Value();
+                } catch (...) {
+
+                    return std::nullopt;
+                }
+            }();
+
+            if (false == value.has_value()) { return 0; }
+
+            input += static_cast<Amount>(value.value());
+        }
+
+        for (const auto& out : tx.Outputs()) {
+            output += static_cast<Amount>(out.Value());
+        }
+
+        if ((0u == bytes) || (input <= output)) { return 0; }
+
+        return ((input - output) * 1000u) / bytes;
+    }
     auto notify(ReadView txid) const noexcept -> void
     {
         auto work = api_.Network().ZeroMQ().TaggedMessage(
@@ -173,13 +307,110 @@ private:
         work->AddFrame(txid.data(), txid.size());
         socket_.Send(work);
     }
+    auto publish() noexcept -> void
+    {
+        const auto current = stats();
+
+        if (published_.has_value()) {
+            const auto& last = published_.value();
+
+            if ((last.count_ == current.count_) &&
+                (last.bytes_ == current.bytes_) &&
+                (last.min_fee_rate_ == current.min_fee_rate_)) {
+
+                return;
+            }
+        }
+
+        auto work = api_.Network().ZeroMQ().TaggedMessage(
+            WorkType::BlockchainMempoolStats);
+        work->AddFrame(chain_);
+        work->AddFrame(current.count_);
+        work->AddFrame(current.bytes_);
+        work->AddFrame(current.min_fee_rate_);
+        socket_.Send(work);
+        published_ = current;
+    }
+    // Returns the number of transactions removed, including descendants
+    auto remove(const Hash& txid) const noexcept -> std::size_t
+    {
+        auto output = std::size_t{0};
+        auto pending = std::vector<Hash>{txid};
+
+        while (false == pending.empty()) {
+            const auto id = std::move(pending.back());
+            pending.pop_back();
+            auto i = transactions_.find(id);
+
+            if ((transactions_.end() == i) || (!i->second.tx_)) { continue; }
+
+            auto& entry = i->second;
+
+            // NOTE descendants can not be mined without this transaction
+            if (auto s = spenders_.find(id); spenders_.end() != s) {
+                std::copy(
+                    s->second.begin(),
+                    s->second.end(),
+                    std::back_inserter(pending));
+                spenders_.erase(s);
+            }
+
+            for (const auto& input : entry.tx_->Inputs()) {
+                const auto parent = Hash{input.PreviousOutput().Txid()};
+
+                if (auto s = spenders_.find(parent); spenders_.end() != s) {
+                    s->second.erase(id);
+
+                    if (s->second.empty()) { spenders_.erase(s); }
+                }
+            }
+
+            by_fee_.erase({entry.fee_rate_, entry.received_, id});
+            wtxid_.erase(entry.wtxid_);
+            active_.erase(id);
+            bytes_ -= entry.bytes_;
+            entry = Entry{};
+            ++output;
+        }
+
+        return output;
+    }
+    auto stats() const noexcept -> Statistics
+    {
+        auto output = Statistics{};
+        output.count_ = active_.size();
+        output.bytes_ = bytes_;
+
+        if (false == by_fee_.empty()) {
+            output.min_fee_rate_ = std::get<0>(*by_fee_.cbegin());
+        }
+
+        return output;
+    }
+    auto trim() const noexcept -> void
+    {
+        auto evicted = std::size_t{0};
+
+        while ((bytes_ > limit_) && (false == by_fee_.empty())) {
+            const auto txid = std::get<2>(*by_fee_.cbegin());
+            evicted += remove(txid);
+        }
+
+        if (0u < evicted) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(DisplayString(chain_))(
+                " evicted ")(evicted)(" transactions to stay below ")(limit_)(
+                " bytes")
+                .Flush();
+        }
+    }
 };
 
 Mempool::Mempool(
     const api::Core& api,
     const network::zeromq::socket::Publish& socket,
-    const Type chain) noexcept
-    : imp_(std::make_unique<Imp>(api, socket, chain))
+    const Type chain,
+    const std::size_t limit) noexcept
+    : imp_(std::make_unique<Imp>(api, socket, chain, limit))
 {
 }
 
@@ -196,6 +427,8 @@ auto Mempool::Query(ReadView txid) const noexcept
     return imp_->Query(txid);
 }
 
+auto Mempool::Stats() const noexcept -> Statistics { return imp_->Stats(); }
+
 auto Mempool::Submit(ReadView txid) const noexcept -> bool
 {
     return imp_->Submit(txid);
@@ -213,5 +446,11 @@ auto Mempool::Submit(std::unique_ptr<const block::bitcoin::Transaction> tx)
     imp_->Submit(std::move(tx));
 }
 
+auto Mempool::Transactions() const noexcept
+    -> std::vector<std::shared_ptr<const block::bitcoin::Transaction>>
+{
+    return imp_->Transactions();
+}
+
 Mempool::~Mempool() = default;
 }  // namespace opentxs::blockchain::node
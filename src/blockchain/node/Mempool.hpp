@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <string>
@@ -53,24 +54,29 @@ class Publish;
 
 namespace opentxs::blockchain::node
 {
-class Mempool final : public internal::Mempool
+class OPENTXS_EXPORT Mempool final : public internal::Mempool
 {
 public:
     auto Dump() const noexcept -> std::set<std::string> final;
     auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const block::bitcoin::Transaction> final;
+    auto Stats() const noexcept -> Statistics final;
     auto Submit(ReadView txid) const noexcept -> bool final;
     auto Submit(const std::vector<ReadView>& txids) const noexcept
         -> std::vector<bool> final;
     auto Submit(std::unique_ptr<const block::bitcoin::Transaction> tx)
         const noexcept -> void final;
+    auto Transactions() const noexcept
+        -> std::vector<std::shared_ptr<const block::bitcoin::Transaction>>
+            final;
 
     auto Heartbeat() noexcept -> void final;
 
     Mempool(
         const api::Core& api,
         const network::zeromq::socket::Publish& socket,
-        const Type chain) noexcept;
+        const Type chain,
+        const std::size_t limit) noexcept;
 
     ~Mempool() final;
 
@@ -35,6 +35,8 @@ auto Config::print() const noexcept -> std::string
     output << "  * use sync server: " << print_bool(use_sync_server_) << '\n';
     output << "  * disable wallet: " << print_bool(disable_wallet_) << '\n';
     output << "  * sync endpoint: " << sync_endpoint_ << '\n';
+    output << "  * block cache size: " << block_cache_bytes_ << " bytes\n";
+    output << "  * mempool size: " << mempool_bytes_ << " bytes\n";
 
     return output.str();
 }
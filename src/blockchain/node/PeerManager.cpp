@@ -113,6 +113,7 @@ PeerManager::PeerManager(
           peer_target(chain, policy))
     , verified_lock_()
     , verified_peers_()
+    , compact_blocks_()
     , init_promise_()
     , init_(init_promise_.get_future())
 {
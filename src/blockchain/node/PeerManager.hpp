@@ -232,6 +232,11 @@ public:
     auto BroadcastBlock(const block::Block& block) const noexcept -> bool final;
     auto BroadcastTransaction(
         const block::bitcoin::Transaction& tx) const noexcept -> bool final;
+    auto CompactBlocks() const noexcept
+        -> node::internal::CompactBlockStatistics& final
+    {
+        return compact_blocks_;
+    }
     auto Database() const noexcept -> const node::internal::PeerDatabase& final
     {
         return database_;
@@ -330,6 +335,7 @@ private:
     mutable Peers peers_;
     mutable std::mutex verified_lock_;
     mutable std::set<int> verified_peers_;
+    mutable node::internal::CompactBlockStatistics compact_blocks_;
     std::promise<void> init_promise_;
     std::shared_future<void> init_;
 
@@ -146,11 +146,12 @@ Base::Base(
           network.Database(),
           type))
     , config_(config)
-    , mempool_(api, network.Mempool(), type)
+    , mempool_(api, network.Mempool(), type, config.mempool_bytes_)
     , header_p_(factory::HeaderOracle(api, *database_p_, type))
     , block_p_(factory::BlockOracle(
           api,
           network,
+          config_,
           *this,
           *header_p_,
           *database_p_,
@@ -286,30 +287,14 @@ auto Base::AddBlock(const std::shared_ptr<const block::bitcoin::Block> pBlock)
     }
 
     const auto& block = *pBlock;
-
-    try {
-        const auto bytes = [&] {
-            auto output = Space{};
-
-            if (false == block.Serialize(writer(output))) {
-                throw std::runtime_error("Serialization error");
-            }
-
-            return output;
-        }();
-        block_.SubmitBlock(reader(bytes));
-    } catch (...) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": failed to serialize ")(
-            DisplayString(chain_))(" block")
-            .Flush();
-
-        return false;
-    }
-
     const auto& id = block.ID();
+    // NOTE the header is not known yet, so the block must be requested before
+    // it is submitted or the block oracle will ignore it as unsolicited
+    const auto future = block_.LoadBitcoin(id);
+    block_.SubmitBlock(pBlock);
 
     if (std::future_status::ready !=
-        block_.LoadBitcoin(id).wait_for(std::chrono::seconds(60))) {
+        future.wait_for(std::chrono::seconds(60))) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": failed to load ")(
             DisplayString(chain_))(" block")
             .Flush();
@@ -508,9 +493,6 @@ auto Base::pipeline(zmq::Message& in) noexcept -> void
             process_header(in);
             do_work();
         } break;
-        case Task::SubmitBlock: {
-            process_block(in);
-        } break;
         case Task::Heartbeat: {
             mempool_.Heartbeat();
             block_.Heartbeat();
@@ -539,21 +521,6 @@ auto Base::pipeline(zmq::Message& in) noexcept -> void
     }
 }
 
-auto Base::process_block(network::zeromq::Message& in) noexcept -> void
-{
-    if (false == running_.get()) { return; }
-
-    const auto body = in.Body();
-
-    if (2 > body.size()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid block").Flush();
-
-        return;
-    }
-
-    block_.SubmitBlock(body.at(1).Bytes());
-}
-
 auto Base::process_filter_update(network::zeromq::Message& in) noexcept -> void
 {
     if (false == running_.get()) { return; }
@@ -366,7 +366,6 @@ private:
     auto target() const noexcept -> block::Height;
 
     auto pipeline(zmq::Message& in) noexcept -> void;
-    auto process_block(zmq::Message& in) noexcept -> void;
     auto process_filter_update(zmq::Message& in) noexcept -> void;
     auto process_header(zmq::Message& in) noexcept -> void;
     auto process_send_to_address(zmq::Message& in) noexcept -> void;
@@ -316,17 +316,17 @@ private:
             const auto& position = state.Position();
             auto [needSync, parent, data] = hello(lock, position);
             const auto& [height, hash] = parent;
-            auto reply =
+            const auto reply =
                 sync::Data{WorkType::SyncReply, std::move(data), {}, {}};
-            auto send{true};
+            auto out = api_.Network().ZeroMQ().ReplyMessage(incoming);
 
-            if (needSync) { send = db_.LoadSync(height, reply); }
+            if (false == reply.Serialize(out)) { return; }
 
-            auto out = api_.Network().ZeroMQ().ReplyMessage(incoming);
+            // NOTE block frames are appended directly from the sync packet
+            // cache without being parsed or copied
+            if (needSync && (false == db_.LoadSync(height, out))) { return; }
 
-            if (send && reply.Serialize(out)) {
-                OTSocket::send_message(lock, socket_.get(), out);
-            }
+            OTSocket::send_message(lock, socket_.get(), out);
         } catch (const std::exception& e) {
             LogOutput(SYNC_SERVER)(__FUNCTION__)(": ")(e.what()).Flush();
         }
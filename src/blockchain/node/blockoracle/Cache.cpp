@@ -11,6 +11,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "internal/blockchain/database/Database.hpp"
@@ -20,8 +21,10 @@
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/network/Network.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
 #include "opentxs/blockchain/node/BlockOracle.hpp"
+#include "opentxs/blockchain/node/HeaderOracle.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
@@ -35,7 +38,7 @@
 
 namespace opentxs::blockchain::node::implementation
 {
-const std::size_t BlockOracle::Cache::cache_limit_{16};
+const std::size_t BlockOracle::Cache::prefetch_count_{8};
 const std::chrono::seconds BlockOracle::Cache::download_timeout_{60};
 
 BlockOracle::Cache::Cache(
@@ -43,7 +46,8 @@ BlockOracle::Cache::Cache(
     const internal::Network& node,
     const internal::BlockDatabase& db,
     const network::zeromq::socket::Publish& socket,
-    const blockchain::Type chain) noexcept
+    const blockchain::Type chain,
+    const std::size_t limit) noexcept
     : api_(api)
     , node_(node)
     , db_(db)
@@ -51,11 +55,39 @@ BlockOracle::Cache::Cache(
     , chain_(chain)
     , lock_()
     , pending_()
-    , mem_(cache_limit_)
+    , mem_(limit)
+    , sequence_(
+          [&node](const block::Hash& hash) -> std::optional<block::Height> {
+              const auto pHeader =
+                  node.HeaderOracleInternal().LoadHeader(hash);
+
+              if (false == bool(pHeader)) { return std::nullopt; }
+
+              return pHeader->Height();
+          },
+          [&node](const block::Height height, const std::size_t count) {
+              return node.HeaderOracleInternal().BestHashes(height, count);
+          },
+          prefetch_count_)
+    , prefetch_()
+    , hits_(0)
+    , misses_(0)
+    , prefetched_(0)
     , running_(true)
 {
 }
 
+auto BlockOracle::Cache::check_sequential(
+    const BlockHashes& hashes) const noexcept -> void
+{
+    auto next = sequence_.Check(hashes);
+
+    if (next.empty()) { return; }
+
+    auto lock = Lock{lock_};
+    prefetch_.swap(next);
+}
+
 auto BlockOracle::Cache::DownloadQueue() const noexcept -> std::size_t
 {
     auto lock = Lock{lock_};
@@ -63,6 +95,57 @@ auto BlockOracle::Cache::DownloadQueue() const noexcept -> std::size_t
     return pending_.size();
 }
 
+auto BlockOracle::Cache::prefetch() const noexcept -> void
+{
+    auto hashes = [&] {
+        auto lock = Lock{lock_};
+        auto out = BlockHashes{};
+        out.swap(prefetch_);
+
+        if (false == running_) { return BlockHashes{}; }
+
+        out.erase(
+            std::remove_if(
+                out.begin(),
+                out.end(),
+                [&](const auto& hash) {
+                    return mem_.contains(hash->Bytes()) ||
+                           (pending_.end() != pending_.find(hash));
+                }),
+            out.end());
+
+        return out;
+    }();
+
+    // NOTE blocks are only prefetched from storage. Loading and parsing them
+    // happens without holding the lock so requests are not blocked.
+    auto count = std::size_t{0};
+
+    for (const auto& hash : hashes) {
+        auto pBlock = db_.BlockLoadBitcoin(hash);
+
+        if (false == bool(pBlock)) { break; }
+
+        auto promise = Promise{};
+        promise.set_value(std::move(pBlock));
+        auto lock = Lock{lock_};
+
+        if (false == running_) { return; }
+
+        if (mem_.contains(hash->Bytes())) { continue; }
+
+        remember(OTData{hash}, promise.get_future());
+        ++prefetched_;
+        ++count;
+    }
+
+    if (0u < count) {
+        LogTrace(OT_METHOD)(__FUNCTION__)(": ")(DisplayString(chain_))(
+            " prefetched ")(count)(" blocks")
+            .Flush();
+    }
+}
+
 auto BlockOracle::Cache::publish(std::size_t size) const noexcept -> void
 {
     auto work = api_.Network().ZeroMQ().TaggedMessage(
@@ -72,12 +155,6 @@ auto BlockOracle::Cache::publish(std::size_t size) const noexcept -> void
     cache_size_publisher_.Send(work);
 }
 
-auto BlockOracle::Cache::ReceiveBlock(const zmq::Frame& in) const noexcept
-    -> void
-{
-    ReceiveBlock(api_.Factory().BitcoinBlock(chain_, in.Bytes()));
-}
-
 auto BlockOracle::Cache::ReceiveBlock(BitcoinBlock_p in) const noexcept -> void
 {
     if (false == bool(in)) {
@@ -88,6 +165,20 @@ auto BlockOracle::Cache::ReceiveBlock(BitcoinBlock_p in) const noexcept -> void
 
     auto lock = Lock{lock_};
     auto& block = *in;
+    const auto& id = block.ID();
+    auto pending = pending_.find(id);
+    const auto requested = (pending_.end() != pending);
+
+    // NOTE an unsolicited block is only stored if it belongs to a known header
+    // chain so that a peer can not fill the block store with arbitrary blocks
+    if ((false == requested) &&
+        (false == bool(node_.HeaderOracleInternal().LoadHeader(id)))) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Ignoring unsolicited block ")(
+            id.asHex())(" with an unknown header")
+            .Flush();
+
+        return;
+    }
 
     if (database::BlockStorage::None != db_.BlockPolicy()) {
         const auto saved = db_.BlockStore(block);
@@ -95,10 +186,7 @@ auto BlockOracle::Cache::ReceiveBlock(BitcoinBlock_p in) const noexcept -> void
         OT_ASSERT(saved);
     }
 
-    const auto& id = block.ID();
-    auto pending = pending_.find(id);
-
-    if (pending_.end() == pending) {
+    if (false == requested) {
         LogVerbose(OT_METHOD)(__FUNCTION__)(
             ": Received block not in request list")
             .Flush();
@@ -109,11 +197,24 @@ auto BlockOracle::Cache::ReceiveBlock(BitcoinBlock_p in) const noexcept -> void
     auto& [time, promise, future, queued] = pending->second;
     promise.set_value(std::move(in));
     LogVerbose(OT_METHOD)(__FUNCTION__)(": Cached block ")(id.asHex()).Flush();
-    mem_.push(std::move(id), std::move(future));
+    remember(std::move(id), std::move(future));
     pending_.erase(pending);
     publish(pending_.size());
 }
 
+auto BlockOracle::Cache::remember(
+    block::pHash&& id,
+    BitcoinBlockFuture&& future) const noexcept -> void
+{
+    const auto bytes = [&]() -> std::size_t {
+        // NOTE futures are only cached after the promise has been satisfied
+        const auto& pBlock = future.get();
+
+        return bool(pBlock) ? pBlock->CalculateSize() : 0u;
+    }();
+    mem_.push(std::move(id), std::move(future), bytes);
+}
+
 auto BlockOracle::Cache::Request(const block::Hash& block) const noexcept
     -> BitcoinBlockFuture
 {
@@ -127,6 +228,7 @@ auto BlockOracle::Cache::Request(const block::Hash& block) const noexcept
 auto BlockOracle::Cache::Request(const BlockHashes& hashes) const noexcept
     -> BitcoinBlockFutures
 {
+    check_sequential(hashes);
     auto output = BitcoinBlockFutures{};
     output.reserve(hashes.size());
     auto download = std::map<block::pHash, BitcoinBlockFutures::iterator>{};
@@ -150,7 +252,13 @@ auto BlockOracle::Cache::Request(const BlockHashes& hashes) const noexcept
             found = true;
         }
 
-        if (found) { continue; }
+        if (found) {
+            ++hits_;
+
+            continue;
+        }
+
+        ++misses_;
 
         {
             auto it = pending_.find(block);
@@ -170,8 +278,8 @@ auto BlockOracle::Cache::Request(const BlockHashes& hashes) const noexcept
 
             auto promise = Promise{};
             promise.set_value(std::move(pBlock));
-            mem_.push(OTData{block}, promise.get_future());
-            output.emplace_back(mem_.find(block->Bytes()));
+            const auto& future = output.emplace_back(promise.get_future());
+            remember(OTData{block}, BitcoinBlockFuture{future});
             found = true;
         }
 
@@ -222,6 +330,7 @@ auto BlockOracle::Cache::Shutdown() noexcept -> void
     if (running_) {
         running_ = false;
         mem_.clear();
+        prefetch_.clear();
 
         for (auto& [hash, item] : pending_) {
             auto& [time, promise, future, queued] = item;
@@ -235,6 +344,7 @@ auto BlockOracle::Cache::Shutdown() noexcept -> void
 
 auto BlockOracle::Cache::StateMachine() const noexcept -> bool
 {
+    prefetch();
     auto lock = Lock{lock_};
 
     if (false == running_) { return false; }
@@ -242,6 +352,11 @@ auto BlockOracle::Cache::StateMachine() const noexcept -> bool
     LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(DisplayString(chain_))(
         " download queue contains ")(pending_.size())(" blocks.")
         .Flush();
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(DisplayString(chain_))(
+        " block cache contains ")(mem_.size())(" blocks using ")(mem_.bytes())(
+        " of ")(mem_.limit())(" bytes. ")(hits_)(" hits, ")(misses_)(
+        " misses, ")(mem_.evictions())(" evictions")
+        .Flush();
     auto blockList = std::vector<ReadView>{};
     blockList.reserve(pending_.size());
 
@@ -271,4 +386,19 @@ auto BlockOracle::Cache::StateMachine() const noexcept -> bool
 
     return 0 < pending_.size();
 }
+
+auto BlockOracle::Cache::Statistics() const noexcept -> CacheStats
+{
+    auto lock = Lock{lock_};
+    auto output = CacheStats{};
+    output.hits_ = hits_;
+    output.misses_ = misses_;
+    output.evictions_ = mem_.evictions();
+    output.prefetched_ = prefetched_;
+    output.blocks_ = mem_.size();
+    output.bytes_ = mem_.bytes();
+    output.limit_ = mem_.limit();
+
+    return output;
+}
 }  // namespace opentxs::blockchain::node::implementation
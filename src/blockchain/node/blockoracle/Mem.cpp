@@ -3,61 +3,82 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
-#include "0_stdafx.hpp"                     // IWYU pragma: associated
-#include "1_Internal.hpp"                   // IWYU pragma: associated
-#include "blockchain/node/BlockOracle.hpp"  // IWYU pragma: associated
+#include "0_stdafx.hpp"                         // IWYU pragma: associated
+#include "1_Internal.hpp"                       // IWYU pragma: associated
+#include "blockchain/node/blockoracle/Mem.hpp"  // IWYU pragma: associated
 
 #include <iterator>
+#include <utility>
 
-#include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
-#include "opentxs/blockchain/node/BlockOracle.hpp"
+#include "opentxs/core/Data.hpp"
 
-// #define OT_METHOD
-// "opentxs::blockchain::node::implementation::BlockOracle::Cache::Mem::"
+// #define OT_METHOD "opentxs::blockchain::node::blockoracle::Mem::"
 
-namespace opentxs::blockchain::node::implementation
+namespace opentxs::blockchain::node::blockoracle
 {
-BlockOracle::Cache::Mem::Mem(const std::size_t limit) noexcept
+Mem::Mem(const std::size_t limit) noexcept
     : limit_(limit)
+    , bytes_(0)
+    , evictions_(0)
     , queue_()
     , index_()
 {
 }
 
-auto BlockOracle::Cache::Mem::clear() noexcept -> void
+auto Mem::clear() noexcept -> void
 {
     index_.clear();
     queue_.clear();
+    bytes_ = 0;
 }
 
-auto BlockOracle::Cache::Mem::find(const ReadView& id) const noexcept
-    -> BitcoinBlockFuture
+auto Mem::contains(const ReadView& id) const noexcept -> bool
+{
+    return 0 < index_.count(id);
+}
+
+auto Mem::erase(Completed::iterator it) noexcept -> void
+{
+    bytes_ -= it->bytes_;
+    index_.erase(it->id_->Bytes());
+    queue_.erase(it);
+}
+
+auto Mem::find(const ReadView& id) noexcept -> BitcoinBlockFuture
 {
     if ((nullptr == id.data()) || (0 == id.size())) { return {}; }
 
-    try {
+    auto it = index_.find(id);
 
-        return index_.at(id)->second;
-    } catch (...) {
+    if (index_.end() == it) { return {}; }
 
-        return {};
-    }
+    auto& item = it->second;
+    queue_.splice(queue_.begin(), queue_, item);
+
+    return item->future_;
 }
 
-auto BlockOracle::Cache::Mem::push(
+auto Mem::push(
     block::pHash&& id,
-    BitcoinBlockFuture&& future) noexcept -> void
+    BitcoinBlockFuture&& future,
+    const std::size_t bytes) noexcept -> void
 {
     if (0 == id->size()) { return; }
 
-    const auto& item = queue_.emplace_back(std::move(id), std::move(future));
-    index_[item.first->Bytes()] = queue_.crbegin();
+    if (auto it = index_.find(id->Bytes()); index_.end() != it) {
+        erase(it->second);
+    }
+
+    auto& item =
+        queue_.emplace_front(Item{std::move(id), std::move(future), bytes});
+    index_[item.id_->Bytes()] = queue_.begin();
+    bytes_ += bytes;
 
-    while (queue_.size() > limit_) {
-        const auto& item = queue_.front();
-        index_.erase(item.first->Bytes());
-        queue_.pop_front();
+    // NOTE the most recent block is retained even if it exceeds the limit
+    while ((bytes_ > limit_) && (1u < queue_.size())) {
+        erase(std::prev(queue_.end()));
+        ++evictions_;
     }
 }
-}  // namespace opentxs::blockchain::node::implementation
+}  // namespace opentxs::blockchain::node::blockoracle
@@ -0,0 +1,67 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/container/flat_map.hpp>
+#include <cstddef>
+#include <list>
+
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/node/BlockOracle.hpp"
+
+namespace opentxs::blockchain::node::blockoracle
+{
+// Least recently used blocks are evicted once the serialized size of the
+// cached blocks exceeds the limit
+class OPENTXS_EXPORT Mem
+{
+public:
+    using BitcoinBlockFuture = node::BlockOracle::BitcoinBlockFuture;
+
+    auto bytes() const noexcept -> std::size_t { return bytes_; }
+    auto contains(const ReadView& id) const noexcept -> bool;
+    auto evictions() const noexcept -> std::size_t { return evictions_; }
+    auto limit() const noexcept -> std::size_t { return limit_; }
+    auto size() const noexcept -> std::size_t { return queue_.size(); }
+
+    auto clear() noexcept -> void;
+    auto find(const ReadView& id) noexcept -> BitcoinBlockFuture;
+    // NOTE bytes is the serialized size of the block held by future
+    auto push(
+        block::pHash&& id,
+        BitcoinBlockFuture&& future,
+        const std::size_t bytes) noexcept -> void;
+
+    Mem(const std::size_t limit) noexcept;
+
+private:
+    struct Item {
+        block::pHash id_;
+        BitcoinBlockFuture future_;
+        std::size_t bytes_;
+    };
+
+    // NOTE most recently used items are at the front
+    using Completed = std::list<Item>;
+    using Index = boost::container::flat_map<ReadView, Completed::iterator>;
+
+    const std::size_t limit_;
+    std::size_t bytes_;
+    std::size_t evictions_;
+    Completed queue_;
+    Index index_;
+
+    auto erase(Completed::iterator it) noexcept -> void;
+
+    Mem() = delete;
+    Mem(const Mem&) = delete;
+    Mem(Mem&&) = delete;
+    auto operator=(const Mem&) -> Mem& = delete;
+    auto operator=(Mem&&) -> Mem& = delete;
+};
+}  // namespace opentxs::blockchain::node::blockoracle
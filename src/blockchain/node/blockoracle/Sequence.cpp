@@ -0,0 +1,67 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                              // IWYU pragma: associated
+#include "1_Internal.hpp"                            // IWYU pragma: associated
+#include "blockchain/node/blockoracle/Sequence.hpp"  // IWYU pragma: associated
+
+#include <tuple>
+#include <utility>
+
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Data.hpp"
+
+// #define OT_METHOD "opentxs::blockchain::node::blockoracle::Sequence::"
+
+namespace opentxs::blockchain::node::blockoracle
+{
+Sequence::Sequence(
+    GetHeight&& height,
+    GetBest&& best,
+    const std::size_t count) noexcept
+    : get_height_(std::move(height))
+    , get_best_(std::move(best))
+    , count_(count)
+    , lock_()
+    , last_()
+    , expected_height_(0)
+    , expected_()
+{
+}
+
+auto Sequence::Check(const BlockHashes& hashes) noexcept -> BlockHashes
+{
+    if (hashes.empty()) { return {}; }
+
+    auto [previous, base, expected] = [&] {
+        auto lock = Lock{lock_};
+
+        return std::make_tuple(last_, expected_height_, expected_);
+    }();
+    const auto height =
+        [&](const block::Hash& hash) -> std::optional<block::Height> {
+        for (auto i = std::size_t{0}; i < expected.size(); ++i) {
+            if (hash == expected.at(i)) {
+                return base + static_cast<block::Height>(i);
+            }
+        }
+
+        return get_height_(hash);
+    };
+    const auto first = height(hashes.front());
+    const auto last = (1u == hashes.size()) ? first : height(hashes.back());
+    const auto sequential = first.has_value() && last.has_value() &&
+                            previous.has_value() &&
+                            (first.value() == previous.value() + 1);
+    auto output = sequential ? get_best_(last.value() + 1, count_)
+                             : BlockHashes{};
+    auto lock = Lock{lock_};
+    last_ = first.has_value() ? last : std::nullopt;
+    expected_height_ = sequential ? last.value() + 1 : block::Height{0};
+    expected_ = output;
+
+    return output;
+}
+}  // namespace opentxs::blockchain::node::blockoracle
@@ -0,0 +1,55 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/node/BlockOracle.hpp"
+
+namespace opentxs::blockchain::node::blockoracle
+{
+// Detects consecutive block requests which walk the best chain in order
+class OPENTXS_EXPORT Sequence
+{
+public:
+    using BlockHashes = node::BlockOracle::BlockHashes;
+    using GetHeight =
+        std::function<std::optional<block::Height>(const block::Hash&)>;
+    using GetBest =
+        std::function<BlockHashes(const block::Height, const std::size_t)>;
+
+    // Returns the blocks which should be prefetched. The result is empty
+    // unless hashes continues the previous request.
+    auto Check(const BlockHashes& hashes) noexcept -> BlockHashes;
+
+    Sequence(
+        GetHeight&& height,
+        GetBest&& best,
+        const std::size_t count) noexcept;
+
+private:
+    const GetHeight get_height_;
+    const GetBest get_best_;
+    const std::size_t count_;
+    mutable std::mutex lock_;
+    std::optional<block::Height> last_;
+    // NOTE the heights of the blocks returned by the previous call to Check
+    // are already known, so a request for them requires no header lookup
+    block::Height expected_height_;
+    BlockHashes expected_;
+
+    Sequence() = delete;
+    Sequence(const Sequence&) = delete;
+    Sequence(Sequence&&) = delete;
+    auto operator=(const Sequence&) -> Sequence& = delete;
+    auto operator=(Sequence&&) -> Sequence& = delete;
+};
+}  // namespace opentxs::blockchain::node::blockoracle
@@ -11,7 +11,9 @@
 #include <exception>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <thread>
+#include <tuple>
 #include <vector>
 
 #include "blockchain/DownloadManager.hpp"
@@ -23,6 +25,7 @@
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/ThreadPool.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
 #include "opentxs/core/Flag.hpp"
@@ -31,7 +34,6 @@
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "util/JobCounter.hpp"
 #include "util/ScopeGuard.hpp"
 
@@ -51,8 +53,7 @@ FilterOracle::BlockIndexer::BlockIndexer(
     const blockchain::Type chain,
     const filter::Type type,
     const std::string& shutdown,
-    const NotifyCallback& notify,
-    zmq::socket::Push& threadPool) noexcept
+    const NotifyCallback& notify) noexcept
     : BlockDM(
           [&] { return db.FilterTip(type); }(),
           [&] {
@@ -74,7 +75,6 @@ FilterOracle::BlockIndexer::BlockIndexer(
     , chain_(chain)
     , type_(type)
     , notify_(notify)
-    , thread_pool_(threadPool)
     , job_counter_()
 {
     init_executor(
@@ -99,6 +99,53 @@ auto FilterOracle::BlockIndexer::batch_size(const std::size_t in) const noexcept
     }
 }
 
+auto FilterOracle::BlockIndexer::calculate_cfheaders(
+    std::vector<BlockIndexerData>& cache) const noexcept -> void
+{
+    // NOTE each cfheader commits to the previous one so this step must be
+    // performed in order after the cfilters have been calculated
+    for (auto& job : cache) {
+        const auto& task = job.incoming_data_;
+        const auto height = task.position_.first;
+
+        try {
+            if (job.error_) { std::rethrow_exception(job.error_); }
+
+            const auto& previous = task.previous_;
+            constexpr auto limit = std::chrono::minutes{1};
+            using State = std::future_status;
+
+            if (auto status = previous.wait_for(limit);
+                State::ready != status) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Timeout waiting for previous ")(DisplayString(chain_))(
+                    " cfheader #")(height - 1)
+                    .Flush();
+
+                throw std::runtime_error("timeout");
+            }
+
+            const auto& gcs = *job.filter_data_.second;
+            auto& filterHeader = std::get<1>(job.header_data_);
+            filterHeader = gcs.Header(previous.get()->Bytes());
+
+            if (filterHeader->empty()) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": failed to calculate ")(
+                    DisplayString(chain_))(" cfheader #")(height)
+                    .Flush();
+
+                throw std::runtime_error("Failed to calculate cfheader");
+            }
+
+            task.process(filter::pHeader{filterHeader});
+        } catch (...) {
+            // NOTE the exception propagates to every subsequent job through
+            // its previous_ future
+            task.process(std::current_exception());
+        }
+    }
+}
+
 auto FilterOracle::BlockIndexer::download() noexcept -> void
 {
     auto work = NextBatch();
@@ -252,21 +299,22 @@ auto FilterOracle::BlockIndexer::queue_processing(
 {
     if (0u == data.size()) { return; }
 
+    const auto start = Clock::now();
+    const auto count{data.size()};
     auto filters = std::vector<internal::FilterDatabase::Filter>{};
     auto headers = std::vector<internal::FilterDatabase::Header>{};
     auto cache = std::vector<BlockIndexerData>{};
     const auto& tip = data.back();
     const auto cores = std::thread::hardware_concurrency();
+    filters.reserve(count);
+    headers.reserve(count);
+    cache.reserve(count);
 
     {
+        // NOTE cfilters for every block in the batch are calculated in
+        // parallel. The destructor of jobCounter blocks until all of them
+        // are finished.
         auto jobCounter = job_counter_.Allocate();
-        const auto count{data.size()};
-
-        if (0 == data.size()) { return; }
-
-        filters.reserve(count);
-        headers.reserve(count);
-        cache.reserve(count);
         static const auto blank = api_.Factory().Data();
         static const auto blankView = ReadView{};
 
@@ -281,11 +329,14 @@ auto FilterOracle::BlockIndexer::queue_processing(
             if (2 < cores) {
                 send_to_thread_pool(job);
             } else {
+                ++jobCounter;
                 parent_.ProcessBlock(job);
             }
         }
     }
 
+    calculate_cfheaders(cache);
+
     try {
         tip->output_.get();
         const auto stored =
@@ -298,7 +349,18 @@ auto FilterOracle::BlockIndexer::queue_processing(
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
         for (auto& task : data) { task->process(std::current_exception()); }
+
+        return;
     }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - start);
+    const auto ms = static_cast<std::size_t>(elapsed.count());
+    LogDetail(DisplayString(chain_))(" cfilter indexer processed ")(count)(
+        " blocks up to height ")(tip->position_.first)(" in ")(ms)(
+        " milliseconds (")((0u < ms) ? ((count * 1000u) / ms) : count)(
+        " blocks per second)")
+        .Flush();
 }
 
 auto FilterOracle::BlockIndexer::reset_to_genesis() noexcept -> void
@@ -326,20 +388,17 @@ auto FilterOracle::BlockIndexer::send_to_thread_pool(
     BlockIndexerData& job) noexcept -> void
 {
     auto& jobCounter = job.job_counter_;
-
-    while (running_.get() && jobCounter.limited()) {
-        Sleep(std::chrono::microseconds(1));
-    }
-
-    if (false == running_.get()) { return; }
-
     using Pool = api::internal::ThreadPool;
-    auto work = Pool::MakeWork(
-        api_.Network().ZeroMQ(), value(Pool::Work::CalculateBlockFilters));
-    work->AddFrame(reinterpret_cast<std::uintptr_t>(&parent_));
-    work->AddFrame(reinterpret_cast<std::uintptr_t>(&job));
-    thread_pool_.Send(work);
     ++jobCounter;
+    const auto queued = api_.ThreadPool().Submit(
+        value(Pool::Work::CalculateBlockFilters),
+        [&parent = parent_, &job] { parent.ProcessBlock(job); });
+
+    if (false == queued) {
+        --jobCounter;
+        job.error_ = std::make_exception_ptr(
+            std::runtime_error{"Failed to queue cfilter job"});
+    }
 }
 
 auto FilterOracle::BlockIndexer::update_tip(
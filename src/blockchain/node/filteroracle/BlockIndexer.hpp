@@ -6,12 +6,14 @@
 #pragma once
 
 #include <cstddef>
+#include <exception>
 #include <functional>
 #include <future>
 #include <iosfwd>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "blockchain/DownloadManager.hpp"
 #include "blockchain/node/FilterOracle.hpp"
@@ -58,11 +60,6 @@ namespace network
 {
 namespace zeromq
 {
-namespace socket
-{
-class Push;
-}  // namespace socket
-
 class Message;
 }  // namespace zeromq
 }  // namespace network
@@ -92,8 +89,7 @@ public:
         const blockchain::Type chain,
         const filter::Type type,
         const std::string& shutdown,
-        const NotifyCallback& notify,
-        zmq::socket::Push& threadPool) noexcept;
+        const NotifyCallback& notify) noexcept;
 
     ~BlockIndexer();
 
@@ -109,11 +105,12 @@ private:
     const blockchain::Type chain_;
     const filter::Type type_;
     const NotifyCallback& notify_;
-    zmq::socket::Push& thread_pool_;
     JobCounter job_counter_;
 
     auto batch_ready() const noexcept -> void { trigger(); }
     auto batch_size(const std::size_t in) const noexcept -> std::size_t;
+    auto calculate_cfheaders(std::vector<BlockIndexerData>& cache)
+        const noexcept -> void;
     auto check_task(TaskType&) const noexcept -> void {}
     auto trigger_state_machine() const noexcept -> void { trigger(); }
     auto update_tip(const Position& position, const filter::pHeader&)
@@ -135,6 +132,7 @@ struct FilterOracle::BlockIndexerData {
     const Task& incoming_data_;
     const filter::Type type_;
     filter::pHash filter_hash_;
+    std::exception_ptr error_;
     internal::FilterDatabase::Filter& filter_data_;
     internal::FilterDatabase::Header& header_data_;
     Outstanding& job_counter_;
@@ -149,6 +147,7 @@ struct FilterOracle::BlockIndexerData {
         : incoming_data_(data)
         , type_(type)
         , filter_hash_(std::move(blank))
+        , error_()
         , filter_data_(filter)
         , header_data_(header)
         , job_counter_(jobCounter)
@@ -122,7 +122,7 @@ struct Account::Imp {
         const BalanceTree& ref,
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
-        const zmq::socket::Push& threadPool,
+        Scanner& scanner,
         const filter::Type filter,
         Outstanding&& jobs,
         const SimpleCallback& taskFinished) noexcept
@@ -132,7 +132,7 @@ struct Account::Imp {
         , node_(node)
         , db_(db)
         , filter_type_(node_.FilterOracleInternal().DefaultType())
-        , thread_pool_(threadPool)
+        , scanner_(scanner)
         , task_finished_(taskFinished)
         , internal_()
         , external_()
@@ -162,7 +162,7 @@ private:
     const node::internal::Network& node_;
     const node::internal::WalletDatabase& db_;
     const filter::Type filter_type_;
-    const network::zeromq::socket::Push& thread_pool_;
+    Scanner& scanner_;
     const SimpleCallback& task_finished_;
     Map internal_;
     Map external_;
@@ -196,7 +196,7 @@ private:
             account,
             task_finished_,
             jobs_,
-            thread_pool_,
+            scanner_,
             filter_type_,
             subchain);
 
@@ -212,7 +212,7 @@ Account::Account(
     const BalanceTree& ref,
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
-    const zmq::socket::Push& threadPool,
+    Scanner& scanner,
     const filter::Type filter,
     Outstanding&& jobs,
     const SimpleCallback& taskFinished) noexcept
@@ -222,7 +222,7 @@ Account::Account(
           ref,
           node,
           db,
-          threadPool,
+          scanner,
           filter,
           std::move(jobs),
           taskFinished))
@@ -56,22 +56,12 @@ struct WalletDatabase;
 
 namespace wallet
 {
+class Scanner;
 class SubchainStateData;
 }  // namespace wallet
 }  // namespace node
 }  // namespace blockchain
 
-namespace network
-{
-namespace zeromq
-{
-namespace socket
-{
-class Push;
-}  // namespace socket
-}  // namespace zeromq
-}  // namespace network
-
 class Outstanding;
 }  // namespace opentxs
 
@@ -94,7 +84,7 @@ public:
         const BalanceTree& ref,
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
-        const network::zeromq::socket::Push& threadPool,
+        Scanner& scanner,
         const filter::Type filter,
         Outstanding&& jobs,
         const SimpleCallback& taskFinished) noexcept;
@@ -13,6 +13,7 @@
 
 #include "blockchain/node/wallet/Account.hpp"
 #include "blockchain/node/wallet/NotificationStateData.hpp"
+#include "blockchain/node/wallet/Scanner.hpp"
 #include "blockchain/node/wallet/SubchainStateData.hpp"
 #include "internal/api/client/Client.hpp"
 #include "internal/blockchain/node/Node.hpp"
@@ -50,7 +51,7 @@ struct Accounts::Imp {
             crypto_.AccountInternal(nym, chain_),
             node_,
             db_,
-            thread_pool_,
+            scanner_,
             filter_type_,
             job_counter_.Allocate(),
             task_finished_);
@@ -103,6 +104,7 @@ struct Accounts::Imp {
     auto shutdown() noexcept -> void
     {
         gatekeeper_.shutdown();
+        scanner_.shutdown();
         payment_codes_.clear();
 
         for (auto& [id, account] : map_) { account.shutdown(); }
@@ -123,6 +125,8 @@ struct Accounts::Imp {
             output |= account.state_machine(enabled);
         }
 
+        output |= scanner_.state_machine();
+
         return output;
     }
 
@@ -130,18 +134,22 @@ struct Accounts::Imp {
         const api::client::internal::Blockchain& crypto,
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
-        const network::zeromq::socket::Push& socket,
         const Type chain,
         const SimpleCallback& taskFinished) noexcept
         : api_(api)
         , crypto_(crypto)
         , node_(node)
         , db_(db)
-        , thread_pool_(socket)
         , task_finished_(taskFinished)
         , chain_(chain)
         , filter_type_(node_.FilterOracleInternal().DefaultType())
         , job_counter_()
+        , scanner_(
+              api_,
+              node_,
+              chain_,
+              filter_type_,
+              job_counter_.Allocate())
         , map_()
         , pc_counter_(job_counter_.Allocate())
         , payment_codes_()
@@ -160,11 +168,11 @@ private:
     const api::client::internal::Blockchain& crypto_;
     const node::internal::Network& node_;
     const node::internal::WalletDatabase& db_;
-    const network::zeromq::socket::Push& thread_pool_;
     const SimpleCallback& task_finished_;
     const Type chain_;
     const filter::Type filter_type_;
     JobCounter job_counter_;
+    Scanner scanner_;
     AccountMap map_;
     Outstanding pc_counter_;
     PCMap payment_codes_;
@@ -194,7 +202,7 @@ private:
             db_,
             task_finished_,
             pc_counter_,
-            thread_pool_,
+            scanner_,
             filter_type_,
             chain_,
             id,
@@ -213,11 +221,9 @@ Accounts::Accounts(
     const api::client::internal::Blockchain& crypto,
     const node::internal::Network& node,
     const node::internal::WalletDatabase& db,
-    const network::zeromq::socket::Push& socket,
     const Type chain,
     const SimpleCallback& taskFinished) noexcept
-    : imp_(std::make_unique<
-           Imp>(api, crypto, node, db, socket, chain, taskFinished))
+    : imp_(std::make_unique<Imp>(api, crypto, node, db, chain, taskFinished))
 {
 }
 
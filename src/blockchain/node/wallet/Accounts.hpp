@@ -55,11 +55,6 @@ namespace network
 {
 namespace zeromq
 {
-namespace socket
-{
-class Push;
-}  // namespace socket
-
 class Frame;
 }  // namespace zeromq
 }  // namespace network
@@ -85,7 +80,6 @@ public:
         const api::client::internal::Blockchain& crypto,
         const node::internal::Network& node,
         const node::internal::WalletDatabase& db,
-        const network::zeromq::socket::Push& socket,
         const Type chain,
         const SimpleCallback& taskFinished) noexcept;
     ~Accounts();
@@ -56,7 +56,7 @@ DeterministicStateData::DeterministicStateData(
     const crypto::Deterministic& subaccount,
     const SimpleCallback& taskFinished,
     Outstanding& jobCounter,
-    const zmq::socket::Push& threadPool,
+    Scanner& scanner,
     const filter::Type filter,
     const Subchain subchain) noexcept
     : SubchainStateData(
@@ -68,7 +68,7 @@ DeterministicStateData::DeterministicStateData(
           OTIdentifier{subaccount.ID()},
           taskFinished,
           jobCounter,
-          threadPool,
+          scanner,
           filter,
           subchain)
     , subaccount_(subaccount)
@@ -67,19 +67,13 @@ namespace internal
 {
 struct Network;
 }  // namespace internal
-}  // namespace node
-}  // namespace blockchain
 
-namespace network
-{
-namespace zeromq
+namespace wallet
 {
-namespace socket
-{
-class Push;
-}  // namespace socket
-}  // namespace zeromq
-}  // namespace network
+class Scanner;
+}  // namespace wallet
+}  // namespace node
+}  // namespace blockchain
 
 class Outstanding;
 }  // namespace opentxs
@@ -101,7 +95,7 @@ public:
         const crypto::Deterministic& subaccount,
         const SimpleCallback& taskFinished,
         Outstanding& jobCounter,
-        const zmq::socket::Push& threadPool,
+        Scanner& scanner,
         const filter::Type filter,
         const Subchain subchain) noexcept;
 
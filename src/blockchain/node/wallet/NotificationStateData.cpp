@@ -55,7 +55,7 @@ NotificationStateData::NotificationStateData(
     const WalletDatabase& db,
     const SimpleCallback& taskFinished,
     Outstanding& jobCounter,
-    const zmq::socket::Push& threadPool,
+    Scanner& scanner,
     const filter::Type filter,
     const Type chain,
     const identifier::Nym& nym,
@@ -70,7 +70,7 @@ NotificationStateData::NotificationStateData(
           calculate_id(api, chain, code),
           taskFinished,
           jobCounter,
-          threadPool,
+          scanner,
           filter,
           Subchain::Notification)
     , path_(std::move(path))
@@ -0,0 +1,135 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                         // IWYU pragma: associated
+#include "1_Internal.hpp"                       // IWYU pragma: associated
+#include "blockchain/node/wallet/ScanPlan.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <utility>
+
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace opentxs::blockchain::node::wallet
+{
+ScanPlan::ScanPlan(
+    std::vector<Window>&& windows,
+    const std::size_t capacity) noexcept
+    : windows_(std::move(windows))
+    , heights_(0)
+    , segments_()
+{
+    auto sorted = std::vector<std::pair<block::Height, block::Height>>{};
+    auto boundaries = std::set<block::Height>{};
+
+    for (const auto& window : windows_) {
+        if (window.empty()) { continue; }
+
+        sorted.emplace_back(window.start_, window.stop_);
+        boundaries.emplace(window.start_);
+        boundaries.emplace(window.stop_ + 1);
+    }
+
+    // Merge overlapping windows so every height is scanned at most once
+    std::sort(sorted.begin(), sorted.end());
+    auto merged = std::vector<std::pair<block::Height, block::Height>>{};
+
+    for (const auto& [start, stop] : sorted) {
+        if (merged.empty() || ((merged.back().second + 1) < start)) {
+            merged.emplace_back(start, stop);
+        } else {
+            merged.back().second = std::max(merged.back().second, stop);
+        }
+    }
+
+    for (const auto& [start, stop] : merged) { heights_ += stop - start + 1; }
+
+    const auto threads =
+        static_cast<block::Height>(std::max(capacity, std::size_t{1}));
+    const auto size = std::max(min_range_, (heights_ + threads - 1) / threads);
+
+    for (const auto& [start, stop] : merged) {
+        for (auto i{start}; i <= stop;) {
+            auto last = std::min(i + size - 1, stop);
+
+            if (const auto next = boundaries.upper_bound(i);
+                (boundaries.end() != next) && (*next <= last)) {
+                last = *next - 1;
+            }
+
+            segments_.emplace_back(Segment{
+                i,
+                last,
+                std::nullopt,
+                0,
+                std::vector<Matches>(windows_.size())});
+            i = last + 1;
+        }
+    }
+}
+
+auto ScanPlan::Collect() noexcept -> std::vector<Result>
+{
+    auto output = std::vector<Result>(windows_.size());
+
+    for (auto i = std::size_t{0}; i < windows_.size(); ++i) {
+        const auto& window = windows_.at(i);
+        auto& [highest, matches] = output.at(i);
+
+        for (auto& segment : segments_) {
+            if ((segment.first_ < window.start_) ||
+                (segment.last_ > window.stop_)) {
+                continue;
+            }
+
+            // NOTE results are only usable up to the first gap in the scan
+            if (false == segment.highest_.has_value()) { break; }
+
+            highest = segment.highest_;
+            auto& from = segment.matches_.at(i);
+            std::move(from.begin(), from.end(), std::back_inserter(matches));
+
+            if (segment.highest_.value().first != segment.last_) { break; }
+        }
+    }
+
+    return output;
+}
+
+auto ScanPlan::Filters() const noexcept -> std::size_t
+{
+    auto output = std::size_t{0};
+
+    for (const auto& segment : segments_) { output += segment.filters_; }
+
+    return output;
+}
+
+auto ScanPlan::GetWindow(
+    const std::optional<block::Position>& last,
+    const block::Height best,
+    const block::Height tip) noexcept -> Window
+{
+    const auto start = std::min(
+        best, last.has_value() ? last.value().first + 1 : block::Height{0});
+
+    return Window{start, std::min(start + max_heights_ - 1, tip)};
+}
+
+auto ScanPlan::Segment::Record(
+    const block::Position& position,
+    const std::vector<bool>& matched) noexcept -> void
+{
+    ++filters_;
+    highest_ = position;
+
+    for (auto i = std::size_t{0}; i < matched.size(); ++i) {
+        if (matched.at(i)) { matches_.at(i).emplace_back(position.second); }
+    }
+}
+}  // namespace opentxs::blockchain::node::wallet
@@ -0,0 +1,89 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/Types.hpp"
+
+namespace opentxs::blockchain::node::wallet
+{
+// Bookkeeping for a scan of cfilters on behalf of several subchains, kept
+// apart from Scanner so it can be exercised without a node
+class OPENTXS_EXPORT ScanPlan
+{
+public:
+    using Matches = std::vector<block::pHash>;
+
+    // Heights scanned on behalf of one subchain
+    struct Window {
+        block::Height start_;
+        // NOTE less than start_ if the subchain has nothing to scan
+        block::Height stop_;
+
+        auto empty() const noexcept -> bool { return stop_ < start_; }
+    };
+
+    // Segments never straddle the first or last height of a window
+    struct Segment {
+        const block::Height first_;
+        const block::Height last_;
+        std::optional<block::Position> highest_;
+        std::size_t filters_;
+        // Indexed by window
+        std::vector<Matches> matches_;
+
+        auto Record(
+            const block::Position& position,
+            const std::vector<bool>& matched) noexcept -> void;
+    };
+
+    struct Result {
+        // Position to resume from on the next scan
+        std::optional<block::Position> highest_;
+        Matches matches_;
+    };
+
+    static constexpr auto max_heights_ = block::Height{10000};
+    static constexpr auto min_range_ = block::Height{100};
+
+    // Window of a subchain which has scanned up to and including last
+    static auto GetWindow(
+        const std::optional<block::Position>& last,
+        const block::Height best,
+        const block::Height tip) noexcept -> Window;
+
+    auto Collect() noexcept -> std::vector<Result>;
+    auto Filters() const noexcept -> std::size_t;
+    auto Heights() const noexcept -> block::Height { return heights_; }
+    auto Segments() noexcept -> std::vector<Segment>& { return segments_; }
+    auto Windows() const noexcept -> const std::vector<Window>&
+    {
+        return windows_;
+    }
+
+    // Divides the union of the windows into segments of roughly equal size
+    // so each of capacity threads receives a share
+    ScanPlan(
+        std::vector<Window>&& windows,
+        const std::size_t capacity) noexcept;
+    ScanPlan(ScanPlan&&) = default;
+
+private:
+    std::vector<Window> windows_;
+    block::Height heights_;
+    std::vector<Segment> segments_;
+
+    ScanPlan() = delete;
+    ScanPlan(const ScanPlan&) = delete;
+    auto operator=(const ScanPlan&) -> ScanPlan& = delete;
+    auto operator=(ScanPlan&&) -> ScanPlan& = delete;
+};
+}  // namespace opentxs::blockchain::node::wallet
@@ -0,0 +1,291 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                        // IWYU pragma: associated
+#include "1_Internal.hpp"                      // IWYU pragma: associated
+#include "blockchain/node/wallet/Scanner.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "blockchain/node/wallet/SubchainStateData.hpp"
+#include "internal/api/Api.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Core.hpp"
+#include "opentxs/api/ThreadPool.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+#include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"  // IWYU pragma: keep
+#include "util/ScopeGuard.hpp"
+
+#define OT_METHOD "opentxs::blockchain::node::wallet::Scanner::"
+
+namespace opentxs::blockchain::node::wallet
+{
+Scanner::Scanner(
+    const api::Core& api,
+    const node::internal::Network& node,
+    const Type chain,
+    const filter::Type filter,
+    Outstanding&& jobs) noexcept
+    : api_(api)
+    , node_(node)
+    , chain_(chain)
+    , filter_type_(filter)
+    , jobs_(std::move(jobs))
+    , lock_()
+    , queue_()
+    , running_(false)
+    , shutdown_(false)
+    , batch_()
+    , scan_jobs_()
+    , targets_()
+    , owners_()
+    , plan_()
+    , remaining_(0)
+    , start_()
+{
+}
+
+auto Scanner::finish() noexcept -> void
+{
+    OT_ASSERT(plan_.has_value());
+
+    const auto filters = plan_->Filters();
+    auto results = plan_->Collect();
+    auto windows = plan_->Windows();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - start_);
+    const auto ms = static_cast<std::size_t>(elapsed.count());
+    LogDetail(DisplayString(chain_))(" wallet scanned ")(filters)(
+        " filters for ")(scan_jobs_.size())(" subchains in ")(ms)(
+        " milliseconds (")((0u < ms) ? ((filters * 1000u) / ms) : filters)(
+        " filters per second)")
+        .Flush();
+    auto jobs = std::move(scan_jobs_);
+    reset();
+    running_.store(false);
+
+    // NOTE subchains may be destroyed as soon as they are notified, and
+    // another batch may start immediately afterwards
+    for (auto i = std::size_t{0}; i < jobs.size(); ++i) {
+        auto& [highest, matches] = results.at(i);
+        jobs.at(i).subchain_->finish_scan(
+            windows.at(i).start_, highest, std::move(matches), elapsed);
+    }
+}
+
+auto Scanner::prepare() noexcept -> void
+{
+    const auto& headers = node_.HeaderOracleInternal();
+    const auto& filters = node_.FilterOracleInternal();
+    const auto best = headers.BestChain();
+    const auto tip =
+        std::min(best.first, filters.FilterTip(filter_type_).first);
+    auto windows = std::vector<ScanPlan::Window>{};
+    windows.reserve(batch_.size());
+    scan_jobs_.reserve(batch_.size());
+
+    for (auto* subchain : batch_) {
+        OT_ASSERT(nullptr != subchain);
+
+        windows.emplace_back(
+            ScanPlan::GetWindow(subchain->last_scanned_, best.first, tip));
+        scan_jobs_.emplace_back(Job{subchain, subchain->get_account_targets()});
+    }
+
+    batch_.clear();
+
+    for (auto i = std::size_t{0}; i < scan_jobs_.size(); ++i) {
+        const auto& targets = std::get<2>(scan_jobs_.at(i).targets_);
+        std::copy(
+            targets.begin(), targets.end(), std::back_inserter(targets_));
+        owners_.insert(owners_.end(), targets.size(), i);
+    }
+
+    plan_.emplace(std::move(windows), api::ThreadPool::Capacity());
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(DisplayString(chain_))(
+        " scanning ")(plan_->Heights())(" filters for ")(scan_jobs_.size())(
+        " subchains using ")(plan_->Segments().size())(" segments")
+        .Flush();
+}
+
+auto Scanner::Queue(SubchainStateData& subchain) noexcept -> void
+{
+    auto lock = Lock{lock_};
+    queue_.emplace_back(&subchain);
+}
+
+auto Scanner::queue_work(const std::optional<std::size_t> range) noexcept
+    -> bool
+{
+    using Pool = api::internal::ThreadPool;
+    ++jobs_;
+    const auto queued = api_.ThreadPool().Submit(
+        value(Pool::Work::BlockchainWallet), [this, range] {
+            if (range.has_value()) {
+                scan_range(range.value());
+            } else {
+                scan();
+            }
+        });
+
+    if (queued) { return true; }
+
+    --jobs_;
+    LogDebug(OT_METHOD)(__FUNCTION__)(": ")(DisplayString(chain_))(
+        " failed to queue scan job")
+        .Flush();
+
+    return false;
+}
+
+auto Scanner::reset() noexcept -> void
+{
+    batch_.clear();
+    scan_jobs_.clear();
+    targets_.clear();
+    owners_.clear();
+    plan_.reset();
+    remaining_.store(0);
+}
+
+auto Scanner::scan() noexcept -> void
+{
+    auto postcondition = ScopeGuard{[&] { --jobs_; }};
+    start_ = Clock::now();
+    prepare();
+    const auto count = plan_->Segments().size();
+    remaining_.store(count);
+
+    if (0u == count) {
+        finish();
+
+        return;
+    }
+
+    // NOTE plan_ must not be accessed after the last segment is queued
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        if (false == queue_work(i)) {
+            ++jobs_;
+            scan_range(i);
+        }
+    }
+}
+
+auto Scanner::scan_range(const std::size_t index) noexcept -> void
+{
+    auto postcondition = ScopeGuard{[&] {
+        if (0u == --remaining_) { finish(); }
+
+        --jobs_;
+    }};
+    auto& segment = plan_->Segments().at(index);
+    const auto& windows = plan_->Windows();
+    const auto& headers = node_.HeaderOracleInternal();
+    const auto& filters = node_.FilterOracleInternal();
+    auto candidates = std::vector<bool>(scan_jobs_.size());
+    auto matched = std::vector<bool>(scan_jobs_.size());
+
+    for (auto height{segment.first_}; height <= segment.last_; ++height) {
+        if (shutdown_.load()) { break; }
+
+        const auto blockHash = headers.BestHash(height);
+        const auto pFilter = filters.LoadFilterOrResetTip(
+            filter_type_, block::Position{height, blockHash});
+
+        if (false == bool(pFilter)) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(DisplayString(chain_))(
+                " filter at height ")(height)(" not found ")
+                .Flush();
+
+            break;
+        }
+
+        const auto& filter = *pFilter;
+        std::fill(candidates.begin(), candidates.end(), false);
+        std::fill(matched.begin(), matched.end(), false);
+
+        for (const auto& it : filter.Match(targets_)) {
+            // NOTE GCS::Match returns const_iterators to items in the input
+            // vector
+            const auto job = owners_.at(std::distance(targets_.cbegin(), it));
+            const auto& window = windows.at(job);
+
+            if ((window.start_ <= height) && (height <= window.stop_)) {
+                candidates.at(job) = true;
+            }
+        }
+
+        for (auto i = std::size_t{0}; i < candidates.size(); ++i) {
+            if (false == candidates.at(i)) { continue; }
+
+            auto& job = scan_jobs_.at(i);
+            const auto& utxos = std::get<1>(job.targets_);
+            const auto [untested, retest] =
+                job.subchain_->get_block_targets(blockHash, utxos);
+            matched.at(i) = (0u < filter.Match(retest).size());
+        }
+
+        segment.Record(block::Position{height, blockHash}, matched);
+    }
+}
+
+auto Scanner::shutdown() noexcept -> void
+{
+    if (shutdown_.exchange(true)) { return; }
+
+    auto queued = [&] {
+        auto lock = Lock{lock_};
+        auto out = std::vector<SubchainStateData*>{};
+        out.swap(queue_);
+
+        return out;
+    }();
+
+    for (auto* subchain : queued) {
+        subchain->finish_scan(
+            0, std::nullopt, {}, std::chrono::milliseconds{0});
+    }
+}
+
+auto Scanner::state_machine() noexcept -> bool
+{
+    if (shutdown_.load() || running_.load()) { return false; }
+
+    {
+        auto lock = Lock{lock_};
+
+        if (queue_.empty()) { return false; }
+
+        running_.store(true);
+        batch_.swap(queue_);
+    }
+
+    if (queue_work(std::nullopt)) { return false; }
+
+    {
+        auto lock = Lock{lock_};
+        queue_.insert(queue_.end(), batch_.begin(), batch_.end());
+        batch_.clear();
+    }
+
+    running_.store(false);
+
+    return true;
+}
+
+Scanner::~Scanner()
+{
+    shutdown();
+
+    while (0 < jobs_) { Sleep(std::chrono::microseconds(100)); }
+}
+}  // namespace opentxs::blockchain::node::wallet
@@ -0,0 +1,122 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "blockchain/node/wallet/ScanPlan.hpp"
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/node/FilterOracle.hpp"
+#include "util/JobCounter.hpp"
+
+namespace opentxs
+{
+namespace api
+{
+class Core;
+}  // namespace api
+
+namespace blockchain
+{
+namespace node
+{
+namespace internal
+{
+struct Network;
+}  // namespace internal
+
+namespace wallet
+{
+class SubchainStateData;
+}  // namespace wallet
+}  // namespace node
+}  // namespace blockchain
+}  // namespace opentxs
+
+namespace opentxs::blockchain::node::wallet
+{
+// Scans cfilters on behalf of every subchain of a chain. Each subchain has its
+// own window of heights starting after the last block it scanned. Each filter
+// in the union of those windows is loaded once and matched against the
+// targets of every subchain whose window contains it. The union is divided
+// into segments which are processed in parallel by the thread pool, and the
+// results are delivered back to each subchain once every segment has
+// finished.
+class Scanner
+{
+public:
+    // NOTE called by the thread pool
+    auto scan() noexcept -> void;
+    // NOTE called by the thread pool
+    auto scan_range(const std::size_t index) noexcept -> void;
+
+    auto Queue(SubchainStateData& subchain) noexcept -> void;
+    auto shutdown() noexcept -> void;
+    auto state_machine() noexcept -> bool;
+
+    Scanner(
+        const api::Core& api,
+        const node::internal::Network& node,
+        const Type chain,
+        const filter::Type filter,
+        Outstanding&& jobs) noexcept;
+
+    ~Scanner();
+
+private:
+    using WalletDatabase = node::internal::WalletDatabase;
+    using Patterns = WalletDatabase::Patterns;
+    using UTXOs = std::vector<WalletDatabase::UTXO>;
+    using Targets = node::GCS::Targets;
+
+    struct Job {
+        SubchainStateData* subchain_;
+        std::tuple<Patterns, UTXOs, Targets> targets_;
+    };
+
+    const api::Core& api_;
+    const node::internal::Network& node_;
+    const Type chain_;
+    const filter::Type filter_type_;
+    Outstanding jobs_;
+    mutable std::mutex lock_;
+    std::vector<SubchainStateData*> queue_;
+    std::atomic<bool> running_;
+    std::atomic<bool> shutdown_;
+    // NOTE the members below are only accessed while running_ is true
+    std::vector<SubchainStateData*> batch_;
+    std::vector<Job> scan_jobs_;
+    // Union of every job's targets, and the job which owns each target
+    Targets targets_;
+    std::vector<std::size_t> owners_;
+    // Windows are indexed the same as scan_jobs_
+    std::optional<ScanPlan> plan_;
+    std::atomic<std::size_t> remaining_;
+    Time start_;
+
+    auto finish() noexcept -> void;
+    auto prepare() noexcept -> void;
+    auto queue_work(const std::optional<std::size_t> range) noexcept -> bool;
+    auto reset() noexcept -> void;
+
+    Scanner() = delete;
+    Scanner(const Scanner&) = delete;
+    Scanner(Scanner&&) = delete;
+    auto operator=(const Scanner&) -> Scanner& = delete;
+    auto operator=(Scanner&&) -> Scanner& = delete;
+};
+}  // namespace opentxs::blockchain::node::wallet
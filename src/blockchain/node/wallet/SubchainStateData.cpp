@@ -15,6 +15,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "blockchain/node/wallet/Scanner.hpp"
 #include "blockchain/node/wallet/ScriptForm.hpp"
 #include "internal/api/Api.hpp"
 #include "internal/api/client/Client.hpp"
@@ -24,7 +25,7 @@
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
-#include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/ThreadPool.hpp"
 #include "opentxs/blockchain/FilterType.hpp"
 #include "opentxs/blockchain/block/Header.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
@@ -36,7 +37,6 @@
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"  // IWYU pragma: keep
 #include "opentxs/protobuf/BlockchainWalletKey.pb.h"
 #include "util/JobCounter.hpp"
@@ -58,18 +58,6 @@ auto Wallet::ProcessThreadPool(const zmq::Message& in) noexcept -> void
         OT_FAIL;
     }
 
-    auto* pData = reinterpret_cast<node::wallet::SubchainStateData*>(
-        body.at(1).as<std::uintptr_t>());
-
-    OT_ASSERT(nullptr != pData);
-
-    auto& data = *pData;
-    auto postcondition = ScopeGuard{[&] {
-        data.running_.store(false);
-        data.task_finished_();
-        --data.job_counter_;
-    }};
-
     const auto task = [&] {
         try {
 
@@ -80,23 +68,12 @@ auto Wallet::ProcessThreadPool(const zmq::Message& in) noexcept -> void
         }
     }();
 
-    switch (task) {
-        case Task::index: {
-            data.index();
-        } break;
-        case Task::scan: {
-            data.scan();
-        } break;
-        case Task::process: {
-            data.process();
-        } break;
-        case Task::reorg: {
-            data.reorg();
-        } break;
-        default: {
-            OT_FAIL;
-        }
-    }
+    auto* pData = reinterpret_cast<node::wallet::SubchainStateData*>(
+        body.at(1).as<std::uintptr_t>());
+
+    OT_ASSERT(nullptr != pData);
+
+    pData->process_task(task);
 }
 }  // namespace opentxs::blockchain::node::internal
 
@@ -111,7 +88,7 @@ SubchainStateData::SubchainStateData(
     OTIdentifier&& id,
     const SimpleCallback& taskFinished,
     Outstanding& jobCounter,
-    const zmq::socket::Push& threadPool,
+    Scanner& scanner,
     const filter::Type filter,
     const Subchain subchain) noexcept
     : owner_(std::move(owner))
@@ -135,7 +112,7 @@ SubchainStateData::SubchainStateData(
     , db_(db)
     , name_()
     , null_position_(make_blank<block::Position>::value(api_))
-    , thread_pool_(threadPool)
+    , scanner_(scanner)
     , last_reported_(null_position_)
 {
     OT_ASSERT(task_finished_);
@@ -322,9 +299,7 @@ auto SubchainStateData::check_scan() noexcept -> bool
     }
 
     if (needScan) {
-        static constexpr auto job{"scan"};
-
-        return queue_work(Task::scan, job);
+        return queue_scan();
     } else {
         report_scan();
     }
@@ -366,6 +341,36 @@ auto SubchainStateData::describe() const noexcept -> std::string
     return out.str();
 }
 
+auto SubchainStateData::finish_scan(
+    const block::Height start,
+    const std::optional<block::Position>& highest,
+    std::vector<block::pHash>&& matches,
+    const std::chrono::milliseconds elapsed) noexcept -> void
+{
+    auto postcondition = ScopeGuard{[&] {
+        running_.store(false);
+        task_finished_();
+        --job_counter_;
+    }};
+
+    if (highest.has_value() && (highest.value().first >= start)) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(" found ")(
+            matches.size())(" potential matches between blocks ")(start)(
+            " and ")(highest.value().first)(" in ")(elapsed.count())(
+            " milliseconds")
+            .Flush();
+        std::move(
+            matches.begin(),
+            matches.end(),
+            std::back_inserter(blocks_to_request_));
+        last_scanned_ = highest.value();
+    } else {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(
+            " scan interrupted due to missing filter")
+            .Flush();
+    }
+}
+
 auto SubchainStateData::get_account_targets() const noexcept
     -> std::tuple<Patterns, UTXOs, Targets>
 {
@@ -553,6 +558,31 @@ auto SubchainStateData::process() noexcept -> void
     }
 }
 
+auto SubchainStateData::process_task(
+    const node::internal::Wallet::Task task) noexcept -> void
+{
+    auto postcondition = ScopeGuard{[&] {
+        running_.store(false);
+        task_finished_();
+        --job_counter_;
+    }};
+
+    switch (task) {
+        case Task::index: {
+            index();
+        } break;
+        case Task::process: {
+            process();
+        } break;
+        case Task::reorg: {
+            reorg();
+        } break;
+        default: {
+            OT_FAIL;
+        }
+    }
+}
+
 auto SubchainStateData::queue_work(const Task task, const char* log) noexcept
     -> bool
 {
@@ -566,27 +596,36 @@ auto SubchainStateData::queue_work(const Task task, const char* log) noexcept
     }
 
     using Pool = api::internal::ThreadPool;
-    auto work = Pool::MakeWork(
-        api_.Network().ZeroMQ(), value(Pool::Work::BlockchainWallet));
-    work->AddFrame(task);
-    work->AddFrame(reinterpret_cast<std::uintptr_t>(this));
     running_.store(true);
+    ++job_counter_;
+    const auto queued = api_.ThreadPool().Submit(
+        value(Pool::Work::BlockchainWallet),
+        [this, task] { process_task(task); });
 
-    if (thread_pool_.Send(work)) {
+    if (queued) {
         LogDebug(OT_METHOD)(__FUNCTION__)(": ")(name_)(" ")(log)(" job queued")
             .Flush();
-        ++job_counter_;
     } else {
         LogDebug(OT_METHOD)(__FUNCTION__)(": ")(name_)(" failed to queue ")(
             log)(" job")
             .Flush();
-
+        --job_counter_;
         running_.store(false);
     }
 
     return running_.load();
 }
 
+auto SubchainStateData::queue_scan() noexcept -> bool
+{
+    running_.store(true);
+    ++job_counter_;
+    scanner_.Queue(*this);
+    LogDebug(OT_METHOD)(__FUNCTION__)(": ")(name_)(" scan job queued").Flush();
+
+    return true;
+}
+
 auto SubchainStateData::reorg() noexcept -> void
 {
     while (false == reorg_.Empty()) {
@@ -624,88 +663,6 @@ auto SubchainStateData::report_scan() noexcept -> void
     }
 }
 
-auto SubchainStateData::scan() noexcept -> void
-{
-    const auto start = Clock::now();
-    const auto& headers = node_.HeaderOracleInternal();
-    const auto& filters = node_.FilterOracleInternal();
-    const auto best = headers.BestChain();
-    const auto startHeight = std::min(
-        best.first,
-        last_scanned_.has_value() ? last_scanned_.value().first + 1 : 0);
-    const auto first =
-        last_scanned_.has_value()
-            ? block::Position{startHeight, headers.BestHash(startHeight)}
-            : block::Position{0, headers.BestHash(0)};
-    const auto stopHeight = std::min(
-        std::min(startHeight + 9999, best.first),
-        filters.FilterTip(filter_type_).first);
-    LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(" scanning filters from ")(
-        startHeight)(" to ")(stopHeight)
-        .Flush();
-    const auto [elements, utxos, patterns] = get_account_targets();
-    auto highestTested = last_scanned_.value_or(null_position_);
-    auto atLeastOnce{false};
-    auto blockHash = api_.Factory().Data();
-    auto cache = decltype(blocks_to_request_){};
-
-    for (auto i{startHeight}; i <= stopHeight; ++i) {
-        blockHash = headers.BestHash(i);
-        const auto pFilter = filters.LoadFilterOrResetTip(
-            filter_type_, block::Position{i, blockHash});
-
-        if (false == bool(pFilter)) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(
-                " filter at height ")(i)(" not found ")
-                .Flush();
-
-            break;
-        }
-
-        atLeastOnce = true;
-        highestTested.first = i;
-        highestTested.second = blockHash;
-        const auto& filter = *pFilter;
-        auto matches = filter.Match(patterns);
-        const auto size{matches.size()};
-
-        if (0 < matches.size()) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(" GCS for block ")(
-                blockHash->asHex())(" at height ")(i)(
-                " matches at least one of the ")(patterns.size())(
-                " target elements for ")(id_)
-                .Flush();
-            const auto [untested, retest] = get_block_targets(blockHash, utxos);
-            matches = filter.Match(retest);
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(" ")(
-                matches.size())(" of ")(size)(" matches are new")
-                .Flush();
-
-            if (0 < matches.size()) {
-                cache.emplace_back(std::move(blockHash));
-            }
-        }
-    }
-
-    if (atLeastOnce) {
-        const auto count = cache.size();
-        LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(" found ")(count)(
-            " potential matches between blocks ")(startHeight)(" and ")(
-            highestTested.first)(" in ")(
-            std::chrono::duration_cast<std::chrono::milliseconds>(
-                Clock::now() - start)
-                .count())(" milliseconds")
-            .Flush();
-        std::move(
-            cache.begin(), cache.end(), std::back_inserter(blocks_to_request_));
-        last_scanned_ = std::move(highestTested);
-    } else {
-        LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(name_)(
-            " scan interrupted due to missing filter")
-            .Flush();
-    }
-}
-
 auto SubchainStateData::set_key_data(
     block::bitcoin::Transaction& tx) const noexcept -> void
 {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -74,22 +75,12 @@ struct WalletDatabase;
 
 namespace wallet
 {
+class Scanner;
 class ScriptForm;
 }  // namespace wallet
 }  // namespace node
 }  // namespace blockchain
 
-namespace network
-{
-namespace zeromq
-{
-namespace socket
-{
-class Push;
-}  // namespace socket
-}  // namespace zeromq
-}  // namespace network
-
 class Outstanding;
 }  // namespace opentxs
 
@@ -104,6 +95,9 @@ public:
         std::map<block::pHash, BlockOracle::BitcoinBlockFuture>;
     using ProcessQueue = std::queue<OutstandingMap::iterator>;
     using SubchainIndex = WalletDatabase::pSubchainIndex;
+    using Patterns = WalletDatabase::Patterns;
+    using UTXOs = std::vector<WalletDatabase::UTXO>;
+    using Targets = node::GCS::Targets;
 
     struct MempoolQueue {
         auto Empty() const noexcept -> bool;
@@ -146,10 +140,23 @@ public:
     OutstandingMap outstanding_blocks_;
     ProcessQueue process_block_queue_;
 
+    auto get_account_targets() const noexcept
+        -> std::tuple<Patterns, UTXOs, Targets>;
+    auto get_block_targets(const block::Hash& id, const UTXOs& utxos)
+        const noexcept -> std::pair<Patterns, Targets>;
+
+    // NOTE called by Scanner when a queued scan is complete
+    auto finish_scan(
+        const block::Height start,
+        const std::optional<block::Position>& highest,
+        std::vector<block::pHash>&& matches,
+        const std::chrono::milliseconds elapsed) noexcept -> void;
     virtual auto index() noexcept -> void = 0;
     virtual auto process() noexcept -> void;
+    // NOTE called by the thread pool
+    auto process_task(const node::internal::Wallet::Task task) noexcept
+        -> void;
     virtual auto reorg() noexcept -> void;
-    virtual auto scan() noexcept -> void;
 
     auto state_machine(bool enabled) noexcept -> bool;
 
@@ -157,9 +164,6 @@ public:
 
 protected:
     using Task = node::internal::Wallet::Task;
-    using Patterns = WalletDatabase::Patterns;
-    using UTXOs = std::vector<WalletDatabase::UTXO>;
-    using Targets = node::GCS::Targets;
     using Tested = WalletDatabase::MatchingIndices;
 
     const api::Core& api_;
@@ -170,10 +174,6 @@ protected:
     const block::Position null_position_;
 
     auto describe() const noexcept -> std::string;
-    auto get_account_targets() const noexcept
-        -> std::tuple<Patterns, UTXOs, Targets>;
-    auto get_block_targets(const block::Hash& id, const UTXOs& utxos)
-        const noexcept -> std::pair<Patterns, Targets>;
     auto get_block_targets(const block::Hash& id, Tested& tested) const noexcept
         -> std::tuple<Patterns, UTXOs, Targets, Patterns>;
     virtual auto type() const noexcept -> std::stringstream = 0;
@@ -202,12 +202,12 @@ protected:
         OTIdentifier&& id,
         const SimpleCallback& taskFinished,
         Outstanding& jobCounter,
-        const zmq::socket::Push& threadPool,
+        Scanner& scanner,
         const filter::Type filter,
         const Subchain subchain) noexcept;
 
 private:
-    const zmq::socket::Push& thread_pool_;
+    Scanner& scanner_;
     block::Position last_reported_;
 
     auto get_targets(
@@ -235,6 +235,7 @@ private:
         const block::Block::Matches& matches,
         std::unique_ptr<const block::bitcoin::Transaction> tx) noexcept
         -> void = 0;
+    auto queue_scan() noexcept -> bool;
     auto report_scan() noexcept -> void;
 
     SubchainStateData() = delete;
@@ -49,7 +49,6 @@
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
-#include "opentxs/network/zeromq/socket/Push.hpp"
 #include "opentxs/protobuf/BlockchainTransactionOutput.pb.h"
 #include "opentxs/protobuf/BlockchainTransactionProposal.pb.h"
 #include "opentxs/protobuf/Enums.pb.h"
@@ -149,6 +148,7 @@ private:
         block = value(WorkType::BlockchainNewHeader),
         reorg = value(WorkType::BlockchainReorg),
         mempool = value(WorkType::BlockchainMempoolUpdated),
+        mempoolstats = value(WorkType::BlockchainMempoolStats),
         key = OT_ZMQ_NEW_BLOCKCHAIN_WALLET_KEY_SIGNAL,
         filter = OT_ZMQ_NEW_FILTER_SIGNAL,
         statemachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
@@ -163,7 +163,6 @@ private:
     const Type chain_;
     const SimpleCallback task_finished_;
     std::atomic_bool enabled_;
-    OTZMQPushSocket thread_pool;
     wallet::Accounts accounts_;
     wallet::Proposals proposals_;
 
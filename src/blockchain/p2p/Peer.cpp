@@ -295,6 +295,9 @@ auto Peer::pipeline(zmq::Message& message) noexcept -> void
         case Task::Mempool: {
             process_mempool(message);
         } break;
+        case Task::MempoolStats: {
+            // NOTE published on the mempool endpoint but not used by peers
+        } break;
         case Task::Disconnect: {
             disconnect();
         } break;
@@ -371,6 +374,7 @@ auto Peer::process_state_machine() noexcept -> void
             check_activity();
             check_jobs();
             check_download_peers();
+            check_pending_requests();
         } break;
         default: {
         }
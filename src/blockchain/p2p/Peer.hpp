@@ -410,6 +410,7 @@ private:
     auto check_activity() noexcept -> void;
     auto check_download_peers() noexcept -> void;
     auto check_jobs() noexcept -> void;
+    virtual auto check_pending_requests() noexcept -> void = 0;
     auto connect() noexcept -> void;
     auto pipeline(zmq::Message& message) noexcept -> void;
     auto process_mempool(const zmq::Message& message) noexcept -> void;
@@ -0,0 +1,349 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                             // IWYU pragma: associated
+#include "1_Internal.hpp"                           // IWYU pragma: associated
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/buffers.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Core.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+
+namespace be = boost::endian;
+
+namespace opentxs::blockchain::p2p::bitcoin
+{
+using network::blockchain::bitcoin::CompactSize;
+using network::blockchain::bitcoin::DecodeSize;
+using ByteIterator = network::blockchain::bitcoin::ByteIterator;
+
+CompactBlock::CompactBlock(
+    const api::Core& api,
+    const blockchain::Type chain,
+    const std::uint64_t version,
+    const ReadView payload,
+    const node::internal::Mempool& mempool) noexcept(false)
+    : api_(api)
+    , chain_(chain)
+    , header_()
+    , hash_(Data::Factory())
+    , transactions_()
+    , from_mempool_(0)
+{
+    const auto size = payload.size();
+    auto nonce = be::little_uint64_buf_t{};
+    auto expected = header_bytes_ + sizeof(nonce);
+
+    if ((nullptr == payload.data()) || (expected > size)) {
+        throw std::runtime_error("Payload too short (header)");
+    }
+
+    auto it = reinterpret_cast<ByteIterator>(payload.data());
+    header_ = space(ReadView{payload.data(), header_bytes_});
+    std::advance(it, header_bytes_);
+    std::memcpy(static_cast<void*>(&nonce), it, sizeof(nonce));
+    std::advance(it, sizeof(nonce));
+
+    if (false ==
+        BlockHash(api_, chain_, reader(header_), hash_->WriteInto())) {
+        throw std::runtime_error("Failed to calculate block hash");
+    }
+
+    // NOTE BIP152: the siphash key is the first 16 bytes of
+    // SHA256(header || nonce)
+    const auto key = [&] {
+        auto preimage = header_;
+        const auto* n = reinterpret_cast<const std::byte*>(&nonce);
+        preimage.insert(preimage.end(), n, n + sizeof(nonce));
+        auto output = Space{};
+
+        if (false == api_.Crypto().Hash().Digest(
+                         opentxs::crypto::HashType::Sha256,
+                         reader(preimage),
+                         writer(output))) {
+            throw std::runtime_error("Failed to calculate short id key");
+        }
+
+        output.resize(16);
+
+        return output;
+    }();
+    auto shortCount = std::size_t{0};
+    expected += 1;
+
+    if ((expected > size) ||
+        (false == DecodeSize(it, expected, size, shortCount))) {
+        throw std::runtime_error("Failed to decode short id count");
+    }
+
+    if (shortCount > ((size - expected) / short_id_bytes_)) {
+        throw std::runtime_error("Payload too short (short ids)");
+    }
+
+    auto ids = std::vector<std::uint64_t>{};
+    ids.reserve(shortCount);
+
+    for (auto i = std::size_t{0}; i < shortCount; ++i) {
+        auto id = std::uint64_t{0};
+
+        for (auto j = std::size_t{0}; j < short_id_bytes_; ++j) {
+            id |= std::to_integer<std::uint64_t>(*it++) << (8u * j);
+        }
+
+        ids.emplace_back(id);
+    }
+
+    expected += shortCount * short_id_bytes_;
+    auto prefilledCount = std::size_t{0};
+    expected += 1;
+
+    if ((expected > size) ||
+        (false == DecodeSize(it, expected, size, prefilledCount))) {
+        throw std::runtime_error("Failed to decode prefilled count");
+    }
+
+    // NOTE every prefilled transaction occupies at least one byte
+    if (prefilledCount > (size - expected)) {
+        throw std::runtime_error("Payload too short (prefilled)");
+    }
+
+    const auto total = shortCount + prefilledCount;
+
+    if (0u == total) { throw std::runtime_error("Empty block"); }
+
+    transactions_.resize(total);
+    auto prefilled = std::vector<bool>(total, false);
+    auto index = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < prefilledCount; ++i) {
+        auto offset = std::size_t{0};
+        expected += 1;
+
+        if ((expected > size) ||
+            (false == DecodeSize(it, expected, size, offset))) {
+            throw std::runtime_error("Failed to decode prefilled index");
+        }
+
+        // NOTE indices are differentially encoded
+        if (0u == i) {
+            index = offset;
+        } else if (offset < (total - index - 1u)) {
+            index += offset + 1u;
+        } else {
+            throw std::runtime_error("Invalid prefilled index");
+        }
+
+        if (index >= total) {
+            throw std::runtime_error("Invalid prefilled index");
+        }
+
+        const auto tx = blockchain::bitcoin::EncodedTransaction::Deserialize(
+            api_,
+            chain_,
+            ReadView{reinterpret_cast<const char*>(it), size - expected});
+        const auto bytes = tx.size();
+        transactions_.at(index).assign(it, it + bytes);
+        prefilled.at(index) = true;
+        std::advance(it, bytes);
+        expected += bytes;
+    }
+
+    auto slots = std::map<std::uint64_t, std::size_t>{};
+
+    {
+        auto id = ids.cbegin();
+
+        for (auto i = std::size_t{0}; i < total; ++i) {
+            if (prefilled.at(i)) { continue; }
+
+            const auto [slot, added] = slots.emplace(*id++, i);
+
+            if (false == added) {
+                throw std::runtime_error("Short id collision");
+            }
+        }
+    }
+
+    const auto witness = (2u <= version);
+    auto ambiguous = std::set<std::size_t>{};
+
+    for (const auto& pTX : mempool.Transactions()) {
+        const auto& tx = *pTX;
+        const auto& txid = witness ? tx.WTXID() : tx.ID();
+        const auto id = ShortID(api_, reader(key), txid.Bytes());
+        const auto found = slots.find(id);
+
+        if (slots.end() == found) { continue; }
+
+        const auto position = found->second;
+
+        if (0u < ambiguous.count(position)) { continue; }
+
+        auto& slot = transactions_.at(position);
+
+        if (false == slot.empty()) {
+            // NOTE two mempool transactions produced the same short id so
+            // neither can be used
+            slot.clear();
+            ambiguous.emplace(position);
+            --from_mempool_;
+
+            continue;
+        }
+
+        if (tx.Serialize(writer(slot)).has_value()) {
+            ++from_mempool_;
+        } else {
+            slot.clear();
+        }
+    }
+}
+
+auto CompactBlock::BlockSize() const noexcept -> std::size_t
+{
+    auto output = header_.size() + CompactSize(transactions_.size()).Size();
+
+    for (const auto& tx : transactions_) { output += tx.size(); }
+
+    return output;
+}
+
+auto CompactBlock::Fill(const ReadView blocktxn) noexcept -> bool
+{
+    try {
+        const auto size = blocktxn.size();
+        auto expected = hash_->size();
+
+        if ((nullptr == blocktxn.data()) || (expected > size)) {
+            throw std::runtime_error("Payload too short (hash)");
+        }
+
+        auto it = reinterpret_cast<ByteIterator>(blocktxn.data());
+
+        if (0 != std::memcmp(it, hash_->data(), hash_->size())) {
+            throw std::runtime_error("Wrong block");
+        }
+
+        std::advance(it, hash_->size());
+        auto count = std::size_t{0};
+        expected += 1;
+
+        if ((expected > size) ||
+            (false == DecodeSize(it, expected, size, count))) {
+            throw std::runtime_error("Failed to decode transaction count");
+        }
+
+        const auto missing = Missing();
+
+        if (count != missing.size()) {
+            throw std::runtime_error("Wrong number of transactions");
+        }
+
+        auto received = std::vector<Space>{};
+        received.reserve(count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto tx =
+                blockchain::bitcoin::EncodedTransaction::Deserialize(
+                    api_,
+                    chain_,
+                    ReadView{
+                        reinterpret_cast<const char*>(it), size - expected});
+            const auto bytes = tx.size();
+            received.emplace_back(it, it + bytes);
+            std::advance(it, bytes);
+            expected += bytes;
+        }
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            transactions_.at(missing.at(i)) = std::move(received.at(i));
+        }
+
+        return true;
+    } catch (...) {
+
+        return false;
+    }
+}
+
+auto CompactBlock::IsComplete() const noexcept -> bool
+{
+    return std::none_of(
+        transactions_.begin(), transactions_.end(), [](const auto& tx) {
+            return tx.empty();
+        });
+}
+
+auto CompactBlock::Missing() const noexcept -> std::vector<std::size_t>
+{
+    auto output = std::vector<std::size_t>{};
+
+    for (auto i = std::size_t{0}; i < transactions_.size(); ++i) {
+        if (transactions_.at(i).empty()) { output.emplace_back(i); }
+    }
+
+    return output;
+}
+
+auto CompactBlock::Serialize(const AllocateOutput destination) const noexcept
+    -> bool
+{
+    if ((false == IsComplete()) || (!destination)) { return false; }
+
+    auto out = destination(BlockSize());
+
+    if (false == out.valid(BlockSize())) { return false; }
+
+    auto* it = static_cast<std::byte*>(out.data());
+    std::memcpy(it, header_.data(), header_.size());
+    std::advance(it, header_.size());
+    const auto count = CompactSize(transactions_.size()).Encode();
+    std::memcpy(it, count.data(), count.size());
+    std::advance(it, count.size());
+
+    for (const auto& tx : transactions_) {
+        std::memcpy(it, tx.data(), tx.size());
+        std::advance(it, tx.size());
+    }
+
+    return true;
+}
+
+auto CompactBlock::ShortID(
+    const api::Core& api,
+    const ReadView key,
+    const ReadView txid) noexcept -> std::uint64_t
+{
+    auto output = be::little_uint64_buf_t{};
+
+    if (false == api.Crypto().Hash().HMAC(
+                     opentxs::crypto::HashType::SipHash24,
+                     key,
+                     txid,
+                     preallocated(sizeof(output), &output))) {
+
+        return {};
+    }
+
+    return output.value() &
+           ((std::uint64_t{1} << (8u * short_id_bytes_)) - 1u);
+}
+}  // namespace opentxs::blockchain::p2p::bitcoin
@@ -0,0 +1,98 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace opentxs
+{
+namespace api
+{
+class Core;
+}  // namespace api
+
+namespace blockchain
+{
+namespace node
+{
+namespace internal
+{
+struct Mempool;
+}  // namespace internal
+}  // namespace node
+}  // namespace blockchain
+}  // namespace opentxs
+
+namespace opentxs::blockchain::p2p::bitcoin
+{
+// Decodes a BIP152 cmpctblock payload and rebuilds the full block from the
+// prefilled transactions and the contents of the mempool. Any transactions
+// which could not be located are reported by Missing() and must be supplied
+// via Fill() from the corresponding blocktxn payload.
+class OPENTXS_EXPORT CompactBlock
+{
+public:
+    static constexpr auto header_bytes_ = std::size_t{80};
+    static constexpr auto short_id_bytes_ = std::size_t{6};
+
+    // SipHash-2-4 of txid truncated to short_id_bytes_, where key is the
+    // first 16 bytes of SHA256(header || nonce)
+    static auto ShortID(
+        const api::Core& api,
+        const ReadView key,
+        const ReadView txid) noexcept -> std::uint64_t;
+
+    // Returns the size of the encoded block
+    auto BlockSize() const noexcept -> std::size_t;
+    auto FromMempool() const noexcept -> std::size_t { return from_mempool_; }
+    auto Hash() const noexcept -> const block::Hash& { return hash_; }
+    auto Header() const noexcept -> ReadView { return reader(header_); }
+    auto IsComplete() const noexcept -> bool;
+    // Absolute indices of transactions which are not yet known
+    auto Missing() const noexcept -> std::vector<std::size_t>;
+    auto Serialize(const AllocateOutput destination) const noexcept -> bool;
+    auto Transactions() const noexcept -> std::size_t
+    {
+        return transactions_.size();
+    }
+
+    // Accepts a blocktxn payload which answers the request for Missing()
+    auto Fill(const ReadView blocktxn) noexcept -> bool;
+
+    // Throws std::runtime_error if the payload is malformed or if the short
+    // transaction ids are ambiguous
+    CompactBlock(
+        const api::Core& api,
+        const blockchain::Type chain,
+        const std::uint64_t version,
+        const ReadView payload,
+        const node::internal::Mempool& mempool) noexcept(false);
+
+    ~CompactBlock() = default;
+
+private:
+    const api::Core& api_;
+    const blockchain::Type chain_;
+    Space header_;
+    OTData hash_;
+    std::vector<Space> transactions_;
+    std::size_t from_mempool_;
+
+    CompactBlock() = delete;
+    CompactBlock(const CompactBlock&) = delete;
+    CompactBlock(CompactBlock&&) = delete;
+    auto operator=(const CompactBlock&) -> CompactBlock& = delete;
+    auto operator=(CompactBlock&&) -> CompactBlock& = delete;
+};
+}  // namespace opentxs::blockchain::p2p::bitcoin
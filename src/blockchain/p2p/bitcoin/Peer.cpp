@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstdint>
 #include <iterator>
 #include <stdexcept>
 #include <tuple>
@@ -55,6 +57,7 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
 #include "opentxs/iterator/Bidirectional.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
@@ -196,6 +199,10 @@ Peer::Peer(
           get_local_services(protocol_, chain_, policy, localServices))
     , relay_(relay)
     , get_headers_()
+    , compact_version_(params::Data::Chains().at(chain_).segwit_ ? 2u : 1u)
+    , high_bandwidth_(false)
+    , pending_compact_()
+    , pending_blocktxn_()
 {
     init();
 }
@@ -295,6 +302,80 @@ auto Peer::broadcast_transaction(zmq::Message& in) noexcept -> void
     send(msg.Encode());
 }
 
+auto Peer::check_pending_requests() noexcept -> void
+{
+    static constexpr auto timeout = std::chrono::seconds{60};
+    const auto now = Clock::now();
+
+    for (auto i = pending_blocktxn_.begin(); i != pending_blocktxn_.end();) {
+        auto& [hash, pending] = *i;
+        const auto& future = pending.block_;
+        const auto ready = std::future_status::ready ==
+                           future.wait_for(std::chrono::milliseconds{0});
+
+        if (ready) {
+            const auto pBlock = future.get();
+
+            if (pBlock) { send_blocktxn(hash, pending.indices_, *pBlock); }
+
+            i = pending_blocktxn_.erase(i);
+        } else if ((now - pending.received_) > timeout) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": Block ")(hash->asHex())(
+                " not available")
+                .Flush();
+            i = pending_blocktxn_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+auto Peer::finish_compact_block(
+    const CompactBlock& compact,
+    const std::size_t bytes,
+    const bool withoutRoundTrip) noexcept -> void
+{
+    auto& stats = manager_.CompactBlocks();
+    auto block = Space{};
+
+    if (false == compact.Serialize(writer(block))) {
+        ++stats.failed_;
+        request_block(compact.Hash());
+
+        return;
+    }
+
+    {
+        // NOTE compact blocks are announced before the header is known. The
+        // block oracle ignores unsolicited blocks with an unknown header, so
+        // the header is submitted first.
+        using Task = node::internal::Network::Task;
+        auto work = MakeWork(Task::SubmitBlockHeader);
+        copy(compact.Header(), work->AppendBytes());
+        network_.Submit(work);
+    }
+
+    if (false == receive_block(reader(block))) {
+        // NOTE a short id matched the wrong transaction
+        ++stats.failed_;
+        request_block(compact.Hash());
+
+        return;
+    }
+
+    // NOTE only blocks which were accepted count towards the statistics
+    if (withoutRoundTrip) { ++stats.reconstructed_; }
+
+    stats.bytes_saved_ += static_cast<std::int64_t>(block.size()) -
+                          static_cast<std::int64_t>(bytes);
+    const auto received = stats.received_.load();
+    const auto reconstructed = stats.reconstructed_.load();
+    LogDetail(DisplayString(chain_))(" reconstructed ")(reconstructed)(
+        " of ")(received)(" compact blocks without a round trip, saving ")(
+        stats.bytes_saved_.load())(" bytes")
+        .Flush();
+}
+
 auto Peer::get_body_size(const zmq::Frame& header) const noexcept -> std::size_t
 {
     OT_ASSERT(HeaderType::Size() == header.size());
@@ -437,39 +518,7 @@ auto Peer::process_block(
     std::unique_ptr<HeaderType> header,
     const zmq::Frame& payload) -> void
 {
-    try {
-        if (0 == payload.size()) {
-            throw std::runtime_error("Invalid payload");
-        }
-
-        auto submit{true};
-        auto block = api_.Factory().BitcoinBlock(chain_, payload.Bytes());
-
-        if (!block) { throw std::runtime_error("Failed to instantiate block"); }
-
-        if (false == block_.Validate(*block)) {
-            throw std::runtime_error("Invalid block");
-        }
-
-        if (block_job_) {
-            auto header = headers_.LoadHeader(block->Header().Hash());
-
-            if (!header) { throw std::runtime_error("Failed to load header"); }
-
-            submit = !block_job_.Download(header->Position(), std::move(block));
-
-            if (block_job_.isDownloaded()) { reset_block_job(); }
-        }
-
-        if (submit) {
-            using Task = node::internal::Network::Task;
-            auto work = MakeWork(Task::SubmitBlock);
-            work->AddFrame(payload);
-            network_.Submit(work);
-        }
-    } catch (const std::exception& e) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
-    }
+    receive_block(payload.Bytes());
 }
 
 auto Peer::process_blocktxn(
@@ -491,7 +540,38 @@ auto Peer::process_blocktxn(
         return;
     }
 
-    // TODO
+    const auto& message = *pMessage;
+    const auto bytes = message.BlockTransactions();
+    const auto hash = api_.Factory().Data(ReadView{
+        static_cast<const char*>(bytes->data()),
+        std::min(bytes->size(), std::size_t{32})});
+    auto it = pending_compact_.find(hash);
+
+    if (pending_compact_.end() == it) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Unrequested block ")(
+            hash->asHex())
+            .Flush();
+
+        return;
+    }
+
+    auto pending = std::move(it->second);
+    pending_compact_.erase(it);
+    auto& stats = manager_.CompactBlocks();
+    auto& compact = *pending.block_;
+
+    if (false == compact.Fill(bytes->Bytes())) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid blocktxn for block ")(
+            hash->asHex())
+            .Flush();
+        ++stats.failed_;
+        request_block(compact.Hash());
+
+        return;
+    }
+
+    ++stats.round_trips_;
+    finish_compact_block(compact, pending.bytes_ + payload.size(), false);
 }
 
 auto Peer::process_cfcheckpt(
@@ -708,7 +788,92 @@ auto Peer::process_cmpctblock(
         return;
     }
 
-    // TODO
+    static constexpr auto timeout = std::chrono::seconds{60};
+    const auto now = Clock::now();
+
+    for (auto i = pending_compact_.begin(); i != pending_compact_.end();) {
+        if ((now - i->second.received_) > timeout) {
+            i = pending_compact_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+
+    auto& stats = manager_.CompactBlocks();
+    ++stats.received_;
+    auto pCompact = std::unique_ptr<CompactBlock>{};
+
+    try {
+        pCompact = std::make_unique<CompactBlock>(
+            api_, chain_, compact_version_, payload.Bytes(), mempool_);
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+        ++stats.failed_;
+
+        if (CompactBlock::header_bytes_ <= payload.size()) {
+            const auto hash = [&] {
+                auto out = api_.Factory().Data();
+                BlockHash(
+                    api_,
+                    chain_,
+                    ReadView{
+                        static_cast<const char*>(payload.data()),
+                        CompactBlock::header_bytes_},
+                    out->WriteInto());
+
+                return out;
+            }();
+
+            if (false == hash->empty()) { request_block(hash); }
+        }
+
+        return;
+    }
+
+    auto& compact = *pCompact;
+    stats.transactions_ += compact.Transactions();
+    stats.from_mempool_ += compact.FromMempool();
+
+    if (compact.IsComplete()) {
+        finish_compact_block(compact, payload.size(), true);
+
+        return;
+    }
+
+    const auto indices = [&] {
+        // NOTE getblocktxn indices are differentially encoded
+        auto out = compact.Missing();
+        auto previous = std::size_t{0};
+
+        for (auto i = std::size_t{0}; i < out.size(); ++i) {
+            const auto absolute = out.at(i);
+            out.at(i) = (0u == i) ? absolute : (absolute - previous - 1u);
+            previous = absolute;
+        }
+
+        return out;
+    }();
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Requesting ")(indices.size())(
+        " of ")(compact.Transactions())(" transactions for block ")(
+        compact.Hash().asHex())
+        .Flush();
+    auto pRequest = std::unique_ptr<Message>{factory::BitcoinP2PGetblocktxn(
+        api_, chain_, compact.Hash(), indices)};
+
+    if (false == bool(pRequest)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct getblocktxn")
+            .Flush();
+        ++stats.failed_;
+        request_block(compact.Hash());
+
+        return;
+    }
+
+    const auto& request = *pRequest;
+    send(request.Encode());
+    auto hash = api_.Factory().Data(compact.Hash().Bytes());
+    pending_compact_[std::move(hash)] =
+        PendingCompactBlock{std::move(pCompact), payload.size(), now};
 }
 
 auto Peer::process_feefilter(
@@ -852,7 +1017,34 @@ auto Peer::process_getblocktxn(
         return;
     }
 
-    // TODO
+    const auto& message = *pMessage;
+    const auto hash = message.getBlockHash();
+    auto future = network_.BlockOracle().LoadBitcoin(hash);
+
+    if (std::future_status::ready ==
+        future.wait_for(std::chrono::milliseconds{0})) {
+        const auto pBlock = future.get();
+
+        if (pBlock) { send_blocktxn(hash, message.getIndices(), *pBlock); }
+
+        return;
+    }
+
+    // NOTE the block is answered by check_pending_requests once it has been
+    // loaded
+    static constexpr auto limit = std::size_t{16};
+
+    if (limit <= pending_blocktxn_.size()) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(
+            ": Too many pending requests, ignoring request for block ")(
+            hash->asHex())
+            .Flush();
+
+        return;
+    }
+
+    pending_blocktxn_[hash] =
+        PendingBlocktxn{std::move(future), message.getIndices(), Clock::now()};
 }
 
 auto Peer::process_getcfcheckpt(
@@ -1575,7 +1767,12 @@ auto Peer::process_sendcmpct(
         return;
     }
 
-    // TODO
+    const auto& message = *pMessage;
+    // NOTE new blocks are always announced to this peer with inv
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Peer ")(address_.Display())(
+        " prefers compact block version ")(message.version())(" in ")(
+        message.announce() ? "high" : "low")(" bandwidth mode")
+        .Flush();
 }
 
 auto Peer::process_sendheaders(
@@ -1636,6 +1833,7 @@ auto Peer::process_verack(
     }
 
     state_.handshake_.first_action_ = true;
+    request_compact_blocks();
     check_handshake();
 }
 
@@ -1681,6 +1879,54 @@ auto Peer::process_version(
     check_handshake();
 }
 
+auto Peer::receive_block(const ReadView bytes) noexcept -> bool
+{
+    try {
+        if (0 == bytes.size()) { throw std::runtime_error("Invalid payload"); }
+
+        auto submit{true};
+        const auto start = Clock::now();
+        auto block = api_.Factory().BitcoinBlock(chain_, bytes);
+
+        if (!block) { throw std::runtime_error("Failed to instantiate block"); }
+
+        LogTrace(OT_METHOD)(__FUNCTION__)(": Parsed ")(bytes.size())(
+            " byte block in ")(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - start)
+                .count())(" microseconds")
+            .Flush();
+
+        if (false == block_.Validate(*block)) {
+            throw std::runtime_error("Invalid block");
+        }
+
+        if (block_job_) {
+            // NOTE a block with an unknown header can not be part of the job
+            auto header = headers_.LoadHeader(block->Header().Hash());
+
+            try {
+                if (header) {
+                    submit = !block_job_.Download(
+                        header->Position(), std::move(block));
+                }
+            } catch (const std::out_of_range&) {
+                // NOTE block is not part of the job
+            }
+
+            if (block_job_.isDownloaded()) { reset_block_job(); }
+        }
+
+        if (submit) { block_.SubmitBlock(std::move(block)); }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return false;
+    }
+}
+
 auto Peer::reconcile_mempool() noexcept -> void
 {
     const auto local = mempool_.Dump();
@@ -1743,6 +1989,26 @@ auto Peer::request_addresses() noexcept -> void
     send(message.Encode());
 }
 
+auto Peer::request_block(const block::Hash& hash) noexcept -> void
+{
+    using Inventory = blockchain::bitcoin::Inventory;
+    auto pMessage = std::unique_ptr<Message>{factory::BitcoinP2PGetdata(
+        api_,
+        chain_,
+        std::vector<Inventory>{
+            Inventory{Inventory::Type::MsgBlock, hash}})};
+
+    if (false == bool(pMessage)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct getdata")
+            .Flush();
+
+        return;
+    }
+
+    const auto& message = *pMessage;
+    send(message.Encode());
+}
+
 auto Peer::request_block(zmq::Message& in) noexcept -> void
 {
     const auto body = in.Body();
@@ -1970,6 +2236,43 @@ auto Peer::request_checkpoint_filter_header() noexcept -> void
     }
 }
 
+auto Peer::request_compact_blocks() noexcept -> void
+{
+    // NOTE BIP152 requires protocol version 70014
+    static constexpr auto minimum = ProtocolVersion{70014};
+    static constexpr auto maxHighBandwidth = std::size_t{3};
+
+    if (minimum > protocol_.load()) { return; }
+
+    const auto services = address_.Services();
+
+    if ((0u == services.count(p2p::Service::Network)) &&
+        (0u == services.count(p2p::Service::Limited))) {
+        return;
+    }
+
+    auto& stats = manager_.CompactBlocks();
+
+    if (maxHighBandwidth > stats.high_bandwidth_peers_++) {
+        high_bandwidth_ = true;
+    } else {
+        --stats.high_bandwidth_peers_;
+    }
+
+    auto pMessage = std::unique_ptr<Message>{factory::BitcoinP2PSendcmpct(
+        api_, chain_, high_bandwidth_, compact_version_)};
+
+    if (false == bool(pMessage)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct sendcmpct")
+            .Flush();
+
+        return;
+    }
+
+    const auto& message = *pMessage;
+    send(message.Encode());
+}
+
 auto Peer::request_headers() noexcept -> void
 {
     request_headers(api_.Factory().Data());
@@ -2027,6 +2330,55 @@ auto Peer::request_transactions(
     send(message.Encode());
 }
 
+auto Peer::send_blocktxn(
+    const block::Hash& hash,
+    const std::vector<std::size_t>& indices,
+    const block::bitcoin::Block& block) noexcept -> void
+{
+    auto response = api_.Factory().Data(hash.Bytes());
+
+    try {
+        const auto count = CompactSize(indices.size()).Encode();
+        response->Concatenate(count.data(), count.size());
+        auto index = std::size_t{0};
+
+        for (auto i = std::size_t{0}; i < indices.size(); ++i) {
+            const auto offset = indices.at(i);
+            index = (0u == i) ? offset : (index + offset + 1u);
+            const auto& pTx = block.at(index);
+
+            if (false == bool(pTx)) {
+                throw std::out_of_range("Invalid transaction index");
+            }
+
+            auto tx = Space{};
+
+            if (false == pTx->Serialize(writer(tx)).has_value()) {
+                throw std::runtime_error("Failed to serialize transaction");
+            }
+
+            response->Concatenate(tx.data(), tx.size());
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return;
+    }
+
+    auto pMsg = std::unique_ptr<Message>{
+        factory::BitcoinP2PBlocktxn(api_, chain_, response)};
+
+    if (false == bool(pMsg)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to construct blocktxn")
+            .Flush();
+
+        return;
+    }
+
+    const auto& msg = *pMsg;
+    send(msg.Encode());
+}
+
 auto Peer::start_handshake() noexcept -> void
 {
     try {
@@ -2080,5 +2432,10 @@ auto Peer::start_handshake() noexcept -> void
     }
 }
 
-Peer::~Peer() { Shutdown(); }
+Peer::~Peer()
+{
+    Shutdown();
+
+    if (high_bandwidth_) { --manager_.CompactBlocks().high_bandwidth_peers_; }
+}
 }  // namespace opentxs::blockchain::p2p::bitcoin::implementation
@@ -8,6 +8,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <future>
 #include <iosfwd>
 #include <map>
@@ -18,6 +19,7 @@
 #include <vector>
 
 #include "blockchain/p2p/Peer.hpp"
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"
 #include "blockchain/p2p/bitcoin/Header.hpp"
 #include "blockchain/p2p/bitcoin/Message.hpp"
 #include "internal/blockchain/database/Database.hpp"
@@ -29,6 +31,7 @@
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/node/BlockOracle.hpp"
 #include "opentxs/blockchain/p2p/Types.hpp"
 
 namespace opentxs
@@ -45,6 +48,14 @@ namespace bitcoin
 class Inventory;
 }  // namespace bitcoin
 
+namespace block
+{
+namespace bitcoin
+{
+class Block;
+}  // namespace bitcoin
+}  // namespace block
+
 namespace node
 {
 namespace internal
@@ -143,6 +154,19 @@ private:
         Time start_{};
     };
 
+    struct PendingCompactBlock {
+        std::unique_ptr<CompactBlock> block_{};
+        std::size_t bytes_{};
+        Time received_{};
+    };
+
+    // A getblocktxn request for a block which was not yet loaded
+    struct PendingBlocktxn {
+        node::BlockOracle::BitcoinBlockFuture block_{};
+        std::vector<std::size_t> indices_{};
+        Time received_{};
+    };
+
     static const std::map<Command, CommandFunction> command_map_;
     static const ProtocolVersion default_protocol_version_{70015};
     static const std::string user_agent_;
@@ -153,6 +177,10 @@ private:
     const std::set<p2p::Service> local_services_;
     std::atomic<bool> relay_;
     Request get_headers_;
+    const std::uint64_t compact_version_;
+    bool high_bandwidth_;
+    std::map<block::pHash, PendingCompactBlock> pending_compact_;
+    std::map<block::pHash, PendingBlocktxn> pending_blocktxn_;
 
     static auto get_local_services(
         const ProtocolVersion version,
@@ -169,23 +197,35 @@ private:
     auto broadcast_block(zmq::Message& message) noexcept -> void final;
     auto broadcast_inv_transaction(ReadView txid) noexcept -> void final;
     auto broadcast_transaction(zmq::Message& message) noexcept -> void final;
+    auto check_pending_requests() noexcept -> void final;
+    auto finish_compact_block(
+        const CompactBlock& block,
+        const std::size_t bytes,
+        const bool withoutRoundTrip) noexcept -> void;
     auto ping() noexcept -> void final;
     auto pong() noexcept -> void final;
     auto process_message(const zmq::Message& message) noexcept -> void final;
+    auto receive_block(const ReadView bytes) noexcept -> bool;
     auto reconcile_mempool() noexcept -> void;
     auto request_addresses() noexcept -> void final;
+    auto request_block(const block::Hash& hash) noexcept -> void;
     auto request_block(zmq::Message& message) noexcept -> void final;
     auto request_blocks() noexcept -> void final;
     auto request_cfheaders() noexcept -> void final;
     auto request_cfilter() noexcept -> void final;
     auto request_checkpoint_block_header() noexcept -> void final;
     auto request_checkpoint_filter_header() noexcept -> void final;
+    auto request_compact_blocks() noexcept -> void;
     using p2p::implementation::Peer::request_headers;
     auto request_headers() noexcept -> void final;
     auto request_headers(const block::Hash& hash) noexcept -> void;
     auto request_mempool() noexcept -> void final;
     auto request_transactions(
         std::vector<blockchain::bitcoin::Inventory>&&) noexcept -> void;
+    auto send_blocktxn(
+        const block::Hash& hash,
+        const std::vector<std::size_t>& indices,
+        const block::bitcoin::Block& block) noexcept -> void;
     auto start_handshake() noexcept -> void final;
 
     auto process_addr(
@@ -0,0 +1,208 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"           // IWYU pragma: associated
+#include "1_Internal.hpp"         // IWYU pragma: associated
+#include "core/cron/Journal.hpp"  // IWYU pragma: associated
+
+#include <cctype>
+
+#include "core/OTStorage.hpp"
+#include "internal/api/Api.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+#define OT_METHOD "opentxs::cron::Journal::"
+
+namespace opentxs::cron
+{
+Journal::Journal(
+    const api::internal::Core& api,
+    const std::string& folder,
+    const std::string& filename) noexcept
+    : api_(api)
+    , folder_(folder)
+    , filename_(filename)
+    , generation_(0)
+    , entries_(0)
+    , records_(0)
+    , batching_(false)
+    , buffer_()
+{
+}
+
+auto Journal::Append(const std::string& record, const bool durable) -> bool
+{
+    buffer_ += std::to_string(record.size()) + '\n' + record;
+    ++records_;
+
+    if (batching_ && (false == durable)) { return true; }
+
+    return write();
+}
+
+auto Journal::Batch() noexcept -> void { batching_ = true; }
+
+auto Journal::erase(const std::int64_t generation, const std::int64_t entries)
+    -> void
+{
+    const auto gen = std::to_string(generation);
+
+    // NOTE erase from the end so that an interrupted erase leaves a prefix,
+    // which Replay can find and clean up
+    for (auto i = entries; i > 0; --i) {
+        OTDB::EraseValueByKey(
+            api_,
+            api_.DataFolder(),
+            folder_,
+            filename_,
+            gen,
+            std::to_string(i - 1));
+    }
+}
+
+auto Journal::exists(const std::int64_t generation, const std::int64_t entry)
+    const -> bool
+{
+    return OTDB::Exists(
+        api_,
+        api_.DataFolder(),
+        folder_,
+        filename_,
+        std::to_string(generation),
+        std::to_string(entry));
+}
+
+auto Journal::Flush() -> bool
+{
+    batching_ = false;
+
+    return write();
+}
+
+auto Journal::Open(const std::int64_t generation) noexcept -> void
+{
+    generation_ = generation;
+    entries_ = 0;
+    records_ = 0;
+    batching_ = false;
+    buffer_.clear();
+}
+
+auto Journal::Replay(const Callback& cb) -> std::size_t
+{
+    auto output = std::size_t{0};
+    entries_ = 0;
+
+    while (exists(generation_, entries_)) {
+        output += replay(
+            OTDB::QueryPlainString(
+                api_,
+                api_.DataFolder(),
+                folder_,
+                filename_,
+                std::to_string(generation_),
+                std::to_string(entries_)),
+            cb);
+        ++entries_;
+    }
+
+    records_ = static_cast<std::int64_t>(output);
+
+    if (0 < output) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Replayed ")(output)(
+            " records from ")(entries_)(" journal entries.")
+            .Flush();
+    }
+
+    // Remove anything left behind by an interrupted snapshot
+    auto stale = std::int64_t{0};
+
+    while (exists(generation_ - 1, stale)) { ++stale; }
+
+    erase(generation_ - 1, stale);
+
+    return output;
+}
+
+auto Journal::replay(const std::string& entry, const Callback& cb) const
+    -> std::size_t
+{
+    auto output = std::size_t{0};
+    auto position = std::size_t{0};
+
+    while (position < entry.size()) {
+        const auto header = entry.find('\n', position);
+        auto size = std::size_t{0};
+        auto valid = (std::string::npos != header) && (header > position);
+
+        for (auto i = position; valid && (i < header); ++i) {
+            const auto c = static_cast<unsigned char>(entry[i]);
+            valid = (0 != std::isdigit(c));
+            size = (size * 10u) + (c - '0');
+        }
+
+        if ((false == valid) || ((entry.size() - header - 1u) < size)) {
+            // NOTE an entry is only incomplete if the process stopped while
+            // it was being written. The records which precede the damage
+            // are still valid.
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Ignoring incomplete journal entry after ")(output)(
+                " records.")
+                .Flush();
+
+            break;
+        }
+
+        if (false == cb(entry.substr(header + 1u, size))) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to replay journal record.")
+                .Flush();
+        }
+
+        ++output;
+        position = header + 1u + size;
+    }
+
+    return output;
+}
+
+auto Journal::Rotate() noexcept -> std::int64_t { return ++generation_; }
+
+auto Journal::Rotated(const bool saved) -> void
+{
+    if (false == saved) {
+        --generation_;
+
+        return;
+    }
+
+    erase(generation_ - 1, entries_);
+    entries_ = 0;
+    records_ = 0;
+    buffer_.clear();
+}
+
+auto Journal::write() -> bool
+{
+    if (buffer_.empty()) { return true; }
+
+    const auto saved = OTDB::StorePlainString(
+        api_,
+        buffer_,
+        api_.DataFolder(),
+        folder_,
+        filename_,
+        std::to_string(generation_),
+        std::to_string(entries_));
+
+    if (false == saved) { return false; }
+
+    ++entries_;
+    buffer_.clear();
+
+    return true;
+}
+}  // namespace opentxs::cron
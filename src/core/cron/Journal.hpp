@@ -0,0 +1,97 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "opentxs/Version.hpp"
+
+namespace opentxs
+{
+namespace api
+{
+namespace internal
+{
+struct Core;
+}  // namespace internal
+}  // namespace api
+}  // namespace opentxs
+
+namespace opentxs::cron
+{
+// Records the changes made to cron between snapshots of the cron file.
+//
+// Every snapshot starts a new generation. The snapshot stores its generation
+// so that entries written before it are ignored after a restart, even if
+// erasing them was interrupted. Each entry holds one or more length prefixed
+// records. While a batch is open records are buffered and written as a
+// single entry by Flush.
+class OPENTXS_EXPORT Journal
+{
+public:
+    using Callback = std::function<bool(const std::string& record)>;
+
+    auto Batching() const noexcept -> bool { return batching_; }
+    auto Generation() const noexcept -> std::int64_t { return generation_; }
+    // Records appended since the last snapshot, including buffered records
+    auto Records() const noexcept -> std::int64_t { return records_; }
+
+    // A durable record is written immediately, together with any buffered
+    // records which precede it, even if a batch is open
+    auto Append(const std::string& record, const bool durable = false)
+        -> bool;
+    auto Batch() noexcept -> void;
+    // Writes the buffered records and closes the batch
+    auto Flush() -> bool;
+    // Selects the generation stored in the most recent snapshot
+    auto Open(const std::int64_t generation) noexcept -> void;
+    // Passes every record of the current generation to the callback in the
+    // order the records were appended, then erases entries left over from
+    // the previous generation. Returns the number of records replayed.
+    auto Replay(const Callback& cb) -> std::size_t;
+    // Starts a new generation for a snapshot which will reflect every
+    // appended record, including buffered ones
+    auto Rotate() noexcept -> std::int64_t;
+    // Erases the previous generation if the snapshot was saved, otherwise
+    // returns to it
+    auto Rotated(const bool saved) -> void;
+
+    Journal(
+        const api::internal::Core& api,
+        const std::string& folder,
+        const std::string& filename) noexcept;
+
+    ~Journal() = default;
+
+private:
+    const api::internal::Core& api_;
+    const std::string folder_;
+    const std::string filename_;
+    std::int64_t generation_;
+    std::int64_t entries_;
+    std::int64_t records_;
+    bool batching_;
+    std::string buffer_;
+
+    auto exists(const std::int64_t generation, const std::int64_t entry) const
+        -> bool;
+    auto replay(const std::string& entry, const Callback& cb) const
+        -> std::size_t;
+
+    auto erase(const std::int64_t generation, const std::int64_t entries)
+        -> void;
+    auto write() -> bool;
+
+    Journal() = delete;
+    Journal(const Journal&) = delete;
+    Journal(Journal&&) = delete;
+    auto operator=(const Journal&) -> Journal& = delete;
+    auto operator=(Journal&&) -> Journal& = delete;
+};
+}  // namespace opentxs::cron
@@ -7,14 +7,19 @@
 #include "1_Internal.hpp"                // IWYU pragma: associated
 #include "opentxs/core/cron/OTCron.hpp"  // IWYU pragma: associated
 
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <map>
 #include <memory>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <utility>
 
 #include "core/OTStorage.hpp"
+#include "core/cron/Journal.hpp"
+#include "core/cron/Schedule.hpp"
 #include "internal/api/Api.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Factory.hpp"
@@ -37,6 +42,15 @@
 
 namespace opentxs
 {
+namespace
+{
+const char* cron_journal_{"OT-CRON.jrn"};
+// The cron file is rewritten once this many records have been journaled.
+constexpr auto cron_journal_limit_ = std::int64_t{256};
+// Transaction numbers are journaled as consumed in blocks of this size.
+constexpr auto cron_number_reservation_ = std::int64_t{64};
+}  // namespace
+
 // NOTE: these are only code defaults -- the values are actually loaded from
 // ~/.ot/server.cfg.
 
@@ -58,11 +72,17 @@ OTCron::OTCron(const api::internal::Core& server)
     , m_mapMarkets()
     , m_mapCronItems()
     , m_multimapCronItems()
+    , m_pSchedule(std::make_unique<cron::Schedule>())
     , m_NOTARY_ID(api_.Factory().ServerID())
     , m_listTransactionNumbers()
     , m_bIsActivated(false)
     , m_pServerNym(nullptr)  // just here for convenience, not responsible to
                              // cleanup this pointer.
+    , m_pJournal(std::make_unique<cron::Journal>(
+          server,
+          server.Legacy().Cron(),
+          cron_journal_))
+    , m_lReservedNumbers(0)
 {
     InitCron();
     LogDebug(OT_METHOD)(__FUNCTION__)(": Finished calling InitCron 0.").Flush();
@@ -82,6 +102,11 @@ auto OTCron::LoadCron() -> bool
 
     if (bSuccess) bSuccess = VerifySignature(*(GetServerNym()));
 
+    // The journal is replayed even if there is no cron file yet, since
+    // items may have been added before the first snapshot was written.
+    m_pJournal->Replay([this](const auto& record) { return replay(record); });
+    m_lReservedNumbers = 0;
+
     return bSuccess;
 }
 
@@ -93,6 +118,9 @@ auto OTCron::SaveCron() -> bool
 
     OT_ASSERT(nullptr != GetServerNym());
 
+    // The snapshot starts a new journal generation so that records written
+    // before it are ignored even if erasing them is interrupted.
+    m_pJournal->Rotate();
     ReleaseSignatures();
 
     // Sign it, save it internally to string, and then save that out to the
@@ -102,9 +130,135 @@ auto OTCron::SaveCron() -> bool
         LogOutput(OT_METHOD)(__FUNCTION__)(": Error saving main Cronfile: ")(
             szFoldername)(PathSeparator())(szFilename)(".")
             .Flush();
+        m_pJournal->Rotated(false);
+
         return false;
-    } else
+    }
+
+    m_pJournal->Rotated(true);
+    // The snapshot lists the unused part of the reserved block as available
+    m_lReservedNumbers = 0;
+
+    return true;
+}
+
+auto OTCron::erase_item(const std::int64_t lTransactionNum) -> bool
+{
+    auto it_map = FindItemOnMap(lTransactionNum);
+
+    if (m_mapCronItems.end() == it_map) { return false; }
+
+    auto it_multimap = FindItemOnMultimap(lTransactionNum);
+
+    OT_ASSERT(m_multimapCronItems.end() != it_multimap);  // If found on
+                                                          // map, MUST be on
+                                                          // multimap also.
+
+    m_mapCronItems.erase(it_map);
+    m_multimapCronItems.erase(it_multimap);
+    unschedule(lTransactionNum);
+
+    return true;
+}
+
+auto OTCron::journal(const std::string& record, const bool durable) -> bool
+{
+    if (false == m_pJournal->Append(record, durable)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Error writing journal record. Saving main Cronfile instead.")
+            .Flush();
+
+        return SaveCron();
+    }
+
+    // NOTE while cron items are being processed the snapshot is deferred
+    // until the end of the round
+    if (m_pJournal->Batching()) { return true; }
+
+    if (cron_journal_limit_ <= m_pJournal->Records()) { return SaveCron(); }
+
+    return true;
+}
+
+auto OTCron::replay(const std::string& record) -> bool
+{
+    // Records consist of a type line, a field line, and the remaining data
+    const auto first = record.find('\n');
+    const auto second =
+        (std::string::npos == first) ? first : record.find('\n', first + 1);
+
+    if (std::string::npos == second) { return false; }
+
+    const auto type = record.substr(0, first);
+    const auto field = record.substr(first + 1, second - first - 1);
+    const auto data = record.substr(second + 1);
+
+    if ("add" == type) {
+        auto armored = Armored::Factory();
+        armored->Set(data.c_str());
+        auto strData = String::Factory();
+
+        if (false == armored->GetString(strData)) { return false; }
+
+        auto pItem{api_.Factory().CronItem(strData)};
+
+        if (false == bool(pItem)) { return false; }
+
+        std::shared_ptr<OTCronItem> item{pItem.release()};
+
+        if (false == item->VerifySignature(*m_pServerNym)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": ERROR SECURITY: Server signature failed to verify on a "
+                "journaled cron item: ")(item->GetTransactionNum())(".")
+                .Flush();
+
+            return false;
+        }
+
+        // Already present in the cron file
+        if (GetItemByOfficialNum(item->GetTransactionNum())) { return true; }
+
+        return AddCronItem(item, false, parseTimestamp(field));
+    } else if ("remove" == type) {
+        erase_item(String::StringToLong(field));
+
         return true;
+    } else if ("numbers" == type) {
+        auto numbers = std::istringstream{data};
+        auto lTransactionNum = std::int64_t{0};
+
+        while (numbers >> lTransactionNum) {
+            AddTransactionNumber(lTransactionNum);
+        }
+
+        return true;
+    } else if ("consume" == type) {
+        auto numbers = std::istringstream{data};
+        auto lTransactionNum = std::int64_t{0};
+
+        while (numbers >> lTransactionNum) {
+            m_listTransactionNumbers.remove(lTransactionNum);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+void OTCron::schedule(const OTCronItem& item, const Time tDateAdded)
+{
+    // NOTE cron items skip processing until strictly more than their process
+    // interval has elapsed since they were last processed. Items which have
+    // never been processed are due immediately.
+    const auto due = item.GetLastProcessDate() + item.GetProcessInterval() +
+                     std::chrono::milliseconds{1};
+    m_pSchedule->Add(item.GetTransactionNum(), tDateAdded, due);
+}
+
+void OTCron::unschedule(const std::int64_t lTransactionNum)
+{
+    m_pSchedule->Remove(lTransactionNum);
 }
 
 // Loops through ALL markets, and calls pMarket->GetNym_OfferList(NYM_ID,
@@ -334,6 +488,21 @@ void OTCron::AddTransactionNumber(const std::int64_t& lTransactionNum)
     m_listTransactionNumbers.push_back(lTransactionNum);
 }
 
+auto OTCron::AddTransactionNumbers(const listOfLongNumbers& numbers) -> bool
+{
+    if (numbers.empty()) { return true; }
+
+    auto record = std::stringstream{};
+    record << "numbers\n" << numbers.size() << '\n';
+
+    for (const auto& lTransactionNum : numbers) {
+        AddTransactionNumber(lTransactionNum);
+        record << lTransactionNum << ' ';
+    }
+
+    return journal(record.str());
+}
+
 // Once this starts returning 0, OTCron can no longer process trades and
 // payment plans until the server object replenishes this list.
 auto OTCron::GetNextTransactionNumber() -> std::int64_t
@@ -344,6 +513,38 @@ auto OTCron::GetNextTransactionNumber() -> std::int64_t
 
     m_listTransactionNumbers.pop_front();
 
+    if (0 < m_lReservedNumbers) {
+        --m_lReservedNumbers;
+
+        return lTransactionNum;
+    }
+
+    // Make sure the number is never handed out again, even if the cron file
+    // is not saved before the next restart. The following numbers are
+    // journaled along with it so that most numbers do not need a journal
+    // write. A restart discards whatever is left of the block.
+    auto numbers = std::stringstream{};
+    auto reserved = std::int64_t{0};
+    numbers << lTransactionNum << ' ';
+
+    for (auto it = m_listTransactionNumbers.begin();
+         (m_listTransactionNumbers.end() != it) &&
+         (reserved + 1 < cron_number_reservation_);
+         ++it, ++reserved) {
+        numbers << *it << ' ';
+    }
+
+    const auto generation = m_pJournal->Generation();
+    const auto saved = journal(
+        "consume\n" + std::to_string(reserved + 1) + "\n" + numbers.str(),
+        true);
+
+    // NOTE if the journal write caused the cron file to be saved then the
+    // reserved numbers are listed as available by the snapshot
+    if (saved && (generation == m_pJournal->Generation())) {
+        m_lReservedNumbers = reserved;
+    }
+
     return lTransactionNum;
 }
 
@@ -372,6 +573,11 @@ auto OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
             String::Factory(xml->getAttributeValue("notaryID"));
 
         m_NOTARY_ID->SetString(strNotaryID);
+        // NOTE cron files written by older versions have no journal
+        const auto strGeneration =
+            String::Factory(xml->getAttributeValue("journalGeneration"));
+        m_pJournal->Open(
+            strGeneration->Exists() ? strGeneration->ToLong() : 0);
 
         LogNormal(OT_METHOD)(__FUNCTION__)(": Loading OTCron for NotaryID: ")(
             strNotaryID)(".")
@@ -527,6 +733,8 @@ void OTCron::UpdateContents(const PasswordPrompt& reason)
 
     tag.add_attribute("version", m_strVersion->Get());
     tag.add_attribute("notaryID", NOTARY_ID->Get());
+    tag.add_attribute(
+        "journalGeneration", std::to_string(m_pJournal->Generation()));
 
     // Save the Market entries (the markets themselves are saved in a markets
     // folder.)
@@ -590,7 +798,7 @@ auto OTCron::computeTimeout() -> std::chrono::milliseconds
 
 // Make sure to call this regularly so the CronItems get a chance to process and
 // expire.
-void OTCron::ProcessCronItems()
+void OTCron::ProcessCronItems(const ItemLock& lock)
 {
     auto reason = api_.Factory().PasswordPrompt(__FUNCTION__);
     if (!m_bIsActivated) {
@@ -618,13 +826,15 @@ void OTCron::ProcessCronItems()
             .Flush();
         return;
     }
-    bool bNeedToSave = false;
-
-    // loop through the cron items and tell each one to ProcessCron().
-    // If the item returns true, that means leave it on the list. Otherwise,
-    // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
+    // Journal records are written as one entry at the end of the round,
+    // apart from consumed transaction numbers which must be written before
+    // the numbers are used.
+    m_pJournal->Batch();
+
+    // Only items whose next process time has arrived are visited. They are
+    // processed in the order they were added to cron.
+    for (const auto& [tDateAdded, lTransactionNum] :
+         m_pSchedule->Due(Clock::now())) {
         if (GetTransactionCount() <= nTwentyPercent) {
             LogOutput(OT_METHOD)(__FUNCTION__)(
                 ": WARNING: Cron has fewer than 20 percent of its normal "
@@ -641,29 +851,54 @@ void OTCron::ProcessCronItems()
                 .Flush();
             break;
         }
-        auto pItem = it->second;
-        OT_ASSERT(false != bool(pItem));
+        auto pItem = GetItemByOfficialNum(lTransactionNum);
+
+        // Removed while processing an earlier item
+        if (false == bool(pItem)) { continue; }
+
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Processing item number: ")(
             pItem->GetTransactionNum())
             .Flush();
 
-        if (pItem->ProcessCron(reason)) {
-            it++;
+        auto keep{false};
+        auto process = [&] {
+            keep = pItem->ProcessCron(reason);
+
+            if (keep) { return; }
+
+            pItem->HookRemovalFromCron(
+                api_.Wallet(), nullptr, GetNextTransactionNumber(), reason);
+        };
+
+        if (lock) {
+            lock(*pItem, process);
+        } else {
+            process();
+        }
+
+        if (keep) {
+            schedule(*pItem, tDateAdded);
             continue;
         }
-        pItem->HookRemovalFromCron(
-            api_.Wallet(), nullptr, GetNextTransactionNumber(), reason);
+
         LogNormal(OT_METHOD)(__FUNCTION__)(": Removing cron item: ")(
             pItem->GetTransactionNum())(".")
             .Flush();
-        it = m_multimapCronItems.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        OT_ASSERT(m_mapCronItems.end() != it_map);
-        m_mapCronItems.erase(it_map);
+        const auto erased = erase_item(lTransactionNum);
+
+        OT_ASSERT(erased);
+
+        journal("remove\n" + std::to_string(lTransactionNum) + "\n");
+    }
 
-        bNeedToSave = true;
+    if (false == m_pJournal->Flush()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Error writing journal entry. Saving main Cronfile instead.")
+            .Flush();
+        SaveCron();
+    } else if (cron_journal_limit_ <= m_pJournal->Records()) {
+        SaveCron();
     }
-    if (bNeedToSave) SaveCron();
 }
 
 // OTCron IS responsible for cleaning up theItem, and takes ownership.
@@ -722,6 +957,7 @@ auto OTCron::AddCronItem(
         m_multimapCronItems.insert(
             m_multimapCronItems.upper_bound(tDateAdded),
             std::pair<Time, std::shared_ptr<OTCronItem>>(tDateAdded, theItem));
+        schedule(*theItem, tDateAdded);
 
         theItem->SetCronPointer(*this);
         theItem->setServerNym(m_pServerNym);
@@ -759,8 +995,10 @@ auto OTCron::AddCronItem(
             // DONE ABOVE. See if (bSaveReceipt) ...
             //            theItem->SaveContract();
 
-            // Since we added an item to the Cron, we SAVE it.
-            bSuccess = SaveCron();
+            // Since we added an item to the Cron, we journal it.
+            bSuccess = journal(
+                "add\n" + formatTimestamp(tDateAdded) + "\n" +
+                Armored::Factory(String::Factory(*theItem))->Get());
 
             if (bSuccess)
                 LogNormal(OT_METHOD)(__FUNCTION__)(
@@ -808,21 +1046,14 @@ auto OTCron::RemoveCronItem(
     else {
         auto pItem = it_map->second;
         //      OT_ASSERT(nullptr != pItem); // Already done in FindItemOnMap.
-
-        // We have to remove it from the multimap as well.
-        auto it_multimap = FindItemOnMultimap(lTransactionNum);
-        OT_ASSERT(m_multimapCronItems.end() != it_multimap);  // If found on
-                                                              // map, MUST be on
-                                                              // multimap also.
-
         pItem->HookRemovalFromCron(
             api_.Wallet(), theRemover, GetNextTransactionNumber(), reason);
+        // Remove from the MAP, the MULTIMAP, and the schedule.
+        erase_item(lTransactionNum);
 
-        m_mapCronItems.erase(it_map);            // Remove from MAP.
-        m_multimapCronItems.erase(it_multimap);  // Remove from MULTIMAP.
-
-        // An item has been removed from Cron. SAVE.
-        return SaveCron();
+        // An item has been removed from Cron. Journal it.
+        return journal(
+            "remove\n" + std::to_string(lTransactionNum) + "\n");
     }
 
     return false;
@@ -868,7 +1099,11 @@ auto OTCron::FindItemOnMap(std::int64_t lTransactionNum)
 auto OTCron::FindItemOnMultimap(std::int64_t lTransactionNum)
     -> multimapOfCronItems::iterator
 {
-    auto itt = m_multimapCronItems.begin();
+    // The schedule knows the date the item was added, so only items which
+    // share that date need to be searched.
+    const auto added = m_pSchedule->Added(lTransactionNum);
+    auto itt = added.has_value() ? m_multimapCronItems.lower_bound(*added)
+                                 : m_multimapCronItems.begin();
 
     while (m_multimapCronItems.end() != itt) {
         auto pItem = itt->second;
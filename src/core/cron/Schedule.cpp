@@ -0,0 +1,61 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"            // IWYU pragma: associated
+#include "1_Internal.hpp"          // IWYU pragma: associated
+#include "core/cron/Schedule.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+namespace opentxs::cron
+{
+Schedule::Schedule() noexcept
+    : items_()
+    , index_()
+{
+}
+
+auto Schedule::Add(const std::int64_t number, const Time added, const Time due)
+    -> void
+{
+    Remove(number);
+    index_[number] = items_.emplace(due, std::make_pair(added, number));
+}
+
+auto Schedule::Added(const std::int64_t number) const noexcept
+    -> std::optional<Time>
+{
+    const auto it = index_.find(number);
+
+    if (index_.end() == it) { return std::nullopt; }
+
+    return it->second->second.first;
+}
+
+auto Schedule::Due(const Time now) const noexcept -> std::vector<Item>
+{
+    auto output = std::vector<Item>{};
+
+    for (auto it = items_.begin(); (items_.end() != it) && (it->first <= now);
+         ++it) {
+        output.emplace_back(it->second);
+    }
+
+    // NOTE items added at the same time are ordered by transaction number
+    std::sort(output.begin(), output.end());
+
+    return output;
+}
+
+auto Schedule::Remove(const std::int64_t number) noexcept -> void
+{
+    auto it = index_.find(number);
+
+    if (index_.end() == it) { return; }
+
+    items_.erase(it->second);
+    index_.erase(it);
+}
+}  // namespace opentxs::cron
@@ -0,0 +1,55 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/Version.hpp"
+
+namespace opentxs::cron
+{
+// Indexes cron items by the time at which they next need to be processed so
+// that a cron round only visits the items which are due.
+class OPENTXS_EXPORT Schedule
+{
+public:
+    // The date the item was added to cron and its transaction number
+    using Item = std::pair<Time, std::int64_t>;
+
+    // Returns the date the item was added to cron, if it is scheduled
+    auto Added(const std::int64_t number) const noexcept -> std::optional<Time>;
+    // Returns every item due at or before the specified time, in the order
+    // the items were added to cron
+    auto Due(const Time now) const noexcept -> std::vector<Item>;
+    auto Size() const noexcept -> std::size_t { return index_.size(); }
+
+    // Replaces any previous schedule for the same transaction number
+    auto Add(const std::int64_t number, const Time added, const Time due)
+        -> void;
+    auto Remove(const std::int64_t number) noexcept -> void;
+
+    Schedule() noexcept;
+
+    ~Schedule() = default;
+
+private:
+    using Items = std::multimap<Time, Item>;
+
+    Items items_;
+    std::map<std::int64_t, Items::iterator> index_;
+
+    Schedule(const Schedule&) = delete;
+    Schedule(Schedule&&) = delete;
+    auto operator=(const Schedule&) -> Schedule& = delete;
+    auto operator=(Schedule&&) -> Schedule& = delete;
+};
+}  // namespace opentxs::cron
@@ -298,6 +298,22 @@ auto HD::ChildKey(const Bip32Index index, const PasswordPrompt& reason)
 #endif  // OT_CRYPTO_SUPPORTED_KEY_ED25519
 #if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
             case crypto::key::asymmetric::Algorithm::Secp256k1: {
+                if (false == HasPrivate()) {
+                    // NOTE a public child has no private key to protect so it
+                    // is not worth creating a session key for the chain code
+
+                    return factory::Secp256k1Key(
+                        api_,
+                        api_.Crypto().SECP256K1(),
+                        blank,
+                        ccode,
+                        pubkey,
+                        path,
+                        parent,
+                        role_,
+                        version_);
+                }
+
                 return factory::Secp256k1Key(
                     api_,
                     api_.Crypto().SECP256K1(),
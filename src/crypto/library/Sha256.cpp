@@ -0,0 +1,326 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"               // IWYU pragma: associated
+#include "1_Internal.hpp"             // IWYU pragma: associated
+#include "crypto/library/Sha256.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace opentxs::crypto::sha256
+{
+const std::array<std::uint32_t, 64> k_{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+const std::array<std::uint32_t, state_words_> iv_{
+    0x6a09e667,
+    0xbb67ae85,
+    0x3c6ef372,
+    0xa54ff53a,
+    0x510e527f,
+    0x9b05688c,
+    0x1f83d9ab,
+    0x5be0cd19};
+
+namespace
+{
+using Compress = auto (*)(std::uint32_t*, const Block*) noexcept -> void;
+
+// Compressed by lanes which have run out of messages to hash. The result is
+// discarded.
+const auto idle_ = std::array<std::byte, block_bytes_>{};
+
+// One message being hashed in a lane. The final one or two blocks, which
+// contain the padding, are copied into tail_ when the job is loaded so the
+// caller's buffer is not read again once the job has started.
+class Job
+{
+public:
+    auto Active() const noexcept -> bool { return active_; }
+    auto Current() const noexcept -> Block
+    {
+        if (next_ < full_) { return data_ + (next_ * block_bytes_); }
+
+        return tail_.data() + ((next_ - full_) * block_bytes_);
+    }
+    auto Done() const noexcept -> bool { return next_ == total_; }
+    auto Index() const noexcept -> std::size_t { return index_; }
+
+    auto Advance() noexcept -> void { ++next_; }
+    auto Load(const ReadView input, const std::size_t index) noexcept -> void
+    {
+        const auto size = input.size();
+        data_ = reinterpret_cast<const std::byte*>(input.data());
+        full_ = size / block_bytes_;
+        const auto remaining = size % block_bytes_;
+        total_ = full_ + (((remaining + 9u) > block_bytes_) ? 2u : 1u);
+        next_ = 0;
+        index_ = index;
+        active_ = true;
+        tail_.fill(std::byte{0x0});
+
+        if (0u < remaining) {
+            std::memcpy(
+                tail_.data(), data_ + (full_ * block_bytes_), remaining);
+        }
+
+        tail_[remaining] = std::byte{0x80};
+        const auto bits = static_cast<std::uint64_t>(size) * 8u;
+        auto* length = tail_.data() + ((total_ - full_) * block_bytes_);
+
+        for (auto i = std::size_t{0}; i < sizeof(bits); ++i) {
+            *(--length) = static_cast<std::byte>(bits >> (i * 8u));
+        }
+    }
+    auto Stop() noexcept -> void { active_ = false; }
+
+    Job() noexcept
+        : data_(nullptr)
+        , full_(0)
+        , total_(0)
+        , next_(0)
+        , index_(0)
+        , active_(false)
+        , tail_()
+    {
+    }
+
+private:
+    const std::byte* data_;
+    std::size_t full_;
+    std::size_t total_;
+    std::size_t next_;
+    std::size_t index_;
+    bool active_;
+    std::array<std::byte, 2u * block_bytes_> tail_;
+};
+
+auto engine(const Engine type) noexcept -> std::pair<Compress, std::size_t>
+{
+    switch (type) {
+#if OT_SHA256_X86
+        case Engine::AVX2: {
+
+            return {CompressAVX2, 8u};
+        }
+        case Engine::SSE41: {
+
+            return {CompressSSE41, 4u};
+        }
+#endif  // OT_SHA256_X86
+        case Engine::Scalar:
+        default: {
+
+            return {CompressScalar, 1u};
+        }
+    }
+}
+
+// Keeps every lane busy by starting the next message as soon as the previous
+// message in that lane finishes, so inputs of different lengths do not leave
+// lanes idle until the end of the batch
+auto hash(
+    const Compress compress,
+    const std::size_t lanes,
+    const std::vector<ReadView>& inputs,
+    std::byte* output) noexcept -> void
+{
+    auto jobs = std::vector<Job>(lanes);
+    auto blocks = std::vector<Block>(lanes, idle_.data());
+    auto state = std::vector<std::uint32_t>(state_words_ * lanes);
+    auto next = std::size_t{0};
+    auto running = std::size_t{0};
+    const auto load = [&](const std::size_t lane) {
+        if (next == inputs.size()) {
+            jobs[lane].Stop();
+
+            return false;
+        }
+
+        jobs[lane].Load(inputs[next], next);
+        ++next;
+
+        for (auto i = std::size_t{0}; i < state_words_; ++i) {
+            state[(i * lanes) + lane] = iv_[i];
+        }
+
+        return true;
+    };
+    const auto finish = [&](const std::size_t lane) {
+        auto* out = output + (jobs[lane].Index() * digest_bytes_);
+
+        for (auto i = std::size_t{0}; i < state_words_; ++i) {
+            const auto word = state[(i * lanes) + lane];
+            *(out++) = static_cast<std::byte>(word >> 24u);
+            *(out++) = static_cast<std::byte>(word >> 16u);
+            *(out++) = static_cast<std::byte>(word >> 8u);
+            *(out++) = static_cast<std::byte>(word);
+        }
+    };
+
+    for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+        if (load(lane)) { ++running; }
+    }
+
+    while (0u < running) {
+        for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+            const auto& job = jobs[lane];
+            blocks[lane] = job.Active() ? job.Current() : idle_.data();
+        }
+
+        compress(state.data(), blocks.data());
+
+        for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+            auto& job = jobs[lane];
+
+            if (false == job.Active()) { continue; }
+
+            job.Advance();
+
+            if (false == job.Done()) { continue; }
+
+            finish(lane);
+
+            if (false == load(lane)) { --running; }
+        }
+    }
+}
+}  // namespace
+
+auto Batch(
+    const Engine type,
+    const std::vector<ReadView>& inputs,
+    const bool twice,
+    std::byte* output) noexcept -> bool
+{
+    if (false == Supported(type)) { return false; }
+
+    const auto [compress, lanes] = engine(type);
+    hash(compress, lanes, inputs, output);
+
+    if (twice) {
+        auto digests = std::vector<ReadView>{};
+        digests.reserve(inputs.size());
+
+        for (auto i = std::size_t{0}; i < inputs.size(); ++i) {
+            digests.emplace_back(
+                reinterpret_cast<const char*>(output + (i * digest_bytes_)),
+                digest_bytes_);
+        }
+
+        // NOTE hashing in place is safe because each job copies its only
+        // block into the job tail before any digest is written
+        hash(compress, lanes, digests, output);
+    }
+
+    return true;
+}
+
+auto Best() noexcept -> Engine
+{
+    static const auto best = []() {
+        if (Supported(Engine::AVX2)) { return Engine::AVX2; }
+        if (Supported(Engine::SSE41)) { return Engine::SSE41; }
+
+        return Engine::Scalar;
+    }();
+
+    return best;
+}
+
+auto CompressScalar(std::uint32_t* state, const Block* blocks) noexcept -> void
+{
+    const auto rotr = [](std::uint32_t x, int n) -> std::uint32_t {
+        return (x >> n) | (x << (32 - n));
+    };
+    const auto* block = blocks[0];
+    auto w = std::array<std::uint32_t, 64>{};
+
+    for (auto i = std::size_t{0}; i < 16u; ++i) {
+        const auto* p = block + (i * sizeof(std::uint32_t));
+        w[i] = (std::to_integer<std::uint32_t>(p[0]) << 24u) |
+               (std::to_integer<std::uint32_t>(p[1]) << 16u) |
+               (std::to_integer<std::uint32_t>(p[2]) << 8u) |
+               std::to_integer<std::uint32_t>(p[3]);
+    }
+
+    for (auto i = std::size_t{16}; i < w.size(); ++i) {
+        const auto s0 =
+            rotr(w[i - 15u], 7) ^ rotr(w[i - 15u], 18) ^ (w[i - 15u] >> 3u);
+        const auto s1 =
+            rotr(w[i - 2u], 17) ^ rotr(w[i - 2u], 19) ^ (w[i - 2u] >> 10u);
+        w[i] = w[i - 16u] + s0 + w[i - 7u] + s1;
+    }
+
+    auto v = std::array<std::uint32_t, state_words_>{};
+    std::copy(state, state + state_words_, v.begin());
+    auto& [a, b, c, d, e, f, g, h] = v;
+
+    for (auto i = std::size_t{0}; i < w.size(); ++i) {
+        const auto S1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+        const auto ch = (e & f) ^ (~e & g);
+        const auto t1 = h + S1 + ch + k_[i] + w[i];
+        const auto S0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+        const auto maj = (a & b) ^ (a & c) ^ (b & c);
+        const auto t2 = S0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    for (auto i = std::size_t{0}; i < state_words_; ++i) { state[i] += v[i]; }
+}
+
+auto Supported(const Engine type) noexcept -> bool
+{
+    switch (type) {
+        case Engine::Scalar: {
+
+            return true;
+        }
+#if OT_SHA256_X86
+        case Engine::SSE41: {
+            static const auto supported = []() {
+                __builtin_cpu_init();
+
+                return 0 != __builtin_cpu_supports("sse4.1");
+            }();
+
+            return supported;
+        }
+        case Engine::AVX2: {
+            static const auto supported = []() {
+                __builtin_cpu_init();
+
+                return 0 != __builtin_cpu_supports("avx2");
+            }();
+
+            return supported;
+        }
+#endif  // OT_SHA256_X86
+        default: {
+
+            return false;
+        }
+    }
+}
+}  // namespace opentxs::crypto::sha256
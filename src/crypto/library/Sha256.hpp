@@ -0,0 +1,33 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "internal/crypto/library/Sha256.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace opentxs::crypto::sha256
+{
+constexpr auto block_bytes_ = std::size_t{64};
+constexpr auto state_words_ = std::size_t{8};
+
+using Block = const std::byte*;
+
+extern const std::array<std::uint32_t, 64> k_;
+extern const std::array<std::uint32_t, state_words_> iv_;
+
+// The state of every lane is stored word-major: word i of lane j is located
+// at state[i * lanes + j]. Each function compresses one block per lane.
+auto CompressScalar(std::uint32_t* state, const Block* blocks) noexcept
+    -> void;
+#if OT_SHA256_X86
+auto CompressSSE41(std::uint32_t* state, const Block* blocks) noexcept
+    -> void;
+auto CompressAVX2(std::uint32_t* state, const Block* blocks) noexcept -> void;
+#endif  // OT_SHA256_X86
+}  // namespace opentxs::crypto::sha256
@@ -0,0 +1,129 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// NOTE this file must be compiled with -mavx2
+
+#include "0_stdafx.hpp"               // IWYU pragma: associated
+#include "1_Internal.hpp"             // IWYU pragma: associated
+#include "crypto/library/Sha256.hpp"  // IWYU pragma: associated
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "crypto/library/Sha256Lanes.hpp"
+
+namespace opentxs::crypto::sha256
+{
+namespace
+{
+struct AVX2 {
+    using Vector = __m256i;
+
+    static constexpr auto lanes_ = std::size_t{8};
+
+    static auto Add(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm256_add_epi32(lhs, rhs);
+    }
+    static auto And(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm256_and_si256(lhs, rhs);
+    }
+    // NOTE ~lhs & rhs
+    static auto AndNot(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm256_andnot_si256(lhs, rhs);
+    }
+    // Loads eight big endian words starting at offset from every lane and
+    // transposes them so that out[i] holds word i of all eight lanes
+    static auto Load(
+        const Block* blocks,
+        std::size_t offset,
+        Vector* out) noexcept -> void
+    {
+        const auto swap = _mm256_set_epi8(
+            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+        const auto row = [&](std::size_t lane) {
+            return _mm256_shuffle_epi8(
+                _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(blocks[lane] + offset)),
+                swap);
+        };
+        // NOTE the unpack instructions operate on each 128 bit half
+        // independently so the final step exchanges halves between rows
+        const auto r0 = row(0);
+        const auto r1 = row(1);
+        const auto r2 = row(2);
+        const auto r3 = row(3);
+        const auto r4 = row(4);
+        const auto r5 = row(5);
+        const auto r6 = row(6);
+        const auto r7 = row(7);
+        const auto t0 = _mm256_unpacklo_epi32(r0, r1);
+        const auto t1 = _mm256_unpackhi_epi32(r0, r1);
+        const auto t2 = _mm256_unpacklo_epi32(r2, r3);
+        const auto t3 = _mm256_unpackhi_epi32(r2, r3);
+        const auto t4 = _mm256_unpacklo_epi32(r4, r5);
+        const auto t5 = _mm256_unpackhi_epi32(r4, r5);
+        const auto t6 = _mm256_unpacklo_epi32(r6, r7);
+        const auto t7 = _mm256_unpackhi_epi32(r6, r7);
+        const auto u0 = _mm256_unpacklo_epi64(t0, t2);
+        const auto u1 = _mm256_unpackhi_epi64(t0, t2);
+        const auto u2 = _mm256_unpacklo_epi64(t1, t3);
+        const auto u3 = _mm256_unpackhi_epi64(t1, t3);
+        const auto u4 = _mm256_unpacklo_epi64(t4, t6);
+        const auto u5 = _mm256_unpackhi_epi64(t4, t6);
+        const auto u6 = _mm256_unpacklo_epi64(t5, t7);
+        const auto u7 = _mm256_unpackhi_epi64(t5, t7);
+        out[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+        out[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+        out[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+        out[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+        out[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+        out[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+        out[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+        out[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+    }
+    static auto LoadState(const std::uint32_t* in) noexcept -> Vector
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+    }
+    static auto Or(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm256_or_si256(lhs, rhs);
+    }
+    template <int N>
+    static auto Rotr(Vector x) noexcept -> Vector
+    {
+        return _mm256_or_si256(
+            _mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+    }
+    static auto Set(std::uint32_t value) noexcept -> Vector
+    {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    }
+    template <int N>
+    static auto Shr(Vector x) noexcept -> Vector
+    {
+        return _mm256_srli_epi32(x, N);
+    }
+    static auto StoreState(std::uint32_t* out, Vector value) noexcept -> void
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), value);
+    }
+    static auto Xor(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm256_xor_si256(lhs, rhs);
+    }
+};
+}  // namespace
+
+auto CompressAVX2(std::uint32_t* state, const Block* blocks) noexcept -> void
+{
+    CompressLanes<AVX2>(state, blocks);
+}
+}  // namespace opentxs::crypto::sha256
@@ -0,0 +1,91 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "crypto/library/Sha256.hpp"
+
+namespace opentxs::crypto::sha256
+{
+// Compression function shared by the SIMD engines. Ops supplies a vector type
+// holding one 32 bit word for each of Ops::lanes_ independent messages along
+// with the arithmetic on that type. Each engine instantiates this template in
+// a translation unit compiled for the matching instruction set.
+template <typename Ops>
+auto CompressLanes(std::uint32_t* state, const Block* blocks) noexcept -> void
+{
+    using V = typename Ops::Vector;
+    constexpr auto lanes = Ops::lanes_;
+
+    static_assert(0 == (16 % lanes));
+
+    const auto S0 = [](V x) {
+        return Ops::Xor(
+            Ops::Xor(Ops::template Rotr<2>(x), Ops::template Rotr<13>(x)),
+            Ops::template Rotr<22>(x));
+    };
+    const auto S1 = [](V x) {
+        return Ops::Xor(
+            Ops::Xor(Ops::template Rotr<6>(x), Ops::template Rotr<11>(x)),
+            Ops::template Rotr<25>(x));
+    };
+    const auto s0 = [](V x) {
+        return Ops::Xor(
+            Ops::Xor(Ops::template Rotr<7>(x), Ops::template Rotr<18>(x)),
+            Ops::template Shr<3>(x));
+    };
+    const auto s1 = [](V x) {
+        return Ops::Xor(
+            Ops::Xor(Ops::template Rotr<17>(x), Ops::template Rotr<19>(x)),
+            Ops::template Shr<10>(x));
+    };
+    auto w = std::array<V, 64>{};
+
+    for (auto i = std::size_t{0}; i < 16u; i += lanes) {
+        Ops::Load(blocks, i * sizeof(std::uint32_t), &w[i]);
+    }
+
+    for (auto i = std::size_t{16}; i < w.size(); ++i) {
+        w[i] = Ops::Add(
+            Ops::Add(s1(w[i - 2u]), w[i - 7u]),
+            Ops::Add(s0(w[i - 15u]), w[i - 16u]));
+    }
+
+    auto v = std::array<V, state_words_>{};
+
+    for (auto i = std::size_t{0}; i < v.size(); ++i) {
+        v[i] = Ops::LoadState(state + (i * lanes));
+    }
+
+    auto& [a, b, c, d, e, f, g, h] = v;
+
+    for (auto i = std::size_t{0}; i < w.size(); ++i) {
+        const auto ch = Ops::Xor(Ops::And(e, f), Ops::AndNot(e, g));
+        const auto maj =
+            Ops::Or(Ops::And(a, b), Ops::And(c, Ops::Or(a, b)));
+        const auto t1 = Ops::Add(
+            Ops::Add(h, S1(e)),
+            Ops::Add(ch, Ops::Add(Ops::Set(k_[i]), w[i])));
+        const auto t2 = Ops::Add(S0(a), maj);
+        h = g;
+        g = f;
+        f = e;
+        e = Ops::Add(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = Ops::Add(t1, t2);
+    }
+
+    for (auto i = std::size_t{0}; i < v.size(); ++i) {
+        auto* out = state + (i * lanes);
+        Ops::StoreState(out, Ops::Add(Ops::LoadState(out), v[i]));
+    }
+}
+}  // namespace opentxs::crypto::sha256
@@ -0,0 +1,105 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// NOTE this file must be compiled with -msse4.1
+
+#include "0_stdafx.hpp"               // IWYU pragma: associated
+#include "1_Internal.hpp"             // IWYU pragma: associated
+#include "crypto/library/Sha256.hpp"  // IWYU pragma: associated
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "crypto/library/Sha256Lanes.hpp"
+
+namespace opentxs::crypto::sha256
+{
+namespace
+{
+struct SSE41 {
+    using Vector = __m128i;
+
+    static constexpr auto lanes_ = std::size_t{4};
+
+    static auto Add(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm_add_epi32(lhs, rhs);
+    }
+    static auto And(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm_and_si128(lhs, rhs);
+    }
+    // NOTE ~lhs & rhs
+    static auto AndNot(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm_andnot_si128(lhs, rhs);
+    }
+    // Loads four big endian words starting at offset from every lane and
+    // transposes them so that out[i] holds word i of all four lanes
+    static auto Load(
+        const Block* blocks,
+        std::size_t offset,
+        Vector* out) noexcept -> void
+    {
+        const auto swap =
+            _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+        const auto row = [&](std::size_t lane) {
+            return _mm_shuffle_epi8(
+                _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(blocks[lane] + offset)),
+                swap);
+        };
+        const auto r0 = row(0);
+        const auto r1 = row(1);
+        const auto r2 = row(2);
+        const auto r3 = row(3);
+        const auto t0 = _mm_unpacklo_epi32(r0, r1);
+        const auto t1 = _mm_unpacklo_epi32(r2, r3);
+        const auto t2 = _mm_unpackhi_epi32(r0, r1);
+        const auto t3 = _mm_unpackhi_epi32(r2, r3);
+        out[0] = _mm_unpacklo_epi64(t0, t1);
+        out[1] = _mm_unpackhi_epi64(t0, t1);
+        out[2] = _mm_unpacklo_epi64(t2, t3);
+        out[3] = _mm_unpackhi_epi64(t2, t3);
+    }
+    static auto LoadState(const std::uint32_t* in) noexcept -> Vector
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    }
+    static auto Or(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm_or_si128(lhs, rhs);
+    }
+    template <int N>
+    static auto Rotr(Vector x) noexcept -> Vector
+    {
+        return _mm_or_si128(_mm_srli_epi32(x, N), _mm_slli_epi32(x, 32 - N));
+    }
+    static auto Set(std::uint32_t value) noexcept -> Vector
+    {
+        return _mm_set1_epi32(static_cast<int>(value));
+    }
+    template <int N>
+    static auto Shr(Vector x) noexcept -> Vector
+    {
+        return _mm_srli_epi32(x, N);
+    }
+    static auto StoreState(std::uint32_t* out, Vector value) noexcept -> void
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), value);
+    }
+    static auto Xor(Vector lhs, Vector rhs) noexcept -> Vector
+    {
+        return _mm_xor_si128(lhs, rhs);
+    }
+};
+}  // namespace
+
+auto CompressSSE41(std::uint32_t* state, const Block* blocks) noexcept -> void
+{
+    CompressLanes<SSE41>(state, blocks);
+}
+}  // namespace opentxs::crypto::sha256
@@ -88,6 +88,7 @@ auto Primitives(const api::Crypto& crypto) noexcept
     -> std::unique_ptr<api::Primitives>;
 auto Settings(const api::Legacy& legacy, const String& path) noexcept
     -> std::unique_ptr<api::Settings>;
-auto ThreadPool(const opentxs::network::zeromq::Context& zmq) noexcept
+OPENTXS_EXPORT auto ThreadPool(
+    const opentxs::network::zeromq::Context& zmq) noexcept
     -> std::unique_ptr<api::internal::ThreadPool>;
 }  // namespace opentxs::factory
@@ -68,21 +68,57 @@ OPENTXS_EXPORT auto GolombDecode(
     const std::uint32_t N,
     const std::uint8_t P,
     const Space& encoded) noexcept(false) -> std::vector<std::uint64_t>;
+OPENTXS_EXPORT auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded) noexcept(false) -> std::vector<std::uint64_t>;
+// Bit at a time decoder retained as a reference for GolombDecode
+OPENTXS_EXPORT auto GolombDecodeReference(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Space& encoded) noexcept(false) -> std::vector<std::uint64_t>;
 OPENTXS_EXPORT auto GolombEncode(
     const std::uint8_t P,
     const std::vector<std::uint64_t>& hashedSet) noexcept(false) -> Space;
-auto HashToRange(
-    const api::Core& api,
-    const ReadView key,
+// Bit at a time encoder retained as a reference for GolombEncode
+OPENTXS_EXPORT auto GolombEncodeReference(
+    const std::uint8_t P,
+    const std::vector<std::uint64_t>& hashedSet) noexcept(false) -> Space;
+// Keyed SipHash-2-4. The key schedule is computed once at construction so a
+// single instance can hash every element of a filter.
+class OPENTXS_EXPORT SipHash
+{
+public:
+    auto operator()(const ReadView item) const noexcept -> std::uint64_t;
+
+    SipHash(const ReadView key) noexcept(false);
+
+    ~SipHash() = default;
+
+private:
+    std::array<std::uint64_t, 4> v_;
+
+    SipHash() = delete;
+    SipHash(const SipHash&) = delete;
+    SipHash(SipHash&&) = delete;
+    auto operator=(const SipHash&) -> SipHash& = delete;
+    auto operator=(SipHash&&) -> SipHash& = delete;
+};
+
+OPENTXS_EXPORT auto HashToRange(
+    const SipHash& hasher,
     const std::uint64_t range,
-    const ReadView item) noexcept(false) -> std::uint64_t;
-auto HashedSetConstruct(
-    const api::Core& api,
-    const ReadView key,
+    const ReadView item) noexcept -> std::uint64_t;
+// Hashes every item in order
+OPENTXS_EXPORT auto HashToRange(
+    const SipHash& hasher,
+    const std::uint64_t range,
+    const std::vector<ReadView>& items) noexcept -> std::vector<std::uint64_t>;
+OPENTXS_EXPORT auto HashedSetConstruct(
+    const SipHash& hasher,
     const std::uint32_t N,
     const std::uint32_t M,
-    const std::vector<ReadView> items) noexcept(false)
-    -> std::vector<std::uint64_t>;
+    const std::vector<ReadView>& items) noexcept -> std::vector<std::uint64_t>;
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::internal
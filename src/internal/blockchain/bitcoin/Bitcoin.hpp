@@ -122,6 +122,12 @@ struct OPENTXS_EXPORT EncodedTransaction {
         const api::Core& api,
         const blockchain::Type chain,
         const ReadView bytes) noexcept(false) -> EncodedTransaction;
+    // Returns the size of the transaction at the start of bytes without
+    // copying any inputs, outputs, or witnesses. The txid preimage of a
+    // segwit transaction is written to preimage. For other transactions
+    // preimage is left empty since the serialized transaction is the preimage.
+    static auto Scan(const ReadView bytes, Space& preimage) noexcept(false)
+        -> std::size_t;
 
     auto wtxid_preimage() const noexcept -> Space;
     auto txid_preimage() const noexcept -> Space;
@@ -135,6 +135,7 @@ auto BlockchainWallet(
 auto BlockOracle(
     const api::Core& api,
     const api::network::internal::Blockchain& network,
+    const blockchain::node::internal::Config& config,
     const blockchain::node::internal::Network& node,
     const blockchain::node::internal::HeaderOracle& header,
     const blockchain::node::internal::BlockDatabase& db,
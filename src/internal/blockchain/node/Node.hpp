@@ -7,6 +7,7 @@
 
 #include <boost/asio.hpp>
 #include <boost/thread/thread.hpp>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <future>
@@ -235,7 +236,8 @@ struct BlockOracle : virtual public node::BlockOracle {
 
     virtual auto GetBlockJob() const noexcept -> BlockJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
-    virtual auto SubmitBlock(const ReadView in) const noexcept -> void = 0;
+    // The block must already have been parsed and validated by the caller
+    virtual auto SubmitBlock(BitcoinBlock_p in) const noexcept -> void = 0;
     virtual auto Tip() const noexcept -> block::Position = 0;
 
     virtual auto Init() noexcept -> void = 0;
@@ -256,12 +258,19 @@ struct BlockValidator {
 };
 
 struct OPENTXS_EXPORT Config {
+    static constexpr auto default_block_cache_bytes_ =
+        std::size_t{64u * 1024u * 1024u};
+    static constexpr auto default_mempool_bytes_ =
+        std::size_t{64u * 1024u * 1024u};
+
     bool download_cfilters_{false};
     bool generate_cfilters_{false};
     bool provide_sync_server_{false};
     bool use_sync_server_{false};
     bool disable_wallet_{false};
     std::string sync_endpoint_{};
+    std::size_t block_cache_bytes_{default_block_cache_bytes_};
+    std::size_t mempool_bytes_{default_mempool_bytes_};
 
     auto print() const noexcept -> std::string;
 };
@@ -366,6 +375,16 @@ struct HeaderDatabase {
     // Throws std::out_of_range if no block at that position
     virtual auto BestBlock(const block::Height position) const noexcept(false)
         -> block::pHash = 0;
+    // Returns best chain hashes starting at the specified height. Stops after
+    // the specified hash (if not blank) or limit (if not zero) is reached.
+    virtual auto BestBlocks(
+        const block::Height start,
+        const block::Hash& stop,
+        const std::size_t limit) const noexcept -> HashVector = 0;
+    // Returns -1 if the hash is not in the best chain
+    virtual auto BestHeight(const block::Hash& hash) const noexcept
+        -> block::Height = 0;
+    virtual auto BestPosition() const noexcept -> block::Position = 0;
     virtual auto CurrentBest() const noexcept
         -> std::unique_ptr<block::Header> = 0;
     virtual auto CurrentCheckpoint() const noexcept -> block::Position = 0;
@@ -392,14 +411,28 @@ struct HeaderDatabase {
 };
 
 struct Mempool {
+    struct Statistics {
+        std::size_t count_{};
+        // serialized size of all transactions
+        std::size_t bytes_{};
+        // satoshis per 1000 bytes of the next transaction to be evicted, or
+        // zero if the fee of that transaction is unknown because it spends an
+        // output which is neither in the mempool nor in the wallet
+        Amount min_fee_rate_{};
+    };
+
     virtual auto Dump() const noexcept -> std::set<std::string> = 0;
+    // Accepts either a txid or a wtxid
     virtual auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const block::bitcoin::Transaction> = 0;
+    virtual auto Stats() const noexcept -> Statistics = 0;
     virtual auto Submit(ReadView txid) const noexcept -> bool = 0;
     virtual auto Submit(const std::vector<ReadView>& txids) const noexcept
         -> std::vector<bool> = 0;
     virtual auto Submit(std::unique_ptr<const block::bitcoin::Transaction> tx)
         const noexcept -> void = 0;
+    virtual auto Transactions() const noexcept
+        -> std::vector<std::shared_ptr<const block::bitcoin::Transaction>> = 0;
 
     virtual auto Heartbeat() noexcept -> void = 0;
 
@@ -422,10 +455,27 @@ struct PeerDatabase {
     virtual ~PeerDatabase() = default;
 };
 
+// Counters shared by all peers of a chain which describe the effectiveness of
+// BIP152 compact block relay
+struct CompactBlockStatistics {
+    // Peers which have been asked to announce new blocks with cmpctblock
+    std::atomic<std::size_t> high_bandwidth_peers_{0};
+    std::atomic<std::size_t> received_{0};
+    // Blocks reconstructed without a getblocktxn round trip
+    std::atomic<std::size_t> reconstructed_{0};
+    std::atomic<std::size_t> round_trips_{0};
+    std::atomic<std::size_t> failed_{0};
+    std::atomic<std::size_t> transactions_{0};
+    std::atomic<std::size_t> from_mempool_{0};
+    // Full block size minus the size of all compact block messages
+    std::atomic<std::int64_t> bytes_saved_{0};
+};
+
 struct PeerManager {
     enum class Task : OTZMQWorkType {
         Shutdown = value(WorkType::Shutdown),
         Mempool = value(WorkType::BlockchainMempoolUpdated),
+        MempoolStats = value(WorkType::BlockchainMempoolStats),
         Register = value(WorkType::AsioRegister),
         Connect = value(WorkType::AsioConnect),
         Disconnect = value(WorkType::AsioDisconnect),
@@ -452,6 +502,8 @@ struct PeerManager {
         -> bool = 0;
     virtual auto BroadcastTransaction(
         const block::bitcoin::Transaction& tx) const noexcept -> bool = 0;
+    virtual auto CompactBlocks() const noexcept
+        -> CompactBlockStatistics& = 0;
     virtual auto Connect() noexcept -> bool = 0;
     virtual auto Database() const noexcept -> const PeerDatabase& = 0;
     virtual auto Disconnect(const int id) const noexcept -> void = 0;
@@ -481,7 +533,6 @@ struct OPENTXS_EXPORT Network : virtual public node::Manager {
         SyncReply = value(WorkType::SyncReply),
         SyncNewBlock = value(WorkType::NewBlock),
         SubmitBlockHeader = OT_ZMQ_INTERNAL_SIGNAL + 0,
-        SubmitBlock = OT_ZMQ_INTERNAL_SIGNAL + 2,
         Heartbeat = OT_ZMQ_INTERNAL_SIGNAL + 3,
         SendToAddress = OT_ZMQ_INTERNAL_SIGNAL + 4,
         SendToPaymentCode = OT_ZMQ_INTERNAL_SIGNAL + 5,
@@ -535,8 +586,10 @@ struct OPENTXS_EXPORT Network : virtual public node::Manager {
 struct SyncDatabase {
     using Height = block::Height;
     using Items = std::vector<network::blockchain::sync::Block>;
-    using Message = network::blockchain::sync::Data;
+    using Message = network::zeromq::Message;
 
+    // Appends the sync packets following the specified height to a message
+    // which already contains the reply header
     virtual auto LoadSync(const Height height, Message& output) const noexcept
         -> bool = 0;
     virtual auto ReorgSync(const Height height) const noexcept -> bool = 0;
@@ -0,0 +1,42 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Version.hpp"
+
+namespace opentxs::crypto::sha256
+{
+constexpr auto digest_bytes_ = std::size_t{32};
+
+// Number of messages hashed in parallel by each engine:
+//  Scalar: 1
+//  SSE41: 4
+//  AVX2: 8
+enum class Engine : std::uint8_t {
+    Scalar = 0,
+    SSE41 = 1,
+    AVX2 = 2,
+};
+
+// Hashes every input independently and writes the digests contiguously to
+// output, which must have room for inputs.size() * digest_bytes_. If twice is
+// true each digest is hashed again to produce double sha256.
+//
+// Returns false if the engine is not supported by this processor.
+OPENTXS_EXPORT auto Batch(
+    const Engine engine,
+    const std::vector<ReadView>& inputs,
+    const bool twice,
+    std::byte* output) noexcept -> bool;
+// The widest engine supported by this processor
+OPENTXS_EXPORT auto Best() noexcept -> Engine;
+OPENTXS_EXPORT auto Supported(const Engine engine) noexcept -> bool;
+}  // namespace opentxs::crypto::sha256
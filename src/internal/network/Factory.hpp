@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "Proto.hpp"
+#include "opentxs/Bytes.hpp"
 
 namespace opentxs
 {
@@ -34,6 +35,11 @@ auto ZMQFrame(std::size_t size) noexcept -> network::zeromq::Frame*;
 auto ZMQFrame(const void* data, const std::size_t size) noexcept
     -> network::zeromq::Frame*;
 auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame*;
+// Refers to the supplied bytes without copying them. The owner is kept alive
+// until the frame has been released by the zmq library.
+OPENTXS_EXPORT auto ZMQFrame(
+    std::shared_ptr<const void> owner,
+    const ReadView bytes) noexcept -> network::zeromq::Frame*;
 auto ZMQMessage() noexcept -> network::zeromq::Message*;
 auto ZMQMessage(const void* data, const std::size_t size) noexcept
     -> network::zeromq::Message*;
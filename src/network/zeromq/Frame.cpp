@@ -8,6 +8,7 @@
 #include "network/zeromq/Frame.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <utility>
 
 #include "internal/network/Factory.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -36,6 +37,12 @@ auto ZMQFrame(const ProtobufType& data) noexcept -> network::zeromq::Frame*
 {
     return new ReturnType(data);
 }
+
+auto ZMQFrame(std::shared_ptr<const void> owner, const ReadView bytes) noexcept
+    -> network::zeromq::Frame*
+{
+    return new ReturnType(std::move(owner), bytes);
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::network::zeromq::implementation
@@ -72,6 +79,27 @@ Frame::Frame(const void* data, const std::size_t bytes) noexcept
     }
 }
 
+Frame::Frame(std::shared_ptr<const void> owner, const ReadView bytes) noexcept
+    : zeromq::Frame()
+    , message_()
+{
+    OT_ASSERT(owner);
+
+    // NOTE zmq may release the message from one of its io threads after the
+    // frame object has been destroyed
+    auto* hint = new std::shared_ptr<const void>(std::move(owner));
+    const auto init = zmq_msg_init_data(
+        &message_,
+        const_cast<char*>(bytes.data()),
+        bytes.size(),
+        &Frame::release,
+        hint);
+
+    if (0 != init) { delete hint; }
+
+    OT_ASSERT(0 == init);
+}
+
 Frame::operator std::string() const noexcept { return std::string{Bytes()}; }
 
 auto Frame::Bytes() const noexcept -> ReadView
@@ -86,5 +114,10 @@ auto Frame::clone() const noexcept -> Frame*
     return new Frame(zmq_msg_data(&message_), zmq_msg_size(&message_));
 }
 
+auto Frame::release(void*, void* hint) noexcept -> void
+{
+    delete static_cast<std::shared_ptr<const void>*>(hint);
+}
+
 Frame::~Frame() { zmq_msg_close(&message_); }
 }  // namespace opentxs::network::zeromq::implementation
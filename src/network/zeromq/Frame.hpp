@@ -8,6 +8,7 @@
 #include <zmq.h>
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <string>
 
 #include "Proto.hpp"
@@ -45,16 +46,22 @@ private:
         const std::size_t) noexcept;
     friend network::zeromq::Frame* opentxs::factory::ZMQFrame(
         const ProtobufType&) noexcept;
+    friend network::zeromq::Frame* opentxs::factory::ZMQFrame(
+        std::shared_ptr<const void>,
+        const ReadView) noexcept;
     friend network::zeromq::Frame;
 
     mutable zmq_msg_t message_;
 
+    static auto release(void* data, void* hint) noexcept -> void;
+
     auto clone() const noexcept -> Frame* final;
 
     Frame() noexcept;
     explicit Frame(const ProtobufType& input) noexcept;
     explicit Frame(const std::size_t bytes) noexcept;
     Frame(const void* data, const std::size_t bytes) noexcept;
+    Frame(std::shared_ptr<const void> owner, const ReadView bytes) noexcept;
     Frame(const Frame&) = delete;
     Frame(Frame&&) = delete;
     auto operator=(Frame&&) -> Frame& = delete;
@@ -8,11 +8,13 @@
 #include "server/MessageProcessor.hpp"  // IWYU pragma: associated
 
 #include <chrono>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include "Proto.tpp"
@@ -38,10 +40,7 @@
 #include "opentxs/network/zeromq/FrameSection.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/ReplyCallback.hpp"
-#include "opentxs/network/zeromq/socket/Dealer.hpp"
 #include "opentxs/network/zeromq/socket/Pull.hpp"
-#include "opentxs/network/zeromq/socket/Reply.hpp"
 #include "opentxs/network/zeromq/socket/Router.hpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "opentxs/otx/Reply.hpp"
@@ -52,6 +51,7 @@
 #include "opentxs/protobuf/ServerReply.pb.h"
 #include "opentxs/protobuf/ServerRequest.pb.h"
 #include "opentxs/protobuf/verify/ServerRequest.hpp"
+#include "server/ResourceLocks.hpp"
 #include "server/Server.hpp"
 #include "server/UserCommandProcessor.hpp"
 
@@ -66,7 +66,8 @@ namespace opentxs::server
 MessageProcessor::MessageProcessor(
     Server& server,
     const PasswordPrompt& reason,
-    const Flag& running)
+    const Flag& running,
+    const std::size_t workers)
     : server_(server)
     , reason_(reason)
     , running_(running)
@@ -77,20 +78,6 @@ MessageProcessor::MessageProcessor(
     , frontend_socket_(server_.API().Network().ZeroMQ().RouterSocket(
           frontend_callback_,
           zmq::socket::Socket::Direction::Bind))
-    , backend_callback_(zmq::ReplyCallback::Factory(
-          [=](const zmq::Message& incoming) -> OTZMQMessage {
-              return this->process_backend(incoming);
-          }))
-    , backend_socket_(server_.API().Network().ZeroMQ().ReplySocket(
-          backend_callback_,
-          zmq::socket::Socket::Direction::Bind))
-    , internal_callback_(zmq::ListenCallback::Factory(
-          [=](const zmq::Message& incoming) -> void {
-              this->process_internal(incoming);
-          }))
-    , internal_socket_(server_.API().Network().ZeroMQ().DealerSocket(
-          internal_callback_,
-          zmq::socket::Socket::Direction::Connect))
     , notification_callback_(zmq::ListenCallback::Factory(
           [=](const zmq::Message& incoming) -> void {
               this->process_notification(incoming);
@@ -99,17 +86,24 @@ MessageProcessor::MessageProcessor(
           notification_callback_,
           zmq::socket::Socket::Direction::Bind))
     , thread_()
-    , internal_endpoint_(
-          std::string("inproc://opentxs/notary/") + Identifier::Random()->str())
+    , workers_()
+    , shutdown_(false)
+    , notary_lock_()
     , counter_lock_()
     , drop_incoming_(0)
     , drop_outgoing_(0)
     , active_connections_()
     , connection_map_lock_()
 {
-    auto bound = backend_socket_->Start(internal_endpoint_);
-    bound &= internal_socket_->Start(internal_endpoint_);
-    bound &= notification_socket_->Start(
+    OT_ASSERT(0u < workers);
+
+    workers_.reserve(workers);
+
+    for (auto i = std::size_t{0}; i < workers; ++i) {
+        workers_.emplace_back(std::make_unique<Worker>());
+    }
+
+    const auto bound = notification_socket_->Start(
         server_.API().Endpoints().InternalPushNotification());
 
     OT_ASSERT(bound);
@@ -136,8 +130,18 @@ void MessageProcessor::cleanup()
 {
     frontend_socket_->Close();
     notification_socket_->Close();
-    internal_socket_->Close();
-    backend_socket_->Close();
+    shutdown_.store(true);
+
+    for (auto& worker : workers_) {
+        {
+            auto lock = Lock{worker->lock_};
+            worker->queue_.clear();
+        }
+
+        worker->ready_.notify_all();
+
+        if (worker->thread_.joinable()) { worker->thread_.join(); }
+    }
 
     if (thread_.joinable()) { thread_.join(); }
 }
@@ -216,8 +220,9 @@ void MessageProcessor::run()
         const auto timeout = server_.ComputeTimeout();
 
         if (timeout.count() <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            Lock lock(lock_);
+            // NOTE cron locks the resources of each item as it processes it
+            // and only needs to exclude requests which run exclusively
+            auto lock = sLock{notary_lock_};
             server_.ProcessCron();
         }
 
@@ -225,11 +230,8 @@ void MessageProcessor::run()
     }
 }
 
-auto MessageProcessor::process_backend(const zmq::Message& incoming)
-    -> OTZMQMessage
+void MessageProcessor::process_backend(const zmq::Message& incoming)
 {
-    // ProcessCron and process_backend must not run simultaneously
-    Lock lock(lock_);
     std::string reply{};
 
     std::string messageString{};
@@ -243,8 +245,7 @@ auto MessageProcessor::process_backend(const zmq::Message& incoming)
 
     auto output = server_.API().Network().ZeroMQ().ReplyMessage(incoming);
     output->AddFrame(reply);
-
-    return output;
+    process_internal(output);
 }
 
 auto MessageProcessor::process_command(
@@ -298,7 +299,7 @@ void MessageProcessor::process_frontend(const zmq::Message& incoming)
     }
 }
 
-void MessageProcessor::process_internal(const zmq::Message& incoming)
+void MessageProcessor::process_internal(zmq::Message& reply)
 {
     Lock lock(counter_lock_);
 
@@ -309,7 +310,6 @@ void MessageProcessor::process_internal(const zmq::Message& incoming)
         --drop_outgoing_;
     } else {
         lock.unlock();
-        OTZMQMessage reply{incoming};
         const auto sent = frontend_socket_->Send(reply);
 
         if (sent) {
@@ -329,8 +329,17 @@ void MessageProcessor::process_legacy(
 {
     LogTrace(OT_METHOD)(__FUNCTION__)(": Processing request via ")(id.asHex())
         .Flush();
-    OTZMQMessage request{incoming};
-    internal_socket_->Send(request);
+    const auto key =
+        std::string_view{static_cast<const char*>(id.data()), id.size()};
+    auto& worker =
+        *workers_.at(std::hash<std::string_view>{}(key) % workers_.size());
+
+    {
+        auto lock = Lock{worker.lock_};
+        worker.queue_.emplace_back(incoming);
+    }
+
+    worker.ready_.notify_one();
 }
 
 auto MessageProcessor::process_message(
@@ -368,8 +377,26 @@ auto MessageProcessor::process_message(
 
     OT_ASSERT(false != bool(replymsg));
 
-    const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+    const auto processed = [&] {
+        auto& processor = server_.CommandProcessor();
+        const auto type = Message::Type(request->m_strCommand->Get());
+        auto resources = ResourceLocks::Resources{};
+
+        if (UserCommandProcessor::IsConcurrent(type)) {
+            auto lock = sLock{notary_lock_};
+
+            return processor.ProcessUserCommand(*request, *replymsg);
+        } else if (processor.LockedResources(*request, resources)) {
+            auto lock = sLock{notary_lock_};
+            const auto guard = server_.Locks().Lock(resources);
+
+            return processor.ProcessUserCommand(*request, *replymsg);
+        } else {
+            auto lock = eLock{notary_lock_};
+
+            return processor.ProcessUserCommand(*request, *replymsg);
+        }
+    }();
 
     if (false == processed) {
         LogDetail(OT_METHOD)(__FUNCTION__)(": Failed to process user command ")(
@@ -508,7 +535,32 @@ auto MessageProcessor::query_connection(const identifier::Nym& nymID) -> OTData
 
 void MessageProcessor::Start()
 {
+    for (auto& worker : workers_) {
+        worker->thread_ =
+            std::thread(&MessageProcessor::work, this, std::ref(*worker));
+    }
+
     thread_ = std::thread(&MessageProcessor::run, this);
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Processing requests with ")(
+        workers_.size())(" workers")
+        .Flush();
+}
+
+void MessageProcessor::work(Worker& worker)
+{
+    while (true) {
+        auto lock = Lock{worker.lock_};
+        worker.ready_.wait(lock, [&] {
+            return shutdown_.load() || (false == worker.queue_.empty());
+        });
+
+        if (shutdown_.load()) { return; }
+
+        auto request = std::move(worker.queue_.front());
+        worker.queue_.pop_front();
+        lock.unlock();
+        process_backend(request);
+    }
 }
 
 MessageProcessor::~MessageProcessor() { cleanup(); }
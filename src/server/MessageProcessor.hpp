@@ -6,25 +6,25 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "Proto.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Identifier.hpp"
-#include "opentxs/core/Lockable.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
-#include "opentxs/network/zeromq/ReplyCallback.hpp"
-#include "opentxs/network/zeromq/socket/Dealer.hpp"
 #include "opentxs/network/zeromq/socket/Pull.hpp"
 #include "opentxs/network/zeromq/socket/Push.hpp"
-#include "opentxs/network/zeromq/socket/Reply.hpp"
 #include "opentxs/network/zeromq/socket/Router.hpp"
 #include "opentxs/network/zeromq/socket/Sender.tpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
@@ -58,7 +58,17 @@ class Secret;
 
 namespace opentxs::server
 {
-class MessageProcessor final : Lockable
+// Legacy requests are distributed across a fixed set of worker threads. All
+// requests which arrive on the same connection are handled by the same worker
+// so that they are processed in order.
+//
+// Requests which only read state or touch the context of the requesting nym
+// hold the notary lock in shared mode and execute in parallel. Transfers,
+// inbox and nymbox processing, transaction number requests and nym messages
+// also hold it in shared mode, plus the resource locks of every account and
+// nym they modify. Cron holds it in shared mode and locks the resources of
+// each item it processes. Every other request holds it exclusively.
+class MessageProcessor final
 {
 public:
     void DropIncoming(const int count) const;
@@ -68,27 +78,34 @@ public:
     void init(const bool inproc, const int port, const Secret& privkey);
     void Start();
 
-    explicit MessageProcessor(
+    MessageProcessor(
         Server& server,
         const PasswordPrompt& reason,
-        const Flag& running);
+        const Flag& running,
+        const std::size_t workers);
 
-    ~MessageProcessor() final;
+    ~MessageProcessor();
 
 private:
+    struct Worker {
+        std::mutex lock_{};
+        std::condition_variable ready_{};
+        std::deque<OTZMQMessage> queue_{};
+        std::thread thread_{};
+    };
+
     Server& server_;
     const PasswordPrompt& reason_;
     const Flag& running_;
     OTZMQListenCallback frontend_callback_;
     OTZMQRouterSocket frontend_socket_;
-    OTZMQReplyCallback backend_callback_;
-    OTZMQReplySocket backend_socket_;
-    OTZMQListenCallback internal_callback_;
-    OTZMQDealerSocket internal_socket_;
     OTZMQListenCallback notification_callback_;
     OTZMQPullSocket notification_socket_;
     std::thread thread_;
-    const std::string internal_endpoint_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> shutdown_;
+    // Held exclusively by requests which can not be assigned resource locks
+    std::shared_mutex notary_lock_;
     mutable std::mutex counter_lock_;
     mutable int drop_incoming_{0};
     mutable int drop_outgoing_{0};
@@ -105,13 +122,12 @@ private:
     void associate_connection(
         const identifier::Nym& nymID,
         const Data& connection);
-    auto process_backend(const network::zeromq::Message& incoming)
-        -> OTZMQMessage;
+    void process_backend(const network::zeromq::Message& incoming);
     auto process_command(
         const proto::ServerRequest& request,
         identifier::Nym& nymID) -> bool;
     void process_frontend(const network::zeromq::Message& incoming);
-    void process_internal(const network::zeromq::Message& incoming);
+    void process_internal(network::zeromq::Message& reply);
     void process_legacy(
         const Data& id,
         const network::zeromq::Message& incoming);
@@ -123,6 +139,7 @@ private:
         const network::zeromq::Message& incoming);
     auto query_connection(const identifier::Nym& nymID) -> OTData;
     void run();
+    void work(Worker& worker);
 
     MessageProcessor() = delete;
 };
@@ -0,0 +1,56 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"              // IWYU pragma: associated
+#include "1_Internal.hpp"            // IWYU pragma: associated
+#include "server/ResourceLocks.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+
+#include "opentxs/Pimpl.hpp"
+
+namespace opentxs::server
+{
+ResourceLocks::ResourceLocks(const std::size_t shards) noexcept
+    : shards_(std::max(shards, std::size_t{1}))
+{
+}
+
+auto ResourceLocks::Lock(const Resources& resources) noexcept -> Guard
+{
+    auto indices = std::set<std::size_t>{};
+
+    for (const auto& id : resources) { indices.emplace(shard(id)); }
+
+    auto output = Guard{};
+    output.reserve(indices.size());
+
+    for (const auto index : indices) {
+        output.emplace_back(shards_.at(index));
+    }
+
+    return output;
+}
+
+auto ResourceLocks::LockAll() noexcept -> Guard
+{
+    auto output = Guard{};
+    output.reserve(shards_.size());
+
+    for (auto& mutex : shards_) { output.emplace_back(mutex); }
+
+    return output;
+}
+
+auto ResourceLocks::shard(const Identifier& id) const noexcept -> std::size_t
+{
+    const auto key =
+        std::string_view{static_cast<const char*>(id.data()), id.size()};
+
+    return std::hash<std::string_view>{}(key) % shards_.size();
+}
+}  // namespace opentxs::server
@@ -0,0 +1,50 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/core/Identifier.hpp"
+
+namespace opentxs::server
+{
+// Serializes requests and cron items which modify the files of the same
+// accounts or nyms.
+//
+// Every identifier maps to one of a fixed number of shards. A guard locks the
+// shards of every requested identifier in ascending order, so two guards
+// never wait on each other.
+class ResourceLocks
+{
+public:
+    using Resources = std::set<OTIdentifier>;
+    using Guard = std::vector<std::unique_lock<std::mutex>>;
+
+    static constexpr auto default_shards_ = std::size_t{256};
+
+    auto Lock(const Resources& resources) noexcept -> Guard;
+    // Excludes every other guard
+    auto LockAll() noexcept -> Guard;
+
+    ResourceLocks(const std::size_t shards = default_shards_) noexcept;
+
+    ~ResourceLocks() = default;
+
+private:
+    std::vector<std::mutex> shards_;
+
+    auto shard(const Identifier& id) const noexcept -> std::size_t;
+
+    ResourceLocks(const ResourceLocks&) = delete;
+    ResourceLocks(ResourceLocks&&) = delete;
+    auto operator=(const ResourceLocks&) -> ResourceLocks& = delete;
+    auto operator=(ResourceLocks&&) -> ResourceLocks& = delete;
+};
+}  // namespace opentxs::server
@@ -17,6 +17,7 @@
 
 #include "Proto.tpp"
 #include "core/OTStorage.hpp"
+#include "opentxs/Pimpl.hpp"
 #include "opentxs/SharedPimpl.hpp"
 #include "opentxs/api/Context.hpp"
 #include "opentxs/api/Endpoints.hpp"
@@ -43,8 +44,10 @@
 #include "opentxs/core/contract/ProtocolVersion.hpp"
 #include "opentxs/core/contract/ServerContract.hpp"
 #include "opentxs/core/cron/OTCron.hpp"
+#include "opentxs/core/cron/OTCronItem.hpp"
 #include "opentxs/core/crypto/NymParameters.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/core/recurring/OTAgreement.hpp"
 #include "opentxs/crypto/Envelope.hpp"
 #include "opentxs/crypto/Language.hpp"
 #include "opentxs/crypto/SeedStyle.hpp"
@@ -85,6 +88,7 @@ Server::Server(
     , notary_(*this, reason_, manager_)
     , transactor_(*this, reason_)
     , userCommandProcessor_(*this, reason_, manager_)
+    , locks_()
     , m_strWalletFilename(String::Factory())
     , m_bReadOnly(false)
     , m_bShutdownFlag(false)
@@ -120,33 +124,56 @@ void Server::ProcessCron()
 {
     if (!m_Cron->IsActivated()) return;
 
-    bool bAddedNumbers = false;
+    auto numbers = listOfLongNumbers{};
+    auto count = m_Cron->GetTransactionCount();
 
     // Cron requires transaction numbers in order to process.
     // So every time before I call Cron.Process(), I make sure to replenish
     // first.
-    while (m_Cron->GetTransactionCount() < OTCron::GetCronRefillAmount()) {
+    while (count < OTCron::GetCronRefillAmount()) {
         std::int64_t lTransNum = 0;
         bool bSuccess = transactor_.issueNextTransactionNumber(lTransNum);
 
         if (bSuccess) {
-            m_Cron->AddTransactionNumber(lTransNum);
-            bAddedNumbers = true;
+            numbers.push_back(lTransNum);
+            ++count;
         } else
             break;
     }
 
-    if (bAddedNumbers) { m_Cron->SaveCron(); }
+    // The new numbers are journaled rather than rewriting the cron file
+    m_Cron->AddTransactionNumbers(numbers);
 
-    m_Cron->ProcessCronItems();  // This needs to be called regularly for
-                                 // trades, markets, payment plans, etc to
-                                 // process.
+    // This needs to be called regularly for trades, markets, payment plans,
+    // etc to process. Each item runs while holding the locks of the accounts
+    // and nyms it modifies so that requests for other accounts continue.
+    m_Cron->ProcessCronItems([this](const auto& item, const auto& process) {
+        const auto guard = lock_cron_item(item);
+        process();
+    });
 
     // NOTE:  TODO:  OTHER RE-OCCURRING SERVER FUNCTIONS CAN GO HERE AS WELL!!
     //
     // Such as sweeping server accounts after expiration dates, etc.
 }
 
+auto Server::lock_cron_item(const OTCronItem& item) -> ResourceLocks::Guard
+{
+    const auto* agreement = dynamic_cast<const OTAgreement*>(&item);
+
+    // NOTE trades may fill against any offer in their market and smart
+    // contracts may move funds between the accounts of every party, so
+    // those exclude every other request which holds resource locks
+    if (nullptr == agreement) { return locks_.LockAll(); }
+
+    return locks_.Lock({
+        Identifier::Factory(agreement->GetSenderAcctID()),
+        Identifier::Factory(agreement->GetSenderNymID()),
+        Identifier::Factory(agreement->GetRecipientAcctID()),
+        Identifier::Factory(agreement->GetRecipientNymID()),
+    });
+}
+
 auto Server::GetServerID() const -> const identifier::Server&
 {
     return m_notaryID;
@@ -32,6 +32,7 @@
 #include "opentxs/network/zeromq/socket/Push.hpp"
 #include "server/MainFile.hpp"
 #include "server/Notary.hpp"
+#include "server/ResourceLocks.hpp"
 #include "server/Transactor.hpp"
 #include "server/UserCommandProcessor.hpp"
 
@@ -64,6 +65,7 @@ class Nym;
 }  // namespace identity
 
 class Data;
+class OTCronItem;
 class OTPassword;
 class PasswordPrompt;
 }  // namespace opentxs
@@ -103,6 +105,7 @@ public:
     auto GetNotary() -> Notary& { return notary_; }
     auto GetTransactor() -> Transactor& { return transactor_; }
     void Init(bool readOnly = false);
+    auto Locks() -> ResourceLocks& { return locks_; }
     auto LoadServerNym(const identifier::Nym& nymID) -> bool;
     void ProcessCron();
     auto SendInstrumentToNym(
@@ -133,6 +136,7 @@ private:
     Notary notary_;
     Transactor transactor_;
     UserCommandProcessor userCommandProcessor_;
+    ResourceLocks locks_;
     OTString m_strWalletFilename;
     // Used at least for whether or not to write to the PID.
     bool m_bReadOnly{false};
@@ -154,6 +158,7 @@ private:
         const -> OTZMQMessage;
 
     void CreateMainFile(bool& mainFileExists);
+    auto lock_cron_item(const OTCronItem& item) -> ResourceLocks::Guard;
     // Note: SendInstrumentToNym and SendMessageToNym CALL THIS.
     // They are higher-level, this is lower-level.
     auto DropMessageToNymbox(
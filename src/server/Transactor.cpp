@@ -40,42 +40,21 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
 {
 }
 
-/// Just as every request must be accompanied by a request number, so
-/// every transaction request must be accompanied by a transaction number.
-/// The request numbers can simply be incremented on both sides (per user.)
-/// But the transaction numbers must be issued by the server and they do
-/// not repeat from user to user. They are unique to transaction.
-///
-/// Users must ask the server to send them transaction numbers so that they
-/// can be used in transaction requests.
 auto Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber) -> bool
 {
-    // transactionNumber_ stores the last VALID AND ISSUED transaction number.
-    // So first, we increment that, since we don't want to issue the same number
-    // twice.
-    transactionNumber_++;
+    Lock lock(lock_);
 
-    // Next, we save it to file.
-    if (!server_.GetMainFile().SaveMainFile()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Error saving main server file.")
-            .Flush();
-        transactionNumber_--;
-        return false;
-    }
-
-    // SUCCESS?
-    // Now the server main file has saved the latest transaction number,
-    // NOW we set it onto the parameter and return true.
-    lTransactionNumber = transactionNumber_;
-    return true;
+    return issue_next_number(lock, lTransactionNumber);
 }
 
 auto Transactor::issueNextTransactionNumberToNym(
     otx::context::Client& context,
     TransactionNumber& lTransactionNumber) -> bool
 {
-    if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
+    Lock lock(lock_);
+
+    if (!issue_next_number(lock, lTransactionNumber)) { return false; }
 
     // Each Nym stores the transaction numbers that have been issued to it.
     // (On client AND server side.)
@@ -104,6 +83,40 @@ auto Transactor::issueNextTransactionNumberToNym(
     return true;
 }
 
+/// Just as every request must be accompanied by a request number, so
+/// every transaction request must be accompanied by a transaction number.
+/// The request numbers can simply be incremented on both sides (per user.)
+/// But the transaction numbers must be issued by the server and they do
+/// not repeat from user to user. They are unique to transaction.
+///
+/// Users must ask the server to send them transaction numbers so that they
+/// can be used in transaction requests.
+auto Transactor::issue_next_number(
+    const Lock& lock,
+    TransactionNumber& lTransactionNumber) -> bool
+{
+    OT_ASSERT(verify_lock(lock));
+
+    // transactionNumber_ stores the last VALID AND ISSUED transaction number.
+    // So first, we increment that, since we don't want to issue the same number
+    // twice.
+    transactionNumber_++;
+
+    // Next, we save it to file.
+    if (!server_.GetMainFile().SaveMainFile()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Error saving main server file.")
+            .Flush();
+        transactionNumber_--;
+        return false;
+    }
+
+    // SUCCESS?
+    // Now the server main file has saved the latest transaction number,
+    // NOW we set it onto the parameter and return true.
+    lTransactionNumber = transactionNumber_;
+    return true;
+}
+
 // Server stores a map of BASKET_ID to BASKET_ACCOUNT_ID.
 auto Transactor::addBasketAccountID(
     const Identifier& BASKET_ID,
@@ -13,6 +13,7 @@
 #include "opentxs/Types.hpp"
 #include "opentxs/core/Account.hpp"
 #include "opentxs/core/AccountList.hpp"
+#include "opentxs/core/Lockable.hpp"
 
 namespace opentxs
 {
@@ -41,7 +42,8 @@ class PasswordPrompt;
 
 namespace opentxs::server
 {
-class Transactor
+// Transaction numbers may be issued concurrently by requests and by cron
+class Transactor : Lockable
 {
 public:
     Transactor(Server& server, const PasswordPrompt& reason);
@@ -109,6 +111,9 @@ private:
     // The list of voucher accounts (see GetVoucherAccount below for details)
     AccountList voucherAccounts_;
 
+    auto issue_next_number(const Lock& lock, TransactionNumber& txNumber)
+        -> bool;
+
     Transactor() = delete;
 };
 }  // namespace opentxs::server
@@ -2688,6 +2688,67 @@ auto UserCommandProcessor::hash_check(
     return context.NymboxHashMatch();
 }
 
+auto UserCommandProcessor::inbox_resources(
+    const Message& request,
+    ResourceLocks::Resources& resources) const -> bool
+{
+    const auto nymID = identifier::Nym::Factory(request.m_strNymID);
+    const auto accountID = Identifier::Factory(request.m_strAcctID);
+    const auto serverID = identifier::Server::Factory(request.m_strNotaryID);
+    auto input{manager_.Factory().Ledger(nymID, accountID, serverID)};
+
+    OT_ASSERT(input);
+
+    // NOTE malformed requests are rejected without modifying any files
+    if (false ==
+        input->LoadLedgerFromString(String::Factory(request.m_ascPayload))) {
+        return true;
+    }
+
+    auto processInbox = input->GetTransaction(transactionType::processInbox);
+
+    if (false == bool(processInbox)) { return true; }
+
+    std::unique_ptr<Ledger> inbox{nullptr};
+
+    for (const auto& item : processInbox->GetItemList()) {
+        if (false == bool(item)) { continue; }
+
+        const auto type = item->GetType();
+
+        if ((itemType::acceptPending != type) &&
+            (itemType::rejectPending != type)) {
+            continue;
+        }
+
+        // NOTE accepting a pending transfer modifies the inbox and the outbox
+        // of the sending account
+        if (false == bool(inbox)) {
+            inbox = manager_.Factory().Ledger(nymID, accountID, serverID);
+
+            OT_ASSERT(inbox);
+
+            if (false == inbox->LoadInbox()) { return false; }
+        }
+
+        const auto pending = inbox->GetTransaction(item->GetReferenceToNum());
+
+        if (false == bool(pending)) { return false; }
+
+        auto serialized = String::Factory();
+        pending->GetReferenceString(serialized);
+        const auto original{manager_.Factory().Item(
+            serialized, serverID, pending->GetReferenceToNum())};
+
+        if (false == bool(original)) { return false; }
+
+        resources.emplace(
+            Identifier::Factory(original->GetPurportedAccountID()));
+    }
+
+    return true;
+}
+
 auto UserCommandProcessor::initialize_request_number(
     otx::context::Client& context) const -> RequestNumber
 {
@@ -2705,6 +2766,26 @@ auto UserCommandProcessor::initialize_request_number(
     return requestNumber;
 }
 
+auto UserCommandProcessor::IsConcurrent(const MessageType type) noexcept
+    -> bool
+{
+    switch (type) {
+        case MessageType::pingNotary:
+        case MessageType::getRequestNumber:
+        case MessageType::checkNym:
+        case MessageType::queryInstrumentDefinitions:
+        case MessageType::getInstrumentDefinition:
+        case MessageType::getMint: {
+
+            return true;
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
 auto UserCommandProcessor::isAdmin(const identifier::Nym& nymID) -> bool
 {
     const auto adminNym = ServerSettings::GetOverrideNymID();
@@ -2853,6 +2934,60 @@ auto UserCommandProcessor::load_outbox(
     return outbox;
 }
 
+auto UserCommandProcessor::LockedResources(
+    const Message& request,
+    ResourceLocks::Resources& resources) const -> bool
+{
+    auto add = [&](const String& id) {
+        if (id.Exists()) { resources.emplace(Identifier::Factory(id)); }
+    };
+    add(request.m_strNymID);
+
+    switch (Message::Type(request.m_strCommand->Get())) {
+        case MessageType::getTransactionNumbers:
+        case MessageType::processNymbox:
+        case MessageType::getNymbox: {
+
+            return true;
+        }
+        case MessageType::getAccountData:
+        case MessageType::getBoxReceipt: {
+            add(request.m_strAcctID);
+
+            return true;
+        }
+        case MessageType::sendNymMessage: {
+            add(request.m_strNymID2);
+
+            return true;
+        }
+        case MessageType::getMarketList:
+        case MessageType::getMarketOffers:
+        case MessageType::getMarketRecentTrades:
+        case MessageType::getNymMarketOffers: {
+            // NOTE markets are only modified by cron while it holds every lock
+            // or by requests which are processed exclusively
+            add(request.m_strNotaryID);
+
+            return true;
+        }
+        case MessageType::notarizeTransaction: {
+            add(request.m_strAcctID);
+
+            return transfer_resources(request, resources);
+        }
+        case MessageType::processInbox: {
+            add(request.m_strAcctID);
+
+            return inbox_resources(request, resources);
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
 auto UserCommandProcessor::ProcessUserCommand(
     const Message& msgIn,
     Message& msgOut) -> bool
@@ -3127,6 +3262,49 @@ auto UserCommandProcessor::save_outbox(
     return true;
 }
 
+auto UserCommandProcessor::transfer_resources(
+    const Message& request,
+    ResourceLocks::Resources& resources) const -> bool
+{
+    const auto nymID = identifier::Nym::Factory(request.m_strNymID);
+    const auto accountID = Identifier::Factory(request.m_strAcctID);
+    const auto serverID = identifier::Server::Factory(request.m_strNotaryID);
+    auto input{manager_.Factory().Ledger(nymID, accountID, serverID)};
+
+    OT_ASSERT(input);
+
+    // NOTE malformed requests are rejected without modifying any files
+    if (false ==
+        input->LoadLedgerFromString(String::Factory(request.m_ascPayload))) {
+        return true;
+    }
+
+    auto add = [&](const Identifier& id) {
+        if (false == id.empty()) { resources.emplace(Identifier::Factory(id)); }
+    };
+
+    for (const auto& [number, transaction] : input->GetTransactionMap()) {
+        if (false == bool(transaction)) { continue; }
+
+        // NOTE every other transaction type may modify cron, markets, voucher
+        // accounts or the files of accounts which are not named in the request
+        if (transactionType::transfer != transaction->GetType()) {
+            return false;
+        }
+
+        add(transaction->GetPurportedAccountID());
+
+        for (const auto& item : transaction->GetItemList()) {
+            if (false == bool(item)) { continue; }
+
+            add(item->GetPurportedAccountID());
+            add(item->GetDestinationAcctID());
+        }
+    }
+
+    return true;
+}
+
 auto UserCommandProcessor::verify_box(
     const Identifier& ownerID,
     Ledger& box,
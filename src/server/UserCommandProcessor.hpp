@@ -13,6 +13,7 @@
 #include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Message.hpp"
+#include "server/ResourceLocks.hpp"
 
 namespace opentxs
 {
@@ -80,6 +81,10 @@ public:
         const Identifier& realNotaryID) -> bool;
     static auto check_server_lock(const identifier::Nym& nymID) -> bool;
     static auto isAdmin(const identifier::Nym& nymID) -> bool;
+    // Commands which only read state or modify the context of the requesting
+    // nym, and therefore may run in parallel with every other request which
+    // does not hold the notary lock exclusively
+    static auto IsConcurrent(const MessageType type) noexcept -> bool;
 
     void drop_reply_notice_to_nymbox(
         const api::Wallet& wallet,
@@ -89,6 +94,12 @@ public:
         otx::context::Client& context,
         Server& server) const;
 
+    // Returns false if the request must be processed exclusively. Otherwise
+    // resources contains the accounts and nyms whose files the request may
+    // modify.
+    auto LockedResources(
+        const Message& request,
+        ResourceLocks::Resources& resources) const -> bool;
     auto ProcessUserCommand(const Message& msgIn, Message& msgOut) -> bool;
 
 private:
@@ -179,6 +190,9 @@ private:
         const identity::Nym& serverNym) const -> std::unique_ptr<Ledger>;
     auto hash_check(const otx::context::Client& context, Identifier& nymboxHash)
         const -> bool;
+    auto inbox_resources(
+        const Message& request,
+        ResourceLocks::Resources& resources) const -> bool;
     auto initialize_request_number(otx::context::Client& context) const
         -> RequestNumber;
     auto load_inbox(
@@ -211,6 +225,9 @@ private:
         const identifier::Nym& senderNymID,
         const identifier::Nym& recipientNymID,
         const Message& msg) const -> bool;
+    auto transfer_resources(
+        const Message& request,
+        ResourceLocks::Resources& resources) const -> bool;
     auto verify_box(
         const Identifier& ownerID,
         Ledger& box,
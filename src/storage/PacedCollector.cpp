@@ -0,0 +1,153 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                // IWYU pragma: associated
+#include "1_Internal.hpp"              // IWYU pragma: associated
+#include "storage/PacedCollector.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+#define OT_METHOD "opentxs::storage::PacedCollector::"
+
+namespace opentxs::storage
+{
+PacedCollector::PacedCollector(
+    const Driver& from,
+    const bool collected,
+    const std::chrono::milliseconds slice,
+    const std::chrono::milliseconds rest) noexcept
+    : from_(from)
+    , collected_(collected)
+    , slice_(slice)
+    , rest_(rest)
+    , slice_start_(Clock::now())
+    , stats_()
+{
+    stats_.slices_ = 1;
+}
+
+auto PacedCollector::EmptyBucket(const bool bucket) const -> bool
+{
+    return from_.EmptyBucket(bucket);
+}
+
+auto PacedCollector::Load(
+    const std::string& key,
+    const bool checking,
+    std::string& value) const -> bool
+{
+    return from_.Load(key, checking, value);
+}
+
+auto PacedCollector::LoadFromBucket(
+    const std::string& key,
+    std::string& value,
+    const bool bucket) const -> bool
+{
+    return from_.LoadFromBucket(key, value, bucket);
+}
+
+auto PacedCollector::LoadRoot() const -> std::string
+{
+    return from_.LoadRoot();
+}
+
+auto PacedCollector::Migrate(const std::string& key, const Driver& to) const
+    -> bool
+{
+    if (key.empty()) { return false; }
+
+    pace();
+    const auto current = !collected_;
+    auto value = std::string{};
+
+    if (from_.LoadFromBucket(key, value, collected_)) {
+        if (false == to.Store(false, key, value, current)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Save failure.").Flush();
+
+            return false;
+        }
+
+        ++stats_.objects_;
+        stats_.bytes_ += value.size();
+
+        return true;
+    }
+
+    // NOTE objects which were rewritten after the collection started are
+    // only present in the current bucket
+    if (to.LoadFromBucket(key, value, current)) { return true; }
+
+    // NOTE the source driver may still be able to recover the object, for
+    // example the multiplex falls back to its backup plugins
+    if (from_.Migrate(key, to)) {
+        ++stats_.objects_;
+        ++stats_.recovered_;
+
+        return true;
+    }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Missing key.").Flush();
+
+    return false;
+}
+
+auto PacedCollector::pace() const noexcept -> void
+{
+    const auto now = Clock::now();
+    const auto elapsed = now - slice_start_;
+
+    if (elapsed < slice_) { return; }
+
+    stats_.longest_ = std::max(stats_.longest_, elapsed);
+    ++stats_.slices_;
+    Sleep(rest_);
+    slice_start_ = Clock::now();
+}
+
+auto PacedCollector::Stats() const noexcept -> Statistics
+{
+    auto output = stats_;
+    output.longest_ = std::max(output.longest_, Clock::now() - slice_start_);
+
+    return output;
+}
+
+auto PacedCollector::Store(
+    const bool isTransaction,
+    const std::string& key,
+    const std::string& value,
+    const bool bucket) const -> bool
+{
+    return from_.Store(isTransaction, key, value, bucket);
+}
+
+void PacedCollector::Store(
+    const bool isTransaction,
+    const std::string& key,
+    const std::string& value,
+    const bool bucket,
+    std::promise<bool>& promise) const
+{
+    from_.Store(isTransaction, key, value, bucket, promise);
+}
+
+auto PacedCollector::Store(
+    const bool isTransaction,
+    const std::string& value,
+    std::string& key) const -> bool
+{
+    return from_.Store(isTransaction, value, key);
+}
+
+auto PacedCollector::StoreRoot(const bool commit, const std::string& hash)
+    const -> bool
+{
+    return from_.StoreRoot(commit, hash);
+}
+}  // namespace opentxs::storage
@@ -0,0 +1,99 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <string>
+
+#include "opentxs/Version.hpp"
+#include "opentxs/api/storage/Driver.hpp"
+
+namespace opentxs::storage
+{
+// Wraps the driver used by garbage collection to walk the tree.
+//
+// This only paces the existing collection. Every live object is still
+// copied from the bucket being collected into the current bucket, but the
+// copy runs in slices of bounded duration. The collector rests between slices
+// so that it does not monopolize the storage backend. Reachability is not
+// tracked between collections.
+class OPENTXS_EXPORT PacedCollector final : public opentxs::api::storage::Driver
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Statistics {
+        std::size_t objects_{};
+        std::size_t bytes_{};
+        std::size_t recovered_{};
+        std::size_t slices_{};
+        Clock::duration longest_{};
+    };
+
+    static constexpr auto default_slice_ = std::chrono::milliseconds{20};
+    static constexpr auto default_rest_ = std::chrono::milliseconds{20};
+
+    auto EmptyBucket(const bool bucket) const -> bool final;
+    auto Load(const std::string& key, const bool checking, std::string& value)
+        const -> bool final;
+    auto LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const -> bool final;
+    auto LoadRoot() const -> std::string final;
+    // Copies the object from the collected bucket to the current bucket of
+    // the target driver whenever it is present in the collected bucket, even
+    // if it was also written to the current bucket after the collection
+    // started. Objects which are only present in the current bucket are not
+    // copied. Objects which are missing from both buckets are passed to the
+    // Migrate function of the source driver.
+    auto Migrate(const std::string& key, const Driver& to) const -> bool final;
+    auto Stats() const noexcept -> Statistics;
+    auto Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket) const -> bool final;
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final;
+    auto Store(
+        const bool isTransaction,
+        const std::string& value,
+        std::string& key) const -> bool final;
+    auto StoreRoot(const bool commit, const std::string& hash) const
+        -> bool final;
+
+    PacedCollector(
+        const Driver& from,
+        const bool collected,
+        const std::chrono::milliseconds slice = default_slice_,
+        const std::chrono::milliseconds rest = default_rest_) noexcept;
+
+    ~PacedCollector() final = default;
+
+private:
+    const Driver& from_;
+    const bool collected_;
+    const std::chrono::milliseconds slice_;
+    const std::chrono::milliseconds rest_;
+    mutable Clock::time_point slice_start_;
+    mutable Statistics stats_;
+
+    auto pace() const noexcept -> void;
+
+    PacedCollector() = delete;
+    PacedCollector(const PacedCollector&) = delete;
+    PacedCollector(PacedCollector&&) = delete;
+    auto operator=(const PacedCollector&) -> PacedCollector& = delete;
+    auto operator=(PacedCollector&&) -> PacedCollector& = delete;
+};
+}  // namespace opentxs::storage
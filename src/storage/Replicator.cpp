@@ -0,0 +1,172 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"            // IWYU pragma: associated
+#include "1_Internal.hpp"          // IWYU pragma: associated
+#include "storage/Replicator.hpp"  // IWYU pragma: associated
+
+#include <utility>
+
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+
+#define OT_METHOD "opentxs::storage::Replicator::"
+
+namespace opentxs::storage
+{
+Replicator::Replicator(const std::size_t limit) noexcept
+    : limit_(limit)
+    , lock_()
+    , queue_ready_()
+    , queue_space_()
+    , queue_()
+    , queue_bytes_(0)
+    , cb_()
+    , busy_(false)
+    , paused_(false)
+    , running_(false)
+    , thread_()
+{
+}
+
+auto Replicator::Enqueue(Job&& job) noexcept -> void
+{
+    {
+        auto lock = Lock{lock_};
+
+        if (false == running_) { return; }
+
+        const auto bytes = job.size();
+        auto full = [&] {
+            return (false == queue_.empty()) &&
+                   ((queue_bytes_ + bytes) > limit_);
+        };
+
+        if (full()) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(
+                ": Replication queue is full. Waiting for ")(queue_.size())(
+                " queued objects (")(queue_bytes_)(
+                " bytes) to be copied to backup plugins")
+                .Flush();
+            // NOTE the queue is drained during shutdown so space will
+            // eventually become available
+            queue_space_.wait(lock, [&] { return false == full(); });
+        }
+
+        if (false == running_) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Replicator stopped before the object could be queued")
+                .Flush();
+
+            return;
+        }
+
+        job.queued_ = Clock::now();
+        queue_bytes_ += bytes;
+        queue_.emplace_back(std::move(job));
+    }
+
+    queue_ready_.notify_one();
+}
+
+auto Replicator::Pause() noexcept -> void
+{
+    auto lock = Lock{lock_};
+    paused_ = true;
+    queue_space_.wait(lock, [&] { return false == busy_; });
+}
+
+auto Replicator::QueueBytes() const noexcept -> std::size_t
+{
+    auto lock = Lock{lock_};
+
+    return queue_bytes_;
+}
+
+auto Replicator::QueueDepth() const noexcept -> std::size_t
+{
+    auto lock = Lock{lock_};
+
+    return queue_.size();
+}
+
+auto Replicator::Resume() noexcept -> void
+{
+    {
+        auto lock = Lock{lock_};
+        paused_ = false;
+    }
+
+    queue_ready_.notify_all();
+}
+
+auto Replicator::run() noexcept -> void
+{
+    auto lock = Lock{lock_};
+    auto lastReport = Clock::now();
+    auto replicated = std::size_t{0};
+
+    while (true) {
+        // NOTE the queue is drained completely before shutting down
+        queue_ready_.wait(lock, [&] {
+            return (false == running_) ||
+                   ((false == paused_) && (false == queue_.empty()));
+        });
+
+        if (queue_.empty()) { return; }
+
+        const auto job = std::move(queue_.front());
+        queue_.pop_front();
+        queue_bytes_ -= job.size();
+        busy_ = true;
+        lock.unlock();
+        queue_space_.notify_all();
+        cb_(job);
+        ++replicated;
+        lock.lock();
+        busy_ = false;
+        queue_space_.notify_all();
+        const auto now = Clock::now();
+
+        if ((now - lastReport) < report_interval_) { continue; }
+
+        const auto lag = std::chrono::duration_cast<std::chrono::milliseconds>(
+            now - job.queued_);
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Copied ")(replicated)(
+            " objects to backup plugins. Replication lag: ")(lag.count())(
+            " milliseconds. Queue depth: ")(queue_.size())(" objects (")(
+            queue_bytes_)(" bytes)")
+            .Flush();
+        lastReport = now;
+        replicated = 0;
+    }
+}
+
+auto Replicator::Start(Callback cb) noexcept -> void
+{
+    auto lock = Lock{lock_};
+
+    if (running_ || thread_.joinable() || (false == bool(cb))) { return; }
+
+    cb_ = std::move(cb);
+    running_ = true;
+    thread_ = std::thread{&Replicator::run, this};
+}
+
+auto Replicator::Stop() noexcept -> void
+{
+    {
+        auto lock = Lock{lock_};
+        running_ = false;
+    }
+
+    queue_ready_.notify_all();
+    queue_space_.notify_all();
+
+    if (thread_.joinable()) { thread_.join(); }
+}
+
+Replicator::~Replicator() { Stop(); }
+}  // namespace opentxs::storage
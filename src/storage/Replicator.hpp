@@ -0,0 +1,88 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "opentxs/Version.hpp"
+
+namespace opentxs::storage
+{
+// Applies writes to backup plugins in the order they were queued, using a
+// dedicated thread which reads from a queue bounded by size in bytes.
+// Writers block while the queue is full. Stop drains the queue before the
+// thread exits.
+class OPENTXS_EXPORT Replicator
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Job {
+        enum class Type { Store, StoreRoot, EmptyBucket };
+
+        Type type_{Type::Store};
+        bool flag_{false};
+        bool bucket_{false};
+        std::string key_{};
+        std::string value_{};
+        Clock::time_point queued_{};
+
+        auto size() const noexcept -> std::size_t
+        {
+            return key_.size() + value_.size();
+        }
+    };
+
+    using Callback = std::function<void(const Job&)>;
+
+    static constexpr auto report_interval_ = std::chrono::seconds{30};
+
+    auto QueueBytes() const noexcept -> std::size_t;
+    auto QueueDepth() const noexcept -> std::size_t;
+
+    // Jobs are discarded if the replicator has not been started or has been
+    // stopped
+    auto Enqueue(Job&& job) noexcept -> void;
+    // Waits for the job in progress, if any, to finish and holds every queued
+    // job until Resume is called
+    auto Pause() noexcept -> void;
+    auto Resume() noexcept -> void;
+    auto Start(Callback cb) noexcept -> void;
+    auto Stop() noexcept -> void;
+
+    Replicator(const std::size_t limit) noexcept;
+
+    ~Replicator();
+
+private:
+    const std::size_t limit_;
+    mutable std::mutex lock_;
+    std::condition_variable queue_ready_;
+    std::condition_variable queue_space_;
+    std::deque<Job> queue_;
+    std::size_t queue_bytes_;
+    Callback cb_;
+    bool busy_;
+    bool paused_;
+    bool running_;
+    std::thread thread_;
+
+    auto run() noexcept -> void;
+
+    Replicator() = delete;
+    Replicator(const Replicator&) = delete;
+    Replicator(Replicator&&) = delete;
+    auto operator=(const Replicator&) -> Replicator& = delete;
+    auto operator=(Replicator&&) -> Replicator& = delete;
+};
+}  // namespace opentxs::storage
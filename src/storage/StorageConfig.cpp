@@ -10,6 +10,8 @@
 #include <chrono>
 #include <memory>
 
+#include "util/ByteLiterals.hpp"
+
 namespace C = std::chrono;
 
 namespace opentxs
@@ -19,6 +21,7 @@ StorageConfig::StorageConfig() noexcept
     , auto_publish_servers_(true)
     , auto_publish_units_(true)
     , gc_interval_(C::duration_cast<C::seconds>(C::hours(1)).count())
+    , replication_queue_bytes_(32_MiB)
     , path_()
     , dht_callback_()
     , primary_plugin_(default_plugin_)
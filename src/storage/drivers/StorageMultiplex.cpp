@@ -7,11 +7,13 @@
 #include "1_Internal.hpp"                        // IWYU pragma: associated
 #include "storage/drivers/StorageMultiplex.hpp"  // IWYU pragma: associated
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include "2_Factory.hpp"
@@ -26,6 +28,7 @@
 #include "storage/StorageConfig.hpp"
 #include "storage/tree/Root.hpp"
 #include "storage/tree/Tree.hpp"
+#include "util/ScopeGuard.hpp"
 
 #define OT_METHOD "opentxs::storage::implementation::StorageMultiplex::"
 
@@ -72,6 +75,8 @@ StorageMultiplex::StorageMultiplex(
     , digest_(hash)
     , random_(random)
     , null_(crypto::key::Symmetric::Factory())
+    , replication_lock_()
+    , replicator_(config.replication_queue_bytes_)
 {
     Init_StorageMultiplex(primary, migrate, previous);
 }
@@ -133,19 +138,16 @@ auto StorageMultiplex::BestRoot(bool& primaryOutOfSync) -> std::string
 
 void StorageMultiplex::Cleanup() { Cleanup_StorageMultiplex(); }
 
-void StorageMultiplex::Cleanup_StorageMultiplex() {}
+void StorageMultiplex::Cleanup_StorageMultiplex() { replicator_.Stop(); }
 
 auto StorageMultiplex::EmptyBucket(const bool bucket) const -> bool
 {
     OT_ASSERT(primary_plugin_);
 
-    for (const auto& plugin : backup_plugins_) {
-        OT_ASSERT(plugin);
-
-        plugin->EmptyBucket(bucket);
-    }
+    const auto output = primary_plugin_->EmptyBucket(bucket);
+    replicator_.Enqueue(Job{Job::Type::EmptyBucket, false, bucket, {}, {}, {}});
 
-    return primary_plugin_->EmptyBucket(bucket);
+    return output;
 }
 
 void StorageMultiplex::init(
@@ -192,7 +194,9 @@ void StorageMultiplex::InitBackup()
 {
     if (config_.fs_backup_directory_.empty()) { return; }
 
+    auto lock = Lock{replication_lock_};
     init_fs_backup(config_.fs_backup_directory_);
+    init_replication();
 }
 
 void StorageMultiplex::InitEncryptedBackup(
@@ -200,7 +204,16 @@ void StorageMultiplex::InitEncryptedBackup(
 {
     if (config_.fs_encrypted_backup_directory_.empty()) { return; }
 
+    auto lock = Lock{replication_lock_};
     init_fs_backup(config_.fs_encrypted_backup_directory_);
+    init_replication();
+}
+
+auto StorageMultiplex::init_replication() -> void
+{
+    if (backup_plugins_.empty()) { return; }
+
+    replicator_.Start([this](const auto& job) { replicate(job); });
 }
 
 auto StorageMultiplex::Load(
@@ -288,10 +301,18 @@ auto StorageMultiplex::LoadRoot() const -> std::string
 
 auto StorageMultiplex::Migrate(
     const std::string& key,
-    const opentxs::api::storage::Driver& to) const -> bool
+    const opentxs::api::storage::Driver& input) const -> bool
 {
     OT_ASSERT(primary_plugin_);
 
+    // NOTE backup plugins do not use buckets, so objects which are copied
+    // between buckets by garbage collection are written to the primary plugin
+    // only instead of being pushed through the replication queue
+    const auto& to = (&input == this)
+                         ? static_cast<const opentxs::api::storage::Driver&>(
+                               *primary_plugin_)
+                         : input;
+
     if (primary_plugin_->Migrate(key, to)) { return true; }
 
     for (const auto& plugin : backup_plugins_) {
@@ -354,6 +375,48 @@ auto StorageMultiplex::Primary() -> opentxs::api::storage::Driver&
     return *primary_plugin_;
 }
 
+auto StorageMultiplex::replicate(const Job& job) noexcept -> void
+{
+    const auto plugins = [&] {
+        auto out = std::vector<opentxs::api::storage::Plugin*>{};
+        auto lock = Lock{replication_lock_};
+
+        for (const auto& plugin : backup_plugins_) {
+            OT_ASSERT(plugin);
+
+            out.emplace_back(plugin.get());
+        }
+
+        return out;
+    }();
+
+    for (auto* plugin : plugins) {
+        auto success{false};
+
+        switch (job.type_) {
+            case Job::Type::Store: {
+                success =
+                    plugin->Store(job.flag_, job.key_, job.value_, job.bucket_);
+            } break;
+            case Job::Type::StoreRoot: {
+                success = plugin->StoreRoot(job.flag_, job.value_);
+            } break;
+            case Job::Type::EmptyBucket: {
+                success = plugin->EmptyBucket(job.bucket_);
+            } break;
+            default: {
+                OT_FAIL;
+            }
+        }
+
+        if (false == success) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to update backup plugin")
+                .Flush();
+        }
+    }
+}
+
 auto StorageMultiplex::Store(
     const bool isTransaction,
     const std::string& key,
@@ -362,25 +425,10 @@ auto StorageMultiplex::Store(
 {
     OT_ASSERT(primary_plugin_);
 
-    std::vector<std::promise<bool>> promises{};
-    std::vector<std::future<bool>> futures{};
-    promises.push_back(std::promise<bool>());
-    auto& primaryPromise = promises.back();
-    futures.push_back(primaryPromise.get_future());
-    primary_plugin_->Store(isTransaction, key, value, bucket, primaryPromise);
-
-    for (const auto& plugin : backup_plugins_) {
-        OT_ASSERT(plugin);
-
-        promises.push_back(std::promise<bool>());
-        auto& promise = promises.back();
-        futures.push_back(promise.get_future());
-        plugin->Store(isTransaction, key, value, bucket, promise);
-    }
-
-    bool output = false;
-
-    for (auto& future : futures) { output |= future.get(); }
+    const auto output =
+        primary_plugin_->Store(isTransaction, key, value, bucket);
+    replicator_.Enqueue(
+        Job{Job::Type::Store, isTransaction, bucket, key, value, {}});
 
     return output;
 }
@@ -399,17 +447,17 @@ void StorageMultiplex::Store(
 
 auto StorageMultiplex::Store(
     const bool isTransaction,
-    const std::string& key,
-    std::string& value) const -> bool
+    const std::string& value,
+    std::string& key) const -> bool
 {
     OT_ASSERT(primary_plugin_);
 
-    bool output = primary_plugin_->Store(isTransaction, key, value);
+    const bool bucket{primary_bucket_};
+    const auto output = primary_plugin_->Store(isTransaction, value, key);
 
-    for (const auto& plugin : backup_plugins_) {
-        OT_ASSERT(plugin);
-
-        output |= plugin->Store(isTransaction, key, value);
+    if (false == key.empty()) {
+        replicator_.Enqueue(
+        Job{Job::Type::Store, isTransaction, bucket, key, value, {}});
     }
 
     return output;
@@ -420,13 +468,10 @@ auto StorageMultiplex::StoreRoot(const bool commit, const std::string& hash)
 {
     OT_ASSERT(primary_plugin_);
 
-    for (const auto& plugin : backup_plugins_) {
-        OT_ASSERT(plugin);
-
-        plugin->StoreRoot(commit, hash);
-    }
+    const auto output = primary_plugin_->StoreRoot(commit, hash);
+    replicator_.Enqueue(Job{Job::Type::StoreRoot, commit, false, {}, hash, {}});
 
-    return primary_plugin_->StoreRoot(commit, hash);
+    return output;
 }
 
 void StorageMultiplex::SynchronizePlugins(
@@ -436,6 +481,11 @@ void StorageMultiplex::SynchronizePlugins(
 {
     const auto& tree = root.Tree();
 
+    // NOTE queued writes are held while out of sync plugins are restored from
+    // the tree and are then applied in order
+    replicator_.Pause();
+    auto postcondition = ScopeGuard{[&] { replicator_.Resume(); }};
+
     if (syncPrimary) {
         OT_ASSERT(primary_plugin_);
 
@@ -7,6 +7,7 @@
 
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -16,6 +17,7 @@
 #include "opentxs/api/storage/Driver.hpp"
 #include "opentxs/api/storage/Multiplex.hpp"
 #include "opentxs/crypto/key/Symmetric.hpp"
+#include "storage/Replicator.hpp"
 
 namespace opentxs
 {
@@ -41,6 +43,14 @@ class String;
 
 namespace opentxs::storage::implementation
 {
+// Writes are acknowledged as soon as the primary plugin has stored them.
+// Backup plugins are updated in the same order by a Replicator. Writers block
+// while its queue is full.
+//
+// The queue itself is not written to disk. If the process exits before the
+// queue is drained the root hash of the affected backups will not match the
+// primary and SynchronizePlugins will restore them from the tree on the next
+// start.
 class StorageMultiplex final : virtual public opentxs::api::storage::Multiplex
 {
 public:
@@ -87,6 +97,8 @@ public:
 private:
     friend Factory;
 
+    using Job = storage::Replicator::Job;
+
     const api::storage::Storage& storage_;
     const Flag& primary_bucket_;
     const StorageConfig& config_;
@@ -95,15 +107,19 @@ private:
     const Digest digest_;
     const Random random_;
     OTSymmetricKey null_;
+    mutable std::mutex replication_lock_;
+    mutable storage::Replicator replicator_;
 
     auto Cleanup() -> void;
     auto Cleanup_StorageMultiplex() -> void;
+    auto replicate(const Job& job) noexcept -> void;
     auto init(
         const std::string& primary,
         std::unique_ptr<opentxs::api::storage::Plugin>& plugin) -> void;
     auto init_fs(std::unique_ptr<opentxs::api::storage::Plugin>& plugin)
         -> void;
     auto init_fs_backup(const std::string& dir) -> void;
+    auto init_replication() -> void;
     auto init_lmdb(std::unique_ptr<opentxs::api::storage::Plugin>& plugin)
         -> void;
     auto init_memdb(std::unique_ptr<opentxs::api::storage::Plugin>& plugin)
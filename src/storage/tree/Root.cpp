@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"         // IWYU pragma: associated
 #include "storage/tree/Root.hpp"  // IWYU pragma: associated
 
+#include <chrono>
 #include <ctime>
 #include <functional>
 
@@ -16,6 +17,7 @@
 #include "opentxs/protobuf/Check.hpp"
 #include "opentxs/protobuf/StorageRoot.pb.h"
 #include "opentxs/protobuf/verify/StorageRoot.hpp"
+#include "storage/PacedCollector.hpp"
 #include "storage/Plugin.hpp"
 #include "storage/tree/Node.hpp"
 #include "storage/tree/Tree.hpp"
@@ -77,7 +79,13 @@ void Root::cleanup() const
 
 void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
 {
+    using Clock = PacedCollector::Clock;
+    namespace C = std::chrono;
+
     Lock lock(write_lock_);
+    // NOTE writers are only blocked while write_lock_ is held
+    auto locked = Clock::now();
+    auto paused = Clock::duration{};
     LogTrace(OT_METHOD)(__FUNCTION__)(": Beginning garbage collection.")
         .Flush();
     const auto resume = gc_resume_->Set(false);
@@ -92,14 +100,21 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
         driver_.StoreRoot(true, root_);
     }
 
+    paused += Clock::now() - locked;
     lock.unlock();
     bool success{false};
+    auto stats = PacedCollector::Statistics{};
+    const auto started = Clock::now();
 
     if (Node::check_hash(gc_root_)) {
-        const storage::Tree tree(driver_, gc_root_);
+        const PacedCollector collector(driver_, oldLocation);
+        const storage::Tree tree(collector, gc_root_);
         success = tree.Migrate(*to);
+        stats = collector.Stats();
     }
 
+    const auto elapsed = Clock::now() - started;
+
     if (success) {
         driver_.EmptyBucket(oldLocation);
     } else {
@@ -110,14 +125,24 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
 
     Lock gcLock(gc_lock_, std::defer_lock);
     std::lock(gcLock, lock);
+    locked = Clock::now();
     gc_running_->Off();
     gc_root_ = "";
     last_gc_.store(std::time(nullptr));
     save(lock);
     driver_.StoreRoot(true, root_);
+    paused += Clock::now() - locked;
     lock.unlock();
     gcLock.unlock();
-    LogTrace(OT_METHOD)(__FUNCTION__)(": Finished garbage collection.").Flush();
+    LogDetail(OT_METHOD)(__FUNCTION__)(": Garbage collection copied ")(
+        stats.objects_)(" live objects (")(stats.bytes_)(" bytes, ")(
+        stats.recovered_)(" recovered from the source driver) in ")(
+        C::duration_cast<C::milliseconds>(elapsed).count())(
+        " milliseconds using ")(stats.slices_)(" slices. Longest slice: ")(
+        C::duration_cast<C::milliseconds>(stats.longest_).count())(
+        " milliseconds. Writers paused for ")(
+        C::duration_cast<C::milliseconds>(paused).count())(" milliseconds.")
+        .Flush();
 }
 
 void Root::init(const std::string& hash)
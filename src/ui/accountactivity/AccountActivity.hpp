@@ -246,6 +246,7 @@ private:
     friend Worker<AccountActivity>;
 
     virtual auto startup() noexcept -> void = 0;
+    virtual auto state_machine() noexcept -> bool { return false; }
 
     auto construct_row(
         const AccountActivityRowID& id,
@@ -23,9 +23,6 @@
 #include "opentxs/api/client/Contacts.hpp"
 #include "opentxs/api/client/PaymentWorkflowType.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
-#if OT_BLOCKCHAIN
-#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
-#endif  // OT_BLOCKCHAIN
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
@@ -61,14 +58,6 @@ auto BalanceItem(
 {
 #if OT_BLOCKCHAIN
     if (2 < custom.size()) {
-        using Transaction = opentxs::blockchain::block::bitcoin::Transaction;
-
-        auto pTx =
-            ui::implementation::extract_custom_ptr<Transaction>(custom, 2);
-
-        OT_ASSERT(pTx);
-
-        const auto& tx = *pTx;
 
         return std::make_shared<ui::implementation::BlockchainBalanceItem>(
             parent,
@@ -80,8 +69,8 @@ auto BalanceItem(
             accountID,
             ui::implementation::extract_custom<blockchain::Type>(custom, 3),
             ui::implementation::extract_custom<OTData>(custom, 5),
-            tx.NetBalanceChange(api.Blockchain(), nymID),
-            tx.Memo(api.Blockchain()),
+            ui::implementation::extract_custom<opentxs::Amount>(custom, 2),
+            ui::implementation::extract_custom<std::string>(custom, 6),
             ui::implementation::extract_custom<std::string>(custom, 4));
     }
 #endif  // OT_BLOCKCHAIN
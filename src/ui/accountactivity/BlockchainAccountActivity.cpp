@@ -7,14 +7,19 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "ui/accountactivity/BlockchainAccountActivity.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <atomic>
+#include <ctime>
 #include <functional>
 #include <future>
 #include <limits>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "display/Definition.hpp"
 #include "internal/blockchain/Blockchain.hpp"
@@ -48,6 +53,8 @@
 #include "opentxs/protobuf/PaymentEvent.pb.h"
 #include "opentxs/protobuf/PaymentWorkflow.pb.h"
 #include "opentxs/protobuf/PaymentWorkflowEnums.pb.h"
+#include "opentxs/protobuf/StorageThread.pb.h"
+#include "opentxs/protobuf/StorageThreadItem.pb.h"
 #include "ui/base/Widget.hpp"
 #include "util/Container.hpp"
 
@@ -73,6 +80,14 @@ auto BlockchainAccountActivityModel(
 
 namespace opentxs::ui::implementation
 {
+BlockchainAccountActivity::CachedSummary::CachedSummary(
+    const Summary& summary) noexcept
+    : time_(summary.time_)
+    , amount_(summary.amount_)
+    , text_(std::hash<std::string>{}(summary.memo_ + '\n' + summary.text_))
+{
+}
+
 BlockchainAccountActivity::BlockchainAccountActivity(
     const api::client::internal::Manager& api,
     const blockchain::Type chain,
@@ -96,6 +111,11 @@ BlockchainAccountActivity::BlockchainAccountActivity(
           zmq::socket::Socket::Direction::Connect))
     , progress_()
     , sync_cb_()
+    , summaries_()
+    , other_chains_()
+    , pending_()
+    , unloaded_(0)
+    , fetch_(false)
 {
     const auto connected =
         balance_socket_->Start(Widget::api_.Endpoints().BlockchainBalance());
@@ -116,6 +136,26 @@ BlockchainAccountActivity::BlockchainAccountActivity(
     }
 }
 
+auto BlockchainAccountActivity::add_row(
+    const Data& txid,
+    const Summary& summary) noexcept -> void
+{
+    auto custom = CustomData{
+        new proto::PaymentWorkflow(),
+        new proto::PaymentEvent(),
+        new Amount{summary.amount_},
+        new blockchain::Type{chain_},
+        new std::string{summary.text_},
+        new OTData{txid},
+        new std::string{summary.memo_}};
+    add_item(row_id(txid), summary.time_, custom);
+}
+
+auto BlockchainAccountActivity::can_fetch_more() const noexcept -> bool
+{
+    return 0u < unloaded_.load();
+}
+
 auto BlockchainAccountActivity::DepositAddress(
     const blockchain::Type chain) const noexcept -> std::string
 {
@@ -138,19 +178,91 @@ auto BlockchainAccountActivity::DisplayBalance() const noexcept -> std::string
     return blockchain::internal::Format(chain_, balance_.load());
 }
 
+auto BlockchainAccountActivity::fetch_more() const noexcept -> void
+{
+    if (0u == unloaded_.load()) { return; }
+
+    // NOTE only one page is loaded no matter how many requests arrive before
+    // the pipeline gets to it
+    if (false == fetch_.exchange(true)) { trigger(); }
+}
+
+auto BlockchainAccountActivity::load_page() noexcept -> void
+{
+    // NOTE a new transaction notification may have created the row for a
+    // queued transaction
+    const auto page = pending_.next(
+        page_size_, [this](const auto& txid) { return skip(txid); });
+
+    for (const auto& txid : page) { process_txid(txid); }
+
+    unloaded_.store(pending_.size());
+}
+
+// Rows which are already present are left alone since every change to an
+// existing transaction arrives as a txid notification. Transactions which have
+// never been loaded are queued, most recent first. Only the first page is
+// loaded here, the rest are loaded one page at a time when a view scrolls to
+// the end of the model or a native consumer iterates past the last row, so
+// the memory used by the model depends on how much of the history has been
+// read rather than on the size of the account.
 auto BlockchainAccountActivity::load_thread() noexcept -> void
 {
     const auto transactions =
         Widget::api_.Storage().BlockchainTransactionList(primary_id_);
+    const auto listed =
+        std::set<OTData>(transactions.begin(), transactions.end());
     auto active = std::set<AccountActivityRowID>{};
+    auto unloaded = std::vector<OTData>{};
 
-    for (const auto& txid : transactions) {
-        if (const auto id = process_txid(txid); id.has_value()) {
-            active.emplace(id.value());
+    for (auto i = other_chains_.begin(); i != other_chains_.end();) {
+        if (0 == listed.count(*i)) {
+            i = other_chains_.erase(i);
+        } else {
+            ++i;
+        }
+    }
+
+    for (auto i = summaries_.begin(); i != summaries_.end();) {
+        if (0 == listed.count(i->first)) {
+            i = summaries_.erase(i);
+        } else {
+            ++i;
         }
     }
 
+    for (const auto& txid : transactions) {
+        active.emplace(row_id(txid));
+
+        if (false == skip(txid)) { unloaded.emplace_back(txid); }
+    }
+
     delete_inactive(active);
+
+    if (unloaded.empty()) {
+        pending_.clear();
+        unloaded_.store(0);
+
+        return;
+    }
+
+    const auto times = transaction_times();
+    auto entries = std::vector<std::pair<OTData, Time>>{};
+    entries.reserve(unloaded.size());
+
+    for (auto& txid : unloaded) {
+        const auto i = times.find(row_id(txid).first->str());
+        const auto time = (times.end() == i) ? Time{} : i->second;
+        entries.emplace_back(std::move(txid), time);
+    }
+
+    pending_.reset(std::move(entries));
+
+    if (summaries_.size() < page_size_) {
+        load_page();
+    } else {
+        unloaded_.store(pending_.size());
+    }
 }
 
 auto BlockchainAccountActivity::pipeline(const Message& in) noexcept -> void
@@ -279,29 +391,47 @@ auto BlockchainAccountActivity::process_txid(const Message& in) noexcept -> void
 auto BlockchainAccountActivity::process_txid(const Data& txid) noexcept
     -> std::optional<AccountActivityRowID>
 {
-    const auto rowID = AccountActivityRowID{
-        blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
-        proto::PAYMENTEVENTTYPE_COMPLETE};
-    auto pTX = Widget::api_.Blockchain().LoadTransactionBitcoin(txid);
+    const auto pTX = Widget::api_.Blockchain().LoadTransactionBitcoin(txid);
 
     if (false == bool(pTX)) { return std::nullopt; }
 
     const auto& tx = *pTX;
 
-    if (false == contains(tx.Chains(), chain_)) { return std::nullopt; }
+    if (false == contains(tx.Chains(), chain_)) {
+        other_chains_.emplace(txid);
 
-    const auto sortKey{tx.Timestamp()};
-    auto custom = CustomData{
-        new proto::PaymentWorkflow(),
-        new proto::PaymentEvent(),
-        const_cast<void*>(static_cast<const void*>(pTX.release())),
-        new blockchain::Type{chain_},
-        new std::string{Widget::api_.Blockchain().ActivityDescription(
-            primary_id_, chain_, tx)},
-        new OTData{tx.ID()}};
-    add_item(rowID, sortKey, custom);
+        return std::nullopt;
+    }
+
+    const auto& api = Widget::api_.Blockchain();
+    const auto summary = Summary{
+        tx.Timestamp(),
+        tx.NetBalanceChange(api, primary_id_),
+        tx.Memo(api),
+        api.ActivityDescription(primary_id_, chain_, tx)};
+    const auto cached = CachedSummary{summary};
+    auto it = summaries_.find(txid);
+
+    if (summaries_.end() == it) {
+        summaries_.emplace(txid, cached);
+    } else if (it->second == cached) {
+
+        return row_id(txid);
+    } else {
+        it->second = cached;
+    }
+
+    add_row(txid, summary);
 
-    return std::move(rowID);
+    return row_id(txid);
+}
+
+auto BlockchainAccountActivity::row_id(const Data& txid) const noexcept
+    -> AccountActivityRowID
+{
+    return {
+        blockchain_thread_item_id(Widget::api_.Crypto(), chain_, txid),
+        proto::PAYMENTEVENTTYPE_COMPLETE};
 }
 
 auto BlockchainAccountActivity::Send(
@@ -381,8 +511,50 @@ auto BlockchainAccountActivity::SetSyncCallback(const SyncCallback cb) noexcept
     sync_cb_.cb_ = cb;
 }
 
+auto BlockchainAccountActivity::skip(const Data& txid) const noexcept -> bool
+{
+    return (0 < other_chains_.count(txid)) || (0 < summaries_.count(txid));
+}
+
 auto BlockchainAccountActivity::startup() noexcept -> void { load_thread(); }
 
+auto BlockchainAccountActivity::state_machine() noexcept -> bool
+{
+    if (fetch_.exchange(false)) { load_page(); }
+
+    return false;
+}
+
+// NOTE activity threads record the timestamp of every blockchain transaction
+// which involves a contact, which is much cheaper to read than the
+// transactions themselves. Transactions which do not appear in any thread are
+// loaded after the others.
+auto BlockchainAccountActivity::transaction_times() const noexcept
+    -> std::map<std::string, Time>
+{
+    const auto& storage = Widget::api_.Storage();
+    const auto nym = primary_id_->str();
+    auto output = std::map<std::string, Time>{};
+
+    for (const auto& [threadID, alias] : storage.ThreadList(nym, false)) {
+        auto thread = proto::StorageThread{};
+
+        if (false == storage.Load(nym, threadID, thread)) { continue; }
+
+        for (const auto& item : thread.item()) {
+            if (StorageBox::BLOCKCHAIN != static_cast<StorageBox>(item.box())) {
+                continue;
+            }
+
+            output.emplace(
+                item.id(),
+                Clock::from_time_t(static_cast<std::time_t>(item.time())));
+        }
+    }
+
+    return output;
+}
+
 auto BlockchainAccountActivity::ValidateAddress(
     const std::string& in) const noexcept -> bool
 {
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <set>
@@ -42,6 +44,7 @@
 #include "ui/accountactivity/SendMonitor.hpp"
 #endif  // OT_QT
 #include "ui/base/List.hpp"
+#include "ui/base/RowQueue.hpp"
 #include "ui/base/Widget.hpp"
 #include "util/Work.hpp"
 
@@ -205,6 +208,32 @@ private:
         std::pair<int, int> ratio_{};
     };
 
+    // Everything a row needs to know about a transaction
+    struct Summary {
+        Time time_{};
+        Amount amount_{};
+        std::string memo_{};
+        std::string text_{};
+    };
+
+    // Kept for every row so that loaded transactions are recognized without
+    // searching the rows, and so that a reloaded transaction which would not
+    // change its row is ignored. The memo and description are only stored as
+    // a hash since the row holds the text.
+    struct CachedSummary {
+        Time time_{};
+        Amount amount_{};
+        std::size_t text_{};
+
+        auto operator==(const CachedSummary& rhs) const noexcept -> bool
+        {
+            return (time_ == rhs.time_) && (amount_ == rhs.amount_) &&
+                   (text_ == rhs.text_);
+        }
+
+        CachedSummary(const Summary& summary) noexcept;
+    };
+
     enum class Work : OTZMQWorkType {
         balance = value(WorkType::BlockchainBalance),
         txid = value(WorkType::BlockchainNewTransaction),
@@ -214,13 +243,30 @@ private:
         shutdown = value(WorkType::Shutdown),
     };
 
+    // Number of unloaded transactions loaded for each fetch more request
+    static constexpr auto page_size_ = std::size_t{100};
+
     const blockchain::Type chain_;
     mutable std::atomic<Amount> confirmed_;
     OTZMQListenCallback balance_cb_;
     OTZMQDealerSocket balance_socket_;
     Progress progress_;
     SyncCB sync_cb_;
+    std::map<OTData, CachedSummary> summaries_;
+    // Transactions which were listed for the nym but belong to other chains
+    std::set<OTData> other_chains_;
+    RowQueue<OTData, Time> pending_;
+    mutable std::atomic<std::size_t> unloaded_;
+    mutable std::atomic<bool> fetch_;
+
+    auto can_fetch_more() const noexcept -> bool final;
+    auto fetch_more() const noexcept -> void final;
+    auto row_id(const Data& txid) const noexcept -> AccountActivityRowID;
+    auto skip(const Data& txid) const noexcept -> bool;
+    auto transaction_times() const noexcept -> std::map<std::string, Time>;
 
+    auto add_row(const Data& txid, const Summary& summary) noexcept -> void;
+    auto load_page() noexcept -> void;
     auto load_thread() noexcept -> void;
     auto pipeline(const Message& in) noexcept -> void final;
     auto process_balance(const Message& message) noexcept -> void;
@@ -229,6 +275,7 @@ private:
     auto process_txid(const Data& txid) noexcept
         -> std::optional<AccountActivityRowID>;
     auto startup() noexcept -> void final;
+    auto state_machine() noexcept -> bool final;
 
     BlockchainAccountActivity() = delete;
     BlockchainAccountActivity(const BlockchainAccountActivity&) = delete;
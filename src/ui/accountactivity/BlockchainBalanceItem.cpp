@@ -16,7 +16,6 @@
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
-#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
@@ -81,20 +80,13 @@ auto BlockchainBalanceItem::reindex(
     const implementation::AccountActivitySortKey& key,
     implementation::CustomData& custom) noexcept -> bool
 {
-    using Transaction = opentxs::blockchain::block::bitcoin::Transaction;
-
     extract_custom<proto::PaymentWorkflow>(custom, 0);
     extract_custom<proto::PaymentEvent>(custom, 1);
-    const auto pTx = extract_custom_ptr<Transaction>(custom, 2);
-
-    OT_ASSERT(pTx);
-
-    const auto& tx = *pTx;
     auto output = BalanceItem::reindex(key, custom);
+    const auto amount = extract_custom<opentxs::Amount>(custom, 2);
     const auto chain = extract_custom<blockchain::Type>(custom, 3);
     const auto txid = extract_custom<OTData>(custom, 5);
-    const auto amount = tx.NetBalanceChange(Widget::api_.Blockchain(), nym_id_);
-    const auto memo = tx.Memo(Widget::api_.Blockchain());
+    const auto memo = extract_custom<std::string>(custom, 6);
     const auto text = extract_custom<std::string>(custom, 4);
 
     OT_ASSERT(chain_ == chain);
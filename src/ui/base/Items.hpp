@@ -6,24 +6,101 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
-#include <list>
+#include <iterator>
 #include <map>
 #include <optional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace opentxs::ui::implementation
 {
+// Rows are stored in a randomized balanced binary tree (treap) in which every
+// node records the size of its subtree, so finding a row by position, finding
+// the position of a row, and inserting, moving or deleting a row are all
+// O(log n). Iterators remain valid until the row they refer to is deleted.
 template <typename RowID, typename SortKey, typename RowPointer>
 class ListItems
 {
+private:
+    struct Node;
+
 public:
     struct Row {
         SortKey key_;
         RowID id_;
         RowPointer item_;
     };
-    using Data = std::list<Row>;
-    using Iterator = typename Data::iterator;
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Row;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Row*;
+        using reference = Row&;
+
+        auto operator*() const noexcept -> Row& { return node_->row_; }
+        auto operator->() const noexcept -> Row* { return &node_->row_; }
+        auto operator==(const Iterator& rhs) const noexcept -> bool
+        {
+            return node_ == rhs.node_;
+        }
+        auto operator!=(const Iterator& rhs) const noexcept -> bool
+        {
+            return node_ != rhs.node_;
+        }
+        auto operator++() noexcept -> Iterator&
+        {
+            node_ = ListItems::next(node_);
+
+            return *this;
+        }
+        auto operator++(int) noexcept -> Iterator
+        {
+            auto output{*this};
+            ++(*this);
+
+            return output;
+        }
+        auto operator--() noexcept -> Iterator&
+        {
+            node_ = (nullptr == node_) ? ListItems::last(parent_->root_)
+                                       : ListItems::previous(node_);
+
+            return *this;
+        }
+        auto operator--(int) noexcept -> Iterator
+        {
+            auto output{*this};
+            --(*this);
+
+            return output;
+        }
+
+        Iterator() noexcept
+            : node_(nullptr)
+            , parent_(nullptr)
+        {
+        }
+
+    private:
+        friend ListItems;
+
+        Node* node_;
+        const ListItems* parent_;
+
+        Iterator(Node* node, const ListItems* parent) noexcept
+            : node_(node)
+            , parent_(parent)
+        {
+        }
+    };
+
     using Index = std::map<RowID, Iterator>;
     using Position = std::pair<Iterator, std::size_t>;
     using Move = std::pair<Position, Position>;
@@ -38,36 +115,29 @@ public:
 
         return output;
     }
-    auto size() const noexcept { return data_.size(); }
+    auto size() const noexcept { return count(root_); }
 
     auto at(const std::size_t pos) -> Row&
     {
-        if ((0 == data_.size()) || ((data_.size() - 1) < pos)) {
-            throw std::out_of_range("Invalid position");
-        }
+        if (size() <= pos) { throw std::out_of_range("Invalid position"); }
 
-        auto output = data_.begin();
-        std::advance(output, pos);
-
-        return *output;
+        return select(pos)->row_;
     }
     auto get(const RowID& id) -> Row& { return *index_.at(id); }
-    auto begin() noexcept -> Iterator { return data_.begin(); }
+    auto begin() noexcept -> Iterator { return {first(root_), this}; }
     auto delete_row(const RowID& id, Iterator position) noexcept -> void
     {
-        data_.erase(position);
+        unlink(position.node_);
         index_.erase(id);
     }
-    auto end() noexcept -> Iterator { return data_.end(); }
+    auto end() noexcept -> Iterator { return {nullptr, this}; }
     auto find_delete_position(const RowID& id) noexcept
         -> std::optional<Position>
     {
         try {
             const auto it = index_.at(id);
 
-            return Position{
-                it, static_cast<std::size_t>(std::distance(data_.begin(), it))};
-
+            return Position{it, rank(it.node_)};
         } catch (...) {
 
             return std::nullopt;
@@ -76,57 +146,28 @@ public:
     auto find_insert_position(const SortKey& key, const RowID& id) noexcept
         -> Position
     {
-        auto output = Position{data_.end(), 0};
-        auto& [it, index] = output;
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i, ++index) {
-            const auto& [rKey, rId, item] = *i;
-
-            if (sort(key, id, rKey, rId)) { continue; }
-
-            it = i;
-
-            break;
-        }
-
-        return output;
+        return lower_bound(key, id);
     }
     auto find_move_position(
         const RowID& oldId,
         const SortKey& newKey,
         const RowID& newID) noexcept -> std::optional<Move>
     {
-        auto output = Move{{data_.end(), 0}, {data_.end(), 0}};
-        auto& [from, to] = output;
-        auto& [it, index] = to;
-
         try {
             const auto it = index_.at(oldId);
-            from = Position{
-                it, static_cast<std::size_t>(std::distance(data_.begin(), it))};
+
+            return Move{
+                Position{it, rank(it.node_)}, lower_bound(newKey, newID)};
         } catch (...) {
 
             return std::nullopt;
         }
-
-        for (auto i{data_.begin()}; i != data_.end(); ++i, ++index) {
-            const auto& [rKey, rId, item] = *i;
-
-            if (sort(newKey, newID, rKey, rId)) { continue; }
-
-            it = i;
-
-            break;
-        }
-
-        return std::move(output);
     }
     auto get_index(const RowID& id) noexcept -> std::optional<std::size_t>
     {
         try {
 
-            return static_cast<std::size_t>(
-                std::distance(data_.begin(), index_.at(id)));
+            return rank(index_.at(id).node_);
         } catch (...) {
 
             return std::nullopt;
@@ -139,7 +180,7 @@ public:
         const RowPointer& item) noexcept
     {
         auto& index = index_[id];
-        index = data_.emplace(position, Row{key, id, item});
+        index = {link(position.node_, Row{key, id, item}), this};
     }
     auto move_before(
         const RowID& oldId,
@@ -151,22 +192,104 @@ public:
         index_.erase(oldId);
         auto& oldData = *oldPosition;
         auto& index = index_[newID];
-        index = data_.emplace(newPosition, Row{newKey, newID, oldData.item_});
-        data_.erase(oldPosition);
+        index = {
+            link(newPosition.node_, Row{newKey, newID, oldData.item_}), this};
+        unlink(oldPosition.node_);
     }
 
     ListItems(const bool reverse) noexcept
         : reverse_sort_(reverse)
-        , data_()
+        , root_(nullptr)
+        , random_()
         , index_()
     {
     }
 
+    ~ListItems()
+    {
+        auto nodes = std::vector<Node*>{};
+
+        if (nullptr != root_) { nodes.emplace_back(root_); }
+
+        while (false == nodes.empty()) {
+            auto* node = nodes.back();
+            nodes.pop_back();
+
+            if (nullptr != node->left_) { nodes.emplace_back(node->left_); }
+            if (nullptr != node->right_) { nodes.emplace_back(node->right_); }
+
+            delete node;
+        }
+    }
+
 private:
+    struct Node {
+        Row row_;
+        Node* parent_;
+        Node* left_;
+        Node* right_;
+        std::size_t size_;
+        std::minstd_rand::result_type priority_;
+    };
+
     const bool reverse_sort_;
-    Data data_;
+    Node* root_;
+    std::minstd_rand random_;
     Index index_;
 
+    static auto count(const Node* node) noexcept -> std::size_t
+    {
+        return (nullptr == node) ? 0u : node->size_;
+    }
+    static auto first(Node* node) noexcept -> Node*
+    {
+        if (nullptr == node) { return nullptr; }
+
+        while (nullptr != node->left_) { node = node->left_; }
+
+        return node;
+    }
+    static auto last(Node* node) noexcept -> Node*
+    {
+        if (nullptr == node) { return nullptr; }
+
+        while (nullptr != node->right_) { node = node->right_; }
+
+        return node;
+    }
+    static auto next(Node* node) noexcept -> Node*
+    {
+        if (nullptr != node->right_) { return first(node->right_); }
+
+        while ((nullptr != node->parent_) && (node == node->parent_->right_)) {
+            node = node->parent_;
+        }
+
+        return node->parent_;
+    }
+    static auto previous(Node* node) noexcept -> Node*
+    {
+        if (nullptr != node->left_) { return last(node->left_); }
+
+        while ((nullptr != node->parent_) && (node == node->parent_->left_)) {
+            node = node->parent_;
+        }
+
+        return node->parent_;
+    }
+    static auto rank(const Node* node) noexcept -> std::size_t
+    {
+        auto output = count(node->left_);
+
+        for (; nullptr != node->parent_; node = node->parent_) {
+            const auto* parent = node->parent_;
+
+            if (node == parent->right_) { output += count(parent->left_) + 1u; }
+        }
+
+        return output;
+    }
+
     template <typename T>
     auto sort(const T& lhs, const T& rhs) const noexcept -> bool
     {
@@ -190,5 +313,149 @@ private:
 
         return (existingKey == incomingKey) && sort(existingID, incomingID);
     }
+    // Returns the first row which does not sort before the specified key along
+    // with the number of rows which do
+    auto lower_bound(const SortKey& key, const RowID& id) noexcept -> Position
+    {
+        auto output = Position{end(), 0};
+        auto& [it, index] = output;
+        auto* node = root_;
+
+        while (nullptr != node) {
+            const auto& [rKey, rId, item] = node->row_;
+
+            if (sort(key, id, rKey, rId)) {
+                index += count(node->left_) + 1u;
+                node = node->right_;
+            } else {
+                it.node_ = node;
+                node = node->left_;
+            }
+        }
+
+        return output;
+    }
+    auto link(Node* position, Row&& row) noexcept -> Node*
+    {
+        auto* node = new Node{
+            std::move(row), nullptr, nullptr, nullptr, 1u, random_()};
+
+        if (nullptr == root_) {
+            root_ = node;
+
+            return node;
+        }
+
+        if (nullptr == position) {
+            node->parent_ = last(root_);
+            node->parent_->right_ = node;
+        } else if (nullptr == position->left_) {
+            node->parent_ = position;
+            position->left_ = node;
+        } else {
+            node->parent_ = last(position->left_);
+            node->parent_->right_ = node;
+        }
+
+        for (auto* i = node->parent_; nullptr != i; i = i->parent_) {
+            ++i->size_;
+        }
+
+        while ((nullptr != node->parent_) &&
+               (node->priority_ > node->parent_->priority_)) {
+            rotate_up(node);
+        }
+
+        return node;
+    }
+    // Moves node into the position currently occupied by its parent without
+    // changing the order of the rows
+    auto rotate_up(Node* node) noexcept -> void
+    {
+        auto* parent = node->parent_;
+        auto* grandparent = parent->parent_;
+
+        if (node == parent->left_) {
+            parent->left_ = node->right_;
+
+            if (nullptr != node->right_) { node->right_->parent_ = parent; }
+
+            node->right_ = parent;
+        } else {
+            parent->right_ = node->left_;
+
+            if (nullptr != node->left_) { node->left_->parent_ = parent; }
+
+            node->left_ = parent;
+        }
+
+        parent->parent_ = node;
+        node->parent_ = grandparent;
+
+        if (nullptr == grandparent) {
+            root_ = node;
+        } else if (parent == grandparent->left_) {
+            grandparent->left_ = node;
+        } else {
+            grandparent->right_ = node;
+        }
+
+        node->size_ = parent->size_;
+        parent->size_ = count(parent->left_) + count(parent->right_) + 1u;
+    }
+    auto select(std::size_t pos) const noexcept -> Node*
+    {
+        auto* node = root_;
+
+        while (nullptr != node) {
+            const auto left = count(node->left_);
+
+            if (pos < left) {
+                node = node->left_;
+            } else if (pos == left) {
+
+                break;
+            } else {
+                pos -= left + 1u;
+                node = node->right_;
+            }
+        }
+
+        return node;
+    }
+    auto unlink(Node* node) noexcept -> void
+    {
+        while ((nullptr != node->left_) || (nullptr != node->right_)) {
+            auto* child = node->left_;
+
+            if ((nullptr == child) ||
+                ((nullptr != node->right_) &&
+                 (node->right_->priority_ > child->priority_))) {
+                child = node->right_;
+            }
+
+            rotate_up(child);
+        }
+
+        auto* parent = node->parent_;
+
+        if (nullptr == parent) {
+            root_ = nullptr;
+        } else if (node == parent->left_) {
+            parent->left_ = nullptr;
+        } else {
+            parent->right_ = nullptr;
+        }
+
+        for (auto* i = parent; nullptr != i; i = i->parent_) { --i->size_; }
+
+        delete node;
+    }
+
+    ListItems() = delete;
+    ListItems(const ListItems&) = delete;
+    ListItems(ListItems&&) = delete;
+    auto operator=(const ListItems&) -> ListItems& = delete;
+    auto operator=(ListItems&&) -> ListItems& = delete;
 };
 }  // namespace opentxs::ui::implementation
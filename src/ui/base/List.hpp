@@ -44,6 +44,13 @@ class List : virtual public ExternalInterface,
 public:
     using QtPointerType = RowInternal;
 
+    auto canFetchMore(const QModelIndex& parent) const noexcept
+        -> bool override
+    {
+        if (nullptr != get_pointer(parent)) { return false; }
+
+        return can_fetch_more();
+    }
     auto columnCount(const QModelIndex& parent) const noexcept -> int override
     {
         if (nullptr == get_pointer(parent)) {
@@ -61,6 +68,10 @@ public:
 
         return valid_pointers_.data(index, role);
     }
+    auto fetchMore(const QModelIndex& parent) noexcept -> void override
+    {
+        if (nullptr == get_pointer(parent)) { fetch_more(); }
+    }
     auto index(int row, int column, const QModelIndex& parent) const noexcept
         -> QModelIndex override
     {
@@ -118,16 +129,15 @@ public:
     {
         rLock lock{recursive_lock_};
         const auto index = find_index(id);
+        const auto output = (0 == items_.size()) ||
+                            (false == index.has_value()) ||
+                            ((items_.size() - 1) <= index.value());
 
-        if (0 == items_.size()) { return true; }
+        // NOTE native consumers which read to the end of the list ask for more
+        // rows, the same way a view does by scrolling to the bottom
+        if (output) { fetch_more(); }
 
-        if (index.has_value()) {
-
-            return ((items_.size() - 1) <= index.value());
-        } else {
-
-            return true;
-        }
+        return output;
     }
     auto Next() const noexcept -> SharedPimpl<RowInterface> override
     {
@@ -338,6 +348,9 @@ protected:
         emit_end_remove_rows();
 #endif  // OT_QT
     }
+    // Models which construct their rows a page at a time override these
+    virtual auto can_fetch_more() const noexcept -> bool { return false; }
+    virtual auto fetch_more() const noexcept -> void {}
     virtual auto default_id() const noexcept -> RowID
     {
         return make_blank<RowID>::value(api_);
@@ -0,0 +1,80 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace opentxs::ui::implementation
+{
+// Holds the items which have not been turned into rows yet so that a model
+// can construct its rows a page at a time. Pages are handed out newest first
+// so recent activity appears before older history. Items with equal
+// timestamps keep the order in which they were supplied.
+template <typename Key, typename Timestamp>
+class RowQueue
+{
+public:
+    using Entry = std::pair<Key, Timestamp>;
+    // Returns true for items which no longer need a row to be constructed
+    using Skip = std::function<bool(const Key&)>;
+
+    auto empty() const noexcept -> bool { return queue_.empty(); }
+    auto size() const noexcept -> std::size_t { return queue_.size(); }
+
+    auto clear() noexcept -> void { queue_.clear(); }
+    // Removes and returns up to count items, discarding skipped items without
+    // counting them
+    auto next(const std::size_t count, const Skip& skip) noexcept
+        -> std::vector<Key>
+    {
+        auto output = std::vector<Key>{};
+
+        while ((output.size() < count) && (false == queue_.empty())) {
+            auto key = std::move(queue_.front());
+            queue_.pop_front();
+
+            if (skip && skip(key)) { continue; }
+
+            output.emplace_back(std::move(key));
+        }
+
+        return output;
+    }
+    // Replaces the contents of the queue
+    auto reset(std::vector<Entry>&& entries) noexcept -> void
+    {
+        std::stable_sort(
+            entries.begin(), entries.end(), [](const auto& l, const auto& r) {
+                return l.second > r.second;
+            });
+        queue_.clear();
+
+        for (auto& entry : entries) {
+            queue_.emplace_back(std::move(entry.first));
+        }
+    }
+
+    RowQueue() noexcept
+        : queue_()
+    {
+    }
+
+    ~RowQueue() = default;
+
+private:
+    std::deque<Key> queue_;
+
+    RowQueue(const RowQueue&) = delete;
+    RowQueue(RowQueue&&) = delete;
+    auto operator=(const RowQueue&) -> RowQueue& = delete;
+    auto operator=(RowQueue&&) -> RowQueue& = delete;
+};
+}  // namespace opentxs::ui::implementation
@@ -11,11 +11,17 @@ extern "C" {
 #include <lmdb.h>
 }
 
+#include <atomic>
 #include <cstddef>
 #include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <set>
 #include <stdexcept>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "opentxs/Types.hpp"
 #include "opentxs/core/Log.hpp"
@@ -36,6 +42,140 @@ extern "C" {
 namespace opentxs::storage::lmdb
 {
 struct LMDB::Imp {
+    // NOTE each thread owns one read transaction per environment. It is
+    // reset after use and renewed by the next read instead of being created
+    // and destroyed every time. Nested reads on the same thread, including
+    // reads performed while a Snapshot exists, share the active transaction.
+    struct Reader {
+        MDB_txn* txn_{nullptr};
+        std::size_t depth_{0};
+    };
+    // Tracks the read transactions of every thread which has used the
+    // environment. A thread aborts its transaction when it exits unless the
+    // environment was closed first, in which case the environment already
+    // aborted it.
+    struct Registry {
+        std::mutex lock_{};
+        bool open_{true};
+        std::set<Reader*> readers_{};
+    };
+    class ThreadReaders
+    {
+    public:
+        auto get(
+            const std::size_t id,
+            const std::shared_ptr<Registry>& registry) noexcept -> Reader&
+        {
+            auto& [owner, reader] = readers_[id];
+
+            if (false == bool(reader)) {
+                prune();
+                reader = std::make_unique<Reader>();
+                owner = registry;
+                auto lock = Lock{owner->lock_};
+                owner->readers_.emplace(reader.get());
+            }
+
+            return *reader;
+        }
+
+        ~ThreadReaders()
+        {
+            for (auto& [id, value] : readers_) {
+                auto& [registry, reader] = value;
+                auto lock = Lock{registry->lock_};
+                registry->readers_.erase(reader.get());
+
+                if (registry->open_ && (nullptr != reader->txn_)) {
+                    ::mdb_txn_abort(reader->txn_);
+                }
+            }
+        }
+
+    private:
+        std::map<
+            std::size_t,
+            std::pair<std::shared_ptr<Registry>, std::unique_ptr<Reader>>>
+            readers_{};
+
+        // Discards entries for environments which have been closed
+        auto prune() noexcept -> void
+        {
+            for (auto i = readers_.begin(); i != readers_.end();) {
+                const auto& registry = i->second.first;
+                const auto closed = [&] {
+                    if (false == bool(registry)) { return false; }
+
+                    auto lock = Lock{registry->lock_};
+
+                    return false == registry->open_;
+                }();
+
+                if (closed) {
+                    i = readers_.erase(i);
+                } else {
+                    ++i;
+                }
+            }
+        }
+    };
+
+    class ReadTransaction
+    {
+    public:
+        operator MDB_txn*() noexcept { return reader_.txn_; }
+
+        ReadTransaction(const Imp& parent) noexcept(false)
+            : reader_(parent.acquire_read())
+        {
+        }
+
+        ~ReadTransaction() { release_read(reader_); }
+
+    private:
+        Reader& reader_;
+
+        ReadTransaction() = delete;
+        ReadTransaction(const ReadTransaction&) = delete;
+        ReadTransaction(ReadTransaction&&) = delete;
+        auto operator=(const ReadTransaction&) -> ReadTransaction& = delete;
+        auto operator=(ReadTransaction&&) -> ReadTransaction& = delete;
+    };
+
+    static auto release_read(Reader& reader) noexcept -> void
+    {
+        OT_ASSERT(0u < reader.depth_);
+
+        if (0u == --reader.depth_) { ::mdb_txn_reset(reader.txn_); }
+    }
+
+    auto acquire_read() const noexcept(false) -> Reader&
+    {
+        auto& reader = get_reader();
+
+        if (0u == reader.depth_) {
+            const auto rc =
+                (nullptr == reader.txn_)
+                    ? ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &reader.txn_)
+                    : ::mdb_txn_renew(reader.txn_);
+
+            if (0 != rc) {
+                throw std::runtime_error("Failed to start read transaction");
+            }
+        }
+
+        ++reader.depth_;
+
+        return reader;
+    }
+    auto get_reader() const noexcept -> Reader&
+    {
+        // NOTE keyed by id_ rather than by address so an entry can never
+        // refer to a destroyed environment
+        thread_local auto readers = ThreadReaders{};
+
+        return readers.get(id_, readers_);
+    }
     auto Commit() const noexcept -> bool
     {
         try {
@@ -138,24 +278,12 @@ struct LMDB::Imp {
     auto Exists(const Table table, const ReadView index) const noexcept -> bool
     {
         try {
-            auto tx = TransactionRO();
-            MDB_cursor* cursor{nullptr};
-            auto post = ScopeGuard{[&] {
-                if (nullptr != cursor) {
-                    ::mdb_cursor_close(cursor);
-                    cursor = nullptr;
-                }
-            }};
+            auto tx = ReadTransaction{*this};
             const auto dbi = db_.at(table);
-
-            if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
-                throw std::runtime_error{"Failed to get cursor"};
-            }
-
             auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
             auto value = MDB_val{};
 
-            return 0 == ::mdb_cursor_get(cursor, &key, &value, MDB_SET);
+            return 0 == ::mdb_get(tx, dbi, &key, &value);
         } catch (const std::exception& e) {
             LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -169,7 +297,23 @@ struct LMDB::Imp {
         const Mode multiple) const noexcept -> bool
     {
         try {
-            auto tx = TransactionRO();
+            auto tx = ReadTransaction{*this};
+            const auto dbi = db_.at(table);
+            auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
+            auto value = MDB_val{};
+
+            if (false == static_cast<bool>(multiple)) {
+                // NOTE mdb_get returns the first value for keys with
+                // duplicates
+                const auto success = 0 == ::mdb_get(tx, dbi, &key, &value);
+
+                if (success) {
+                    cb({static_cast<char*>(value.mv_data), value.mv_size});
+                }
+
+                return success;
+            }
+
             MDB_cursor* cursor{nullptr};
             auto post = ScopeGuard{[&] {
                 if (nullptr != cursor) {
@@ -177,14 +321,11 @@ struct LMDB::Imp {
                     cursor = nullptr;
                 }
             }};
-            const auto dbi = db_.at(table);
 
             if (0 != ::mdb_cursor_open(tx, dbi, &cursor)) {
                 throw std::runtime_error{"Failed to get cursor"};
             }
 
-            auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
-            auto value = MDB_val{};
             auto success = 0 == ::mdb_cursor_get(cursor, &key, &value, MDB_SET);
 
             if (success) {
@@ -198,17 +339,14 @@ struct LMDB::Imp {
                     return false;
                 }
 
-                if (static_cast<bool>(multiple)) {
-                    while (0 == ::mdb_cursor_get(
-                                    cursor, &key, &value, MDB_NEXT_DUP)) {
-                        if (0 == ::mdb_cursor_get(
-                                     cursor, &key, &value, MDB_GET_CURRENT)) {
-                            cb({static_cast<char*>(value.mv_data),
-                                value.mv_size});
-                        } else {
-
-                            return false;
-                        }
+                while (0 ==
+                       ::mdb_cursor_get(cursor, &key, &value, MDB_NEXT_DUP)) {
+                    if (0 == ::mdb_cursor_get(
+                                 cursor, &key, &value, MDB_GET_CURRENT)) {
+                        cb({static_cast<char*>(value.mv_data), value.mv_size});
+                    } else {
+
+                        return false;
                     }
                 }
             }
@@ -220,6 +358,38 @@ struct LMDB::Imp {
             return false;
         }
     }
+    auto LoadMany(
+        const Table table,
+        const std::vector<ReadView>& keys,
+        const ManyCallback cb) const noexcept -> std::size_t
+    {
+        auto output = std::size_t{0};
+
+        try {
+            if (false == bool(cb)) {
+                throw std::runtime_error{"Invalid callback"};
+            }
+
+            auto tx = ReadTransaction{*this};
+            const auto dbi = db_.at(table);
+            auto value = MDB_val{};
+
+            for (auto i = std::size_t{0}; i < keys.size(); ++i) {
+                const auto& index = keys.at(i);
+                auto key =
+                    MDB_val{index.size(), const_cast<char*>(index.data())};
+
+                if (0 == ::mdb_get(tx, dbi, &key, &value)) {
+                    ++output;
+                    cb(i, {static_cast<char*>(value.mv_data), value.mv_size});
+                }
+            }
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+        }
+
+        return output;
+    }
     auto Queue(
         const Table table,
         const ReadView key,
@@ -241,7 +411,7 @@ struct LMDB::Imp {
         const noexcept -> bool
     {
         try {
-            auto tx = TransactionRO();
+            auto tx = ReadTransaction{*this};
             MDB_cursor* cursor{nullptr};
             auto post = ScopeGuard{[&] {
                 if (nullptr != cursor) {
@@ -330,7 +500,7 @@ struct LMDB::Imp {
         const Dir dir) const noexcept -> bool
     {
         try {
-            auto tx = TransactionRO();
+            auto tx = ReadTransaction{*this};
             MDB_cursor* cursor{nullptr};
             auto post = ScopeGuard{[&] {
                 if (nullptr != cursor) {
@@ -472,11 +642,13 @@ struct LMDB::Imp {
         const Flags flags,
         const std::size_t extraTables) noexcept
         : names_(names)
+        , id_(++next_id_)
         , env_(nullptr)
         , db_()
         , pending_()
         , pending_lock_()
         , write_lock_()
+        , readers_(std::make_shared<Registry>())
     {
         init_environment(folder, init.size() + extraTables, flags);
         init_tables(init);
@@ -488,6 +660,19 @@ struct LMDB::Imp {
 
     ~Imp()
     {
+        {
+            auto lock = Lock{readers_->lock_};
+
+            for (auto* reader : readers_->readers_) {
+                if (nullptr != reader->txn_) {
+                    ::mdb_txn_abort(reader->txn_);
+                    reader->txn_ = nullptr;
+                }
+            }
+
+            readers_->open_ = false;
+        }
+
         if (nullptr != env_) {
             ::mdb_env_close(env_);
             env_ = nullptr;
@@ -498,12 +683,16 @@ private:
     using NewKey = std::tuple<Table, Mode, std::string, std::string>;
     using Pending = std::vector<NewKey>;
 
+    static std::atomic<std::size_t> next_id_;
+
     const TableNames& names_;
+    const std::size_t id_;
     mutable MDB_env* env_;
     mutable Databases db_;
     mutable Pending pending_;
     mutable std::mutex pending_lock_;
     mutable std::mutex write_lock_;
+    const std::shared_ptr<Registry> readers_;
 
     auto init_db(const Table table, unsigned int flags) noexcept -> MDB_dbi
     {
@@ -552,7 +741,10 @@ private:
 
         OT_ASSERT(set);
 
-        set = 0 == ::mdb_env_open(env_, folder.c_str(), flags, 0664);
+        // NOTE MDB_NOTLS allows the environment to abort the read transaction
+        // of a thread other than the one which created it
+        set = 0 == ::mdb_env_open(
+                       env_, folder.c_str(), flags | MDB_NOTLS, 0664);
 
         OT_ASSERT(set);
     }
@@ -565,6 +757,28 @@ private:
     }
 };
 
+std::atomic<std::size_t> LMDB::Imp::next_id_{0};
+
+LMDB::Snapshot::Snapshot(const Imp& imp) noexcept(false)
+    : imp_(&imp)
+{
+    imp_->acquire_read();
+}
+
+LMDB::Snapshot::Snapshot(Snapshot&& rhs) noexcept
+    : imp_(rhs.imp_)
+{
+    rhs.imp_ = nullptr;
+}
+
+LMDB::Snapshot::~Snapshot()
+{
+    if (nullptr != imp_) {
+        Imp::release_read(imp_->get_reader());
+        imp_ = nullptr;
+    }
+}
+
 LMDB::LMDB(
     const TableNames& names,
     const std::string& folder,
@@ -588,6 +802,8 @@ LMDB::Transaction::Transaction(
     : success_(false)
     , lock_(std::move(lock))
     , ptr_(nullptr)
+    , commit_()
+    , finalize_()
 {
     const Flags flags = rw ? 0u : MDB_RDONLY;
 
@@ -600,6 +816,8 @@ LMDB::Transaction::Transaction(Transaction&& rhs) noexcept
     : success_(rhs.success_)
     , lock_(std::move(rhs.lock_))
     , ptr_(rhs.ptr_)
+    , commit_(std::move(rhs.commit_))
+    , finalize_(std::move(rhs.finalize_))
 {
     rhs.ptr_ = nullptr;
 }
@@ -622,21 +840,57 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
     if (nullptr != ptr_) {
         if (success.has_value()) { success_ = success.value(); }
 
-        auto cleanup = Cleanup{ptr_};
-
         if (success_) {
+            auto commit = std::vector<CommitCallback>{};
+            commit.swap(commit_);
 
-            return 0 == ::mdb_txn_commit(ptr_);
+            for (auto& cb : commit) {
+                if (false == cb(*this)) {
+                    success_ = false;
+
+                    break;
+                }
+            }
         } else {
-            ::mdb_txn_abort(ptr_);
+            commit_.clear();
+        }
+
+        auto output = [&] {
+            auto cleanup = Cleanup{ptr_};
+
+            if (success_) {
 
-            return true;
+                return 0 == ::mdb_txn_commit(ptr_);
+            } else {
+                ::mdb_txn_abort(ptr_);
+
+                return true;
+            }
+        }();
+        const auto committed = success_ && output;
+        auto finalize = std::vector<FinalizeCallback>{};
+        finalize.swap(finalize_);
+
+        for (auto i = finalize.rbegin(); i != finalize.rend(); ++i) {
+            (*i)(committed);
         }
+
+        return output;
     }
 
     return false;
 }
 
+auto LMDB::Transaction::OnCommit(CommitCallback&& cb) noexcept -> void
+{
+    if (cb) { commit_.emplace_back(std::move(cb)); }
+}
+
+auto LMDB::Transaction::OnFinalize(FinalizeCallback&& cb) noexcept -> void
+{
+    if (cb) { finalize_.emplace_back(std::move(cb)); }
+}
+
 LMDB::Transaction::~Transaction() { Finalize(); }
 
 auto LMDB::Commit() const noexcept -> bool { return imp_->Commit(); }
@@ -704,6 +958,14 @@ auto LMDB::Load(
         mode);
 }
 
+auto LMDB::LoadMany(
+    const Table table,
+    const std::vector<ReadView>& keys,
+    const ManyCallback cb) const noexcept -> std::size_t
+{
+    return imp_->LoadMany(table, keys, cb);
+}
+
 auto LMDB::Queue(
     const Table table,
     const ReadView key,
@@ -750,6 +1012,11 @@ auto LMDB::ReadFrom(
         dir);
 }
 
+auto LMDB::ReadSnapshot() const noexcept(false) -> Snapshot
+{
+    return Snapshot{*imp_};
+}
+
 auto LMDB::Store(
     const Table table,
     const ReadView index,
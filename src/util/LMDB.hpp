@@ -30,7 +30,10 @@ typedef unsigned int MDB_dbi;
 namespace opentxs::storage::lmdb
 {
 using Callback = std::function<void(const ReadView data)>;
+using FinalizeCallback = std::function<void(const bool committed)>;
 using Flags = unsigned int;
+using ManyCallback =
+    std::function<void(const std::size_t index, const ReadView data)>;
 using ReadCallback =
     std::function<bool(const ReadView key, const ReadView value)>;
 using Result = std::pair<bool, int>;
@@ -40,18 +43,56 @@ using TablesToInit = std::vector<std::pair<Table, unsigned int>>;
 using TableNames = std::map<Table, const std::string>;
 using UpdateCallback = std::function<Space(const ReadView data)>;
 
-class LMDB
+class OPENTXS_EXPORT LMDB
 {
 public:
     enum class Dir : bool { Forward = false, Backward = true };
     enum class Mode : bool { One = false, Multiple = true };
 
+    struct Imp;
+
+    // Holds the calling thread's read transaction open so every read
+    // performed by that thread observes the same version of the database
+    // until the snapshot is destroyed. Must be destroyed by the thread which
+    // created it. Writes committed while the snapshot exists are not visible
+    // to reads performed under it.
+    class Snapshot
+    {
+    public:
+        Snapshot(Snapshot&&) noexcept;
+        ~Snapshot();
+
+    private:
+        friend LMDB;
+
+        const Imp* imp_;
+
+        Snapshot(const Imp& imp) noexcept(false);
+        Snapshot() = delete;
+        Snapshot(const Snapshot&) = delete;
+        auto operator=(const Snapshot&) -> Snapshot& = delete;
+        auto operator=(Snapshot&&) -> Snapshot& = delete;
+    };
+
     struct Transaction {
+        using CommitCallback = std::function<bool(Transaction& tx)>;
+
         bool success_;
 
         operator MDB_txn*() noexcept { return ptr_; }
 
         auto Finalize(const std::optional<bool> success = {}) noexcept -> bool;
+        // Registers a function to be called immediately before the
+        // transaction is committed, in the order of registration. If any of
+        // them returns false the transaction is aborted instead.
+        auto OnCommit(CommitCallback&& cb) noexcept -> void;
+        // Registers a function to be called when the transaction is
+        // committed or aborted. Functions are called in the reverse order of
+        // registration. The argument is true only if the commit succeeded.
+        //
+        // NOTE for a nested transaction the argument refers to the nested
+        // commit, not to the commit of the parent transaction
+        auto OnFinalize(FinalizeCallback&& cb) noexcept -> void;
 
         Transaction(
             MDB_env* env,
@@ -63,6 +104,8 @@ public:
     private:
         std::unique_ptr<Lock> lock_;
         MDB_txn* ptr_;
+        std::vector<CommitCallback> commit_;
+        std::vector<FinalizeCallback> finalize_;
 
         Transaction(const Transaction&) = delete;
         Transaction(Transaction&&) noexcept;
@@ -102,6 +145,13 @@ public:
         const std::size_t key,
         const Callback cb,
         const Mode mode = Mode::One) const noexcept -> bool;
+    // Looks up every key in a single read transaction and invokes the
+    // callback with the index of each key which was found. Returns the number
+    // of keys found.
+    auto LoadMany(
+        const Table table,
+        const std::vector<ReadView>& keys,
+        const ManyCallback cb) const noexcept -> std::size_t;
     auto Queue(
         const Table table,
         const ReadView key,
@@ -124,6 +174,7 @@ public:
         const std::size_t key,
         const ReadCallback cb,
         const Dir dir) const noexcept -> bool;
+    auto ReadSnapshot() const noexcept(false) -> Snapshot;
     auto Store(
         const Table table,
         const ReadView key,
@@ -159,8 +210,6 @@ public:
     ~LMDB();
 
 private:
-    struct Imp;
-
     std::unique_ptr<Imp> imp_;
 
     auto read(const MDB_dbi dbi, const ReadCallback cb, const Dir dir)
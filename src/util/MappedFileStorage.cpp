@@ -10,8 +10,11 @@
 #include <boost/filesystem.hpp>
 #include <boost/iostreams/device/mapped_file.hpp>
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -60,26 +63,115 @@ constexpr auto get_start_position(const std::size_t file) noexcept
     return file * target_file_size_;
 }
 
+// Regions smaller than this are not tracked in the free space map. They remain
+// unusable until the storage is compacted.
+constexpr auto min_fragment_ = std::size_t{64};
+// Limits the size of the serialized free space map
+constexpr auto max_free_regions_ = std::size_t{65536};
+
+constexpr auto size_class(std::size_t bytes) noexcept -> std::size_t
+{
+    auto output = std::size_t{0};
+
+    while (1u < bytes) {
+        bytes >>= 1u;
+        ++output;
+    }
+
+    return output;
+}
+
 struct MappedFileStorage::Imp {
     using FileCounter = std::size_t;
+    using Generation = std::size_t;
+    using Files = std::vector<boost::iostreams::mapped_file>;
+    // Free regions indexed by the base 2 logarithm of their size
+    using FreeSpace = std::array<std::vector<IndexData>, 64>;
+
+    // Modifications made to the in-memory state by a single write. They are
+    // reverted unless the transaction which contains the write is committed.
+    struct Change {
+        IndexData::MemoryPosition next_position_{};
+        // Region removed from the free space map
+        std::optional<IndexData> allocated_{};
+        // Unused remainder of the allocated region
+        std::optional<IndexData> fragment_{};
+        bool released_{};
+    };
 
     LMDB& lmdb_;
     const std::string path_prefix_;
     const std::string filename_prefix_;
     const int table_;
     const std::size_t key_;
+    const std::size_t free_key_;
+    const std::size_t generation_key_;
+    mutable Generation generation_;
     mutable IndexData::MemoryPosition next_position_;
-    mutable std::vector<boost::iostreams::mapped_file> files_;
+    // Regions which may be allocated
+    mutable FreeSpace free_;
+    // Regions which were freed since the storage was opened. These can not be
+    // allocated until the storage is reopened since views of them may exist.
+    mutable std::vector<IndexData> released_;
+    // True if the free space map has been modified by the write transaction
+    // in progress and will be stored when that transaction commits
+    mutable bool free_dirty_;
+    mutable Files files_;
+
+    auto add_free(const IndexData& region) noexcept -> void
+    {
+        free_.at(size_class(region.size_)).emplace_back(region);
+    }
+    auto allocate(IndexData& index, std::size_t bytes, Change& change) noexcept
+        -> bool
+    {
+        const auto first = size_class(bytes);
+
+        for (auto i{first}; i < free_.size(); ++i) {
+            auto& list = free_.at(i);
+
+            if (list.empty()) { continue; }
+
+            // NOTE every region in a larger size class is large enough
+            auto it = (i == first)
+                          ? std::find_if(
+                                list.begin(),
+                                list.end(),
+                                [&](const auto& in) {
+                                    return in.size_ >= bytes;
+                                })
+                          : std::prev(list.end());
+
+            if (list.end() == it) { continue; }
+
+            const auto region = *it;
+            list.erase(it);
+            change.allocated_ = region;
+            index.position_ = region.position_;
+            index.size_ = bytes;
+            const auto remaining = region.size_ - bytes;
+
+            if (min_fragment_ <= remaining) {
+                const auto& fragment = change.fragment_.emplace(
+                    IndexData{region.position_ + bytes, remaining});
+                add_free(fragment);
+            }
+
+            return true;
+        }
 
+        return false;
+    }
     auto calculate_file_name(
         const std::string& prefix,
-        const FileCounter index) noexcept -> std::string
+        const Generation generation,
+        const FileCounter index) const noexcept -> std::string
     {
         auto number = std::to_string(index);
 
         while (5 > number.size()) { number.insert(0, 1, '0'); }
 
-        const auto filename = filename_prefix_ + number + ".dat";
+        const auto filename = file_prefix(generation) + number + ".dat";
         auto path = fs::path{prefix};
         path /= filename;
 
@@ -88,16 +180,122 @@ struct MappedFileStorage::Imp {
     auto check_file(const FileCounter position) noexcept -> void
     {
         while (files_.size() < (position + 1)) {
-            create_or_load(path_prefix_, files_.size(), files_);
+            create_or_load(path_prefix_, generation_, files_.size(), files_);
         }
     }
+    auto compact(const IndexTables& tables) noexcept -> bool
+    {
+        struct Item {
+            int table_;
+            Space key_;
+            IndexData index_;
+        };
+
+        auto items = std::vector<Item>{};
+
+        for (const auto table : tables) {
+            lmdb_.Read(
+                table,
+                [&](const auto key, const auto value) -> bool {
+                    auto index = IndexData{};
+
+                    if (sizeof(index) != value.size()) { return true; }
+
+                    std::memcpy(
+                        static_cast<void*>(&index), value.data(), value.size());
+
+                    if (0u == index.size_) { return true; }
+
+                    items.emplace_back(Item{table, space(key), index});
+
+                    return true;
+                },
+                LMDB::Dir::Forward);
+        }
+
+        std::sort(items.begin(), items.end(), [](const auto& l, const auto& r) {
+            return l.index_.position_ < r.index_.position_;
+        });
+        const auto generation = generation_ + 1u;
+        auto files = Files{};
+        auto next = IndexData::MemoryPosition{0};
+        auto live = std::size_t{0};
+        const auto cleanup = [&] {
+            files.clear();
+            remove_files(generation);
+        };
+
+        for (auto& [table, key, index] : items) {
+            const auto old = get_read_view(index);
+            index.position_ = next;
+            fit(index);
+            const auto [file, offset] = get_offset(index.position_);
+
+            while (files.size() < (file + 1)) {
+                create_or_load(path_prefix_, generation, files.size(), files);
+            }
+
+            std::memcpy(files.at(file).data() + offset, old.data(), old.size());
+            next = index.position_ + index.size_;
+            live += index.size_;
+        }
+
+        while (files.size() < (get_offset(next).first + 1)) {
+            create_or_load(path_prefix_, generation, files.size(), files);
+        }
+
+        try {
+            auto tx = lmdb_.TransactionRW();
+
+            for (const auto& [table, key, index] : items) {
+                if (false == lmdb_.Store(table, reader(key), tsv(index), tx)
+                                 .first) {
+                    throw std::runtime_error{"Failed to update index"};
+                }
+            }
+
+            const auto stored =
+                lmdb_.Store(table_, tsv(key_), tsv(next), tx).first &&
+                lmdb_.Store(table_, tsv(generation_key_), tsv(generation), tx)
+                    .first &&
+                lmdb_.Store(table_, tsv(free_key_), {}, tx).first;
+
+            if (false == stored) {
+                throw std::runtime_error{"Failed to update configuration"};
+            }
+
+            if (false == tx.Finalize(true)) {
+                throw std::runtime_error{"Failed to commit transaction"};
+            }
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+            cleanup();
+
+            return false;
+        }
+
+        const auto previous = generation_;
+        files_.swap(files);
+        files.clear();
+        generation_ = generation;
+        next_position_ = next;
+        free_ = FreeSpace{};
+        released_.clear();
+        remove_files(previous);
+        LogNormal("Compacted ")(items.size())(" items (")(live)(
+            " bytes) into ")(files_.size())(" files")
+            .Flush();
+
+        return true;
+    }
     auto create_or_load(
         const std::string& prefix,
+        const Generation generation,
         const FileCounter file,
-        std::vector<boost::iostreams::mapped_file>& output) noexcept -> void
+        Files& output) noexcept -> void
     {
         auto params = boost::iostreams::mapped_file_params{
-            calculate_file_name(prefix, file)};
+            calculate_file_name(prefix, generation, file)};
         params.flags = boost::iostreams::mapped_file::readwrite;
         const auto& path = params.path;
         LogTrace(OT_METHOD)(__FUNCTION__)(": initializing file ")(path).Flush();
@@ -134,6 +332,32 @@ struct MappedFileStorage::Imp {
             OT_FAIL;
         }
     }
+    auto file_prefix(const Generation generation) const noexcept -> std::string
+    {
+        if (0u == generation) { return filename_prefix_; }
+
+        return filename_prefix_ + '.' + std::to_string(generation) + '.';
+    }
+    // NOTE This check prevents writing past end of file
+    auto fit(IndexData& index) const noexcept -> void
+    {
+        const auto start = get_offset(index.position_).first;
+        const auto end = get_offset(index.position_ + (index.size_ - 1)).first;
+
+        if (end != start) {
+            OT_ASSERT(end > start);
+
+            index.position_ = get_start_position(end);
+        }
+    }
+    auto free_regions() const noexcept -> std::size_t
+    {
+        auto output = released_.size();
+
+        for (const auto& list : free_) { output += list.size(); }
+
+        return output;
+    }
     auto get_read_view(const IndexData& index) noexcept -> ReadView
     {
         const auto [file, offset] = get_offset(index.position_);
@@ -164,64 +388,138 @@ struct MappedFileStorage::Imp {
             return output();
         }
 
-        increment_index(index, bytes);
-        LogDebug(OT_METHOD)(__FUNCTION__)(": Storing new item at position ")(
-            index.position_)
-            .Flush();
+        const auto previous = index;
+        auto change = Change{};
+        change.next_position_ = next_position_;
+        const auto fail = [&] {
+            revert(change);
+            index = previous;
+
+            return WritableView{};
+        };
+        const auto reused = allocate(index, bytes, change);
+
+        if (reused) {
+            LogDebug(OT_METHOD)(__FUNCTION__)(
+                ": Storing new item in free space at position ")(
+                index.position_)
+                .Flush();
+        } else {
+            increment_index(index, bytes);
+            LogDebug(OT_METHOD)(__FUNCTION__)(
+                ": Storing new item at position ")(index.position_)
+                .Flush();
+        }
+
         const auto nextPosition = index.position_ + bytes;
 
-        if (cb && (false == cb(tx))) { return {}; }
+        if (cb && (false == cb(tx))) { return fail(); }
 
-        if (false == update_next_position(nextPosition, tx)) {
+        if ((false == reused) &&
+            (false == update_next_position(nextPosition, tx))) {
             LogOutput(OT_METHOD)(__FUNCTION__)(
                 ": Failed to update next write position")
                 .Flush();
 
-            return {};
+            return fail();
+        }
+
+        change.released_ = release(previous);
+
+        // NOTE the transaction holds the write lock until it is finalized, so
+        // no other write can modify the free space map before these callbacks
+        // execute. The map is serialized once per transaction regardless of
+        // how many writes modified it.
+        if ((reused || change.released_) && (false == free_dirty_)) {
+            free_dirty_ = true;
+            tx.OnCommit([this](auto& tx) {
+                free_dirty_ = false;
+
+                if (store_free_space(tx)) { return true; }
+
+                LogOutput(OT_METHOD)(__FUNCTION__)(
+                    ": Failed to update free space map")
+                    .Flush();
+
+                return false;
+            });
         }
 
+        tx.OnFinalize([this, change](const bool committed) {
+            free_dirty_ = false;
+
+            if (false == committed) { revert(change); }
+        });
+
         return output();
     }
     auto increment_index(IndexData& index, std::size_t bytes) noexcept -> void
     {
         index.size_ = bytes;
         index.position_ = next_position_;
-
-        {
-            // NOTE This check prevents writing past end of file
-            const auto start = get_offset(index.position_).first;
-            const auto end =
-                get_offset(index.position_ + (index.size_ - 1)).first;
-
-            if (end != start) {
-                OT_ASSERT(end > start);
-
-                index.position_ = get_start_position(end);
-            }
-        }
+        fit(index);
     }
     auto init_files(
         const std::string& prefix,
-        const IndexData::MemoryPosition position) noexcept
-        -> std::vector<boost::iostreams::mapped_file>
+        const Generation generation,
+        const IndexData::MemoryPosition position) noexcept -> Files
     {
-        auto output = std::vector<boost::iostreams::mapped_file>{};
+        auto output = Files{};
         const auto target = get_file_count(position);
         output.reserve(target);
 
         for (auto i = FileCounter{0}; i < target; ++i) {
-            create_or_load(prefix, i, output);
+            create_or_load(prefix, generation, i, output);
         }
 
         return output;
     }
-    auto load_position(opentxs::storage::lmdb::LMDB& db) noexcept
-        -> IndexData::MemoryPosition
+    auto is_current(const std::string& filename) const noexcept -> bool
+    {
+        static const auto suffix = std::string{".dat"};
+        const auto prefix = file_prefix(generation_);
+        const auto size = filename.size();
+
+        if (size <= (prefix.size() + suffix.size())) { return false; }
+        if (0 != filename.compare(0, prefix.size(), prefix)) { return false; }
+
+        const auto number = filename.substr(
+            prefix.size(), size - prefix.size() - suffix.size());
+
+        return std::all_of(number.begin(), number.end(), [](const auto c) {
+            return ('0' <= c) && ('9' >= c);
+        });
+    }
+    auto load_free_space(opentxs::storage::lmdb::LMDB& db) noexcept
+        -> FreeSpace
+    {
+        auto output = FreeSpace{};
+        auto cb = [&output](const auto in) {
+            const auto count = in.size() / sizeof(IndexData);
+
+            for (auto i = std::size_t{0}; i < count; ++i) {
+                auto region = IndexData{};
+                std::memcpy(
+                    static_cast<void*>(&region),
+                    in.data() + (i * sizeof(region)),
+                    sizeof(region));
+
+                if (0u == region.size_) { continue; }
+
+                output.at(size_class(region.size_)).emplace_back(region);
+            }
+        };
+        db.Load(table_, tsv(free_key_), cb);
+
+        return output;
+    }
+    auto load_value(opentxs::storage::lmdb::LMDB& db, const std::size_t key)
+        const noexcept -> std::size_t
     {
-        auto output = IndexData::MemoryPosition{0};
+        auto output = std::size_t{0};
 
-        if (false == db.Exists(table_, tsv(key_))) {
-            db.Store(table_, tsv(key_), tsv(output));
+        if (false == db.Exists(table_, tsv(key))) {
+            db.Store(table_, tsv(key), tsv(output));
 
             return output;
         }
@@ -232,10 +530,177 @@ struct MappedFileStorage::Imp {
             std::memcpy(&output, in.data(), in.size());
         };
 
-        db.Load(table_, tsv(key_), cb);
+        db.Load(table_, tsv(key), cb);
 
         return output;
     }
+    auto release(const IndexData& region) noexcept -> bool
+    {
+        if (min_fragment_ > region.size_) { return false; }
+
+        if (max_free_regions_ <= free_regions()) {
+            LogDebug(OT_METHOD)(__FUNCTION__)(
+                ": Free space map is full. Dropping region at position ")(
+                region.position_)
+                .Flush();
+
+            return false;
+        }
+
+        released_.emplace_back(region);
+
+        return true;
+    }
+    // NOTE changes must be reverted in the opposite order they were made
+    auto revert(const Change& change) noexcept -> void
+    {
+        if (change.released_) {
+            OT_ASSERT(false == released_.empty());
+
+            released_.pop_back();
+        }
+
+        if (change.fragment_.has_value()) {
+            const auto& fragment = change.fragment_.value();
+            auto& list = free_.at(size_class(fragment.size_));
+            const auto it =
+                std::find_if(list.begin(), list.end(), [&](const auto& in) {
+                    return in.position_ == fragment.position_;
+                });
+
+            OT_ASSERT(list.end() != it);
+
+            list.erase(it);
+        }
+
+        if (change.allocated_.has_value()) {
+            add_free(change.allocated_.value());
+        }
+
+        next_position_ = change.next_position_;
+    }
+    auto remove_files(const Generation generation) const noexcept -> void
+    {
+        for (auto i = FileCounter{0};; ++i) {
+            const auto path = calculate_file_name(path_prefix_, generation, i);
+
+            try {
+                if (false == fs::exists(path)) { break; }
+
+                fs::remove(path);
+            } catch (const std::exception& e) {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+                break;
+            }
+        }
+    }
+    // NOTE files from other generations are left behind if the process
+    // terminates during or immediately after a compaction
+    auto remove_stale_files() const noexcept -> void
+    {
+        try {
+            for (const auto& entry : fs::directory_iterator{path_prefix_}) {
+                if (false == fs::is_regular_file(entry.status())) { continue; }
+
+                const auto name = entry.path().filename().string();
+
+                if (0 != name.compare(
+                             0, filename_prefix_.size(), filename_prefix_)) {
+                    continue;
+                }
+
+                if (".dat" != entry.path().extension().string()) { continue; }
+
+                if (is_current(name)) { continue; }
+
+                LogNormal("Removing stale file ")(entry.path().string())
+                    .Flush();
+                fs::remove(entry.path());
+            }
+        } catch (const std::exception& e) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+        }
+    }
+    auto report(const IndexTables& tables) const noexcept -> Report
+    {
+        auto output = Report(files_.size());
+        const auto used = [&](const IndexData& index) -> FileReport& {
+            const auto [file, offset] = get_offset(index.position_);
+            auto& out = output.at(file);
+            out.used_ = std::max(out.used_, offset + index.size_);
+
+            return out;
+        };
+
+        for (auto i = std::size_t{0}; i < output.size(); ++i) {
+            output.at(i).file_ = i;
+        }
+
+        for (const auto table : tables) {
+            lmdb_.Read(
+                table,
+                [&](const auto, const auto value) -> bool {
+                    auto index = IndexData{};
+
+                    if (sizeof(index) != value.size()) { return true; }
+
+                    std::memcpy(
+                        static_cast<void*>(&index), value.data(), value.size());
+
+                    if (0u == index.size_) { return true; }
+
+                    if (get_offset(index.position_).first >= output.size()) {
+                        return true;
+                    }
+
+                    used(index).live_ += index.size_;
+
+                    return true;
+                },
+                LMDB::Dir::Forward);
+        }
+
+        const auto unused = [&](const IndexData& region) {
+            if (get_offset(region.position_).first >= output.size()) { return; }
+
+            used(region).free_ += region.size_;
+        };
+
+        for (const auto& list : free_) {
+            std::for_each(list.begin(), list.end(), unused);
+        }
+
+        std::for_each(released_.begin(), released_.end(), unused);
+
+        {
+            const auto [file, offset] = get_offset(next_position_);
+
+            if (file < output.size()) {
+                auto& last = output.at(file);
+                last.used_ = std::max(last.used_, offset);
+            }
+        }
+
+        return output;
+    }
+    auto store_free_space(LMDB::Transaction& tx) noexcept -> bool
+    {
+        auto bytes = Space{};
+        bytes.reserve(free_regions() * sizeof(IndexData));
+        const auto write = [&](const IndexData& region) {
+            const auto* it = reinterpret_cast<const std::byte*>(&region);
+            bytes.insert(bytes.end(), it, it + sizeof(region));
+        };
+
+        for (const auto& list : free_) {
+            std::for_each(list.begin(), list.end(), write);
+        }
+
+        std::for_each(released_.begin(), released_.end(), write);
+
+        return lmdb_.Store(table_, tsv(free_key_), reader(bytes), tx).first;
+    }
     auto update_next_position(
         IndexData::MemoryPosition position,
         LMDB::Transaction& tx) noexcept -> bool
@@ -259,14 +724,22 @@ struct MappedFileStorage::Imp {
         const std::string& basePath,
         const std::string filenamePrefix,
         int table,
-        std::size_t key) noexcept(false)
+        std::size_t positionKey,
+        std::size_t freeSpaceKey,
+        std::size_t generationKey) noexcept(false)
         : lmdb_(lmdb)
         , path_prefix_(basePath)
         , filename_prefix_(filenamePrefix)
         , table_(table)
-        , key_(key)
-        , next_position_(load_position(lmdb_))
-        , files_(init_files(path_prefix_, next_position_))
+        , key_(positionKey)
+        , free_key_(freeSpaceKey)
+        , generation_key_(generationKey)
+        , generation_(load_value(lmdb_, generation_key_))
+        , next_position_(load_value(lmdb_, key_))
+        , free_(load_free_space(lmdb_))
+        , released_()
+        , free_dirty_(false)
+        , files_(init_files(path_prefix_, generation_, next_position_))
     {
         static_assert(1 == get_file_count(0));
         static_assert(1 == get_file_count(1));
@@ -282,6 +755,10 @@ struct MappedFileStorage::Imp {
         static_assert(Offset{1, 1} == get_offset(target_file_size_ + 1u));
         static_assert(0 == get_start_position(0));
         static_assert(target_file_size_ == get_start_position(1));
+        static_assert(0 == size_class(1));
+        static_assert(1 == size_class(2));
+        static_assert(1 == size_class(3));
+        static_assert(10 == size_class(1024));
 
         {
             const auto offset = get_offset(next_position_);
@@ -292,6 +769,8 @@ struct MappedFileStorage::Imp {
 
             OT_ASSERT(files_.size() == (offset.first + 1));
         }
+
+        remove_stale_files();
     }
 };
 
@@ -300,14 +779,28 @@ MappedFileStorage::MappedFileStorage(
     const std::string& basePath,
     const std::string filenamePrefix,
     int table,
-    std::size_t key) noexcept(false)
+    std::size_t positionKey,
+    std::size_t freeSpaceKey,
+    std::size_t generationKey) noexcept(false)
     : lmdb_(lmdb)
-    , imp_p_(std::make_unique<Imp>(lmdb, basePath, filenamePrefix, table, key))
+    , imp_p_(std::make_unique<Imp>(
+          lmdb,
+          basePath,
+          filenamePrefix,
+          table,
+          positionKey,
+          freeSpaceKey,
+          generationKey))
     , imp_(*imp_p_)
 {
     OT_ASSERT(imp_p_);
 }
 
+auto MappedFileStorage::compact(const IndexTables& tables) noexcept -> bool
+{
+    return imp_.compact(tables);
+}
+
 auto MappedFileStorage::get_read_view(const IndexData& index) const noexcept
     -> ReadView
 {
@@ -331,5 +824,11 @@ auto MappedFileStorage::get_write_view(
     return imp_.get_write_view(tx, index, {}, size);
 }
 
+auto MappedFileStorage::report(const IndexTables& tables) const noexcept
+    -> Report
+{
+    return imp_.report(tables);
+}
+
 MappedFileStorage::~MappedFileStorage() = default;
 }  // namespace opentxs::util
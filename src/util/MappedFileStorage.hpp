@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Version.hpp"
@@ -25,14 +26,39 @@ struct IndexData {
     ItemSize size_{};
 };
 
-class MappedFileStorage
+class OPENTXS_EXPORT MappedFileStorage
 {
+public:
+    struct FileReport {
+        std::size_t file_{};
+        // Bytes between the start of the file and the end of the last item
+        std::size_t used_{};
+        // Bytes occupied by items which are referenced by an index
+        std::size_t live_{};
+        // Bytes held in the free space map
+        std::size_t free_{};
+
+        auto dead() const noexcept -> std::size_t { return used_ - live_; }
+    };
+    using Report = std::vector<FileReport>;
+
 protected:
     using LMDB = opentxs::storage::lmdb::LMDB;
     using UpdateCallback = std::function<bool(LMDB::Transaction&)>;
+    // Tables whose values are serialized IndexData for items in this storage
+    using IndexTables = std::vector<int>;
 
     LMDB& lmdb_;
 
+    // Rewrites every item referenced by the index tables into a new set of
+    // files and updates the indices in a single transaction.
+    //
+    // NOTE: no views returned by get_read_view or get_write_view may be in use
+    // while this function executes, so it should only be called before the
+    // storage is made available to other components.
+    auto compact(const IndexTables& tables) noexcept -> bool;
+    auto report(const IndexTables& tables) const noexcept -> Report;
+
     // NOTE: this class performs no locking. Inheritors must ensure these
     // functions are not called simultaneously from multiple threads.
     auto get_read_view(const IndexData& index) const noexcept -> ReadView;
@@ -40,12 +66,20 @@ protected:
     // supply an existing IndexData if you want to (potentially) replace the
     // existing item. An existing item will be overwritten if the size of the
     // old items matches the size of the new item; to do otherwise would be
-    // madness. If the size doesn't match then space will be allocated at the
-    // end of the file and we just forget about the old data.
+    // madness. If the size doesn't match then space will be allocated from the
+    // free space map if a large enough region is available, otherwise at the
+    // end of the file. The space used by the old data is added to the free
+    // space map but is not reused until the storage is reopened, since views
+    // of the old data may still exist.
     //
     // Regardless after this function is called the supplied index will be
     // updated to the location at which the return value points so you should
-    // retain that index for future calls to get_read_view.
+    // retain that index for future calls to get_read_view. If this function
+    // fails the index is left unchanged.
+    //
+    // Changes to the free space map are reverted if the transaction is not
+    // committed, so the supplied transaction must be finalized before any
+    // other transaction writes to this storage.
     //
     // Storing a zero byte object is not allowed.
     auto get_write_view(
@@ -63,7 +97,9 @@ protected:
         const std::string& basePath,
         const std::string filenamePrefix,
         int table,
-        std::size_t key) noexcept(false);
+        std::size_t positionKey,
+        std::size_t freeSpaceKey,
+        std::size_t generationKey) noexcept(false);
 
     virtual ~MappedFileStorage();
 
@@ -0,0 +1,182 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/BlockParser.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/blockchain/block/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Identifier.hpp"
+
+namespace
+{
+// NOTE only allocations made by the calling thread are counted so that
+// background threads started by the test environment do not affect the result
+thread_local std::size_t allocations_{0};
+}  // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    ++allocations_;
+
+    if (auto* out = std::malloc((0u == size) ? 1u : size); nullptr != out) {
+        return out;
+    }
+
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* ptr) noexcept -> void { std::free(ptr); }
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+namespace ottest
+{
+struct Bench_BlockParser : public Test_BlockParser {
+    using Clock = std::chrono::steady_clock;
+    using Microseconds = std::chrono::microseconds;
+
+    static constexpr auto rounds_ = std::size_t{10};
+};
+
+TEST_F(Bench_BlockParser, lazy_parse)
+{
+    std::cout << "Block size: " << raw_.size() << " bytes, " << transactions_
+              << " transactions\n";
+
+    auto parseAllocations = std::size_t{0};
+    const auto start = Clock::now();
+
+    for (auto i = std::size_t{0}; i < rounds_; ++i) {
+        const auto before = allocations_;
+        const auto pBlock = parse();
+        parseAllocations += allocations_ - before;
+
+        ASSERT_TRUE(pBlock);
+    }
+
+    const auto parseTime =
+        std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+    const auto pBlock = parse();
+
+    ASSERT_TRUE(pBlock);
+
+    const auto before = allocations_;
+    const auto materializeStart = Clock::now();
+
+    for (const auto& tx : *pBlock) { ASSERT_TRUE(tx); }
+
+    const auto materializeTime = std::chrono::duration_cast<Microseconds>(
+        Clock::now() - materializeStart);
+    const auto materializeAllocations = allocations_ - before;
+    parseAllocations /= rounds_;
+
+    EXPECT_LT(2u * parseAllocations, materializeAllocations);
+
+    std::cout << "  parse: " << (parseTime.count() / rounds_)
+              << " microseconds, " << parseAllocations << " allocations\n"
+              << "  instantiate all transactions: " << materializeTime.count()
+              << " microseconds, " << materializeAllocations
+              << " allocations\n";
+}
+
+TEST_F(Bench_BlockParser, find_matches)
+{
+    using Subchain = ot::blockchain::crypto::Subchain;
+    constexpr auto target = std::size_t{1234};
+    const auto pBlock = parse();
+
+    ASSERT_TRUE(pBlock);
+
+    auto patterns = Block::Patterns{};
+    patterns.emplace_back(
+        Block::ElementID{
+            0,
+            Block::SubchainID{Subchain::External, api_.Factory().Identifier()}},
+        pubkey_hashes_.at(2u * target));
+    const auto before = allocations_;
+    const auto start = Clock::now();
+    const auto [inputs, outputs] =
+        pBlock->FindMatches(ot::blockchain::filter::Type::ES, {}, patterns);
+    const auto elapsed =
+        std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+    const auto allocations = allocations_ - before;
+
+    EXPECT_EQ(outputs.size(), 1u);
+
+    std::cout << "  find matches: " << elapsed.count() << " microseconds, "
+              << allocations << " allocations\n";
+}
+// NOTE a block received from a peer used to be parsed by the peer, copied
+// into a message for the node, copied again into a message for the block
+// oracle and parsed twice more before it was stored
+TEST_F(Bench_BlockParser, submit_block)
+{
+    auto onceAllocations = std::size_t{0};
+    auto onceTime = Microseconds{0};
+    auto threeAllocations = std::size_t{0};
+    auto threeTime = Microseconds{0};
+
+    for (auto i = std::size_t{0}; i < rounds_; ++i) {
+        {
+            const auto before = allocations_;
+            const auto start = Clock::now();
+            const auto pBlock = parse();
+            onceTime +=
+                std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+            onceAllocations += allocations_ - before;
+
+            ASSERT_TRUE(pBlock);
+        }
+
+        {
+            const auto before = allocations_;
+            const auto start = Clock::now();
+            const auto first = parse();
+            const auto node = ot::Space{raw_};
+            const auto oracle = ot::Space{node};
+            const auto second = api_.Factory().BitcoinBlock(
+                chain_, ot::reader(oracle));
+            const auto third = api_.Factory().BitcoinBlock(
+                chain_, ot::reader(oracle));
+            threeTime +=
+                std::chrono::duration_cast<Microseconds>(Clock::now() - start);
+            threeAllocations += allocations_ - before;
+
+            ASSERT_TRUE(first);
+            ASSERT_TRUE(second);
+            ASSERT_TRUE(third);
+        }
+    }
+
+    onceAllocations /= rounds_;
+    threeAllocations /= rounds_;
+
+    EXPECT_LT(2u * onceAllocations, threeAllocations);
+
+    std::cout << "  parse once: " << (onceTime.count() / rounds_)
+              << " microseconds, " << onceAllocations << " allocations\n"
+              << "  parse three times: " << (threeTime.count() / rounds_)
+              << " microseconds, " << threeAllocations << " allocations\n";
+}
+}  // namespace ottest
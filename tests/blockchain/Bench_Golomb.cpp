@@ -0,0 +1,74 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "bip158/Bip158.hpp"
+#include "bip158/bch_filter_1307723.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace ottest
+{
+TEST(Bench_Golomb, decode)
+{
+    using Clock = std::chrono::steady_clock;
+    using ot::blockchain::filter::Type;
+    static const auto params =
+        ot::blockchain::internal::GetFilterParams(Type::Basic_BCHVariant);
+    constexpr auto rounds = std::size_t{10};
+    const auto& api = ot::Context().StartClient({}, 0);
+    const auto& filter = bch_filter_1307723_;
+    const auto blockHash = api.Factory().Data(
+        "c28ca17ec9727809b449447eac0ba416a0b347f3836843f313030000000000"
+        "00",
+        ot::StringStyle::Hex);
+    const auto pGCS = ot::factory::GCS(
+        api,
+        Type::Basic_BCHVariant,
+        ot::blockchain::internal::BlockHashToFilterKey(blockHash->Bytes()),
+        ot::ReadView{
+            reinterpret_cast<const char*>(filter.data()), filter.size()});
+
+    ASSERT_TRUE(pGCS);
+
+    const auto& gcs = *pGCS;
+    const auto N = gcs.ElementCount();
+    const auto compressed = gcs.Compressed();
+    const auto time = [&](const auto& decode) {
+        const auto start = Clock::now();
+
+        for (auto i = std::size_t{0}; i < rounds; ++i) {
+            EXPECT_EQ(decode(N, params.first, compressed).size(), N);
+        }
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - start);
+    };
+    const auto reference = time([](auto n, auto p, const auto& in) {
+        return ot::gcs::GolombDecodeReference(n, p, in);
+    });
+    const auto fast = time([](auto n, auto p, const auto& in) {
+        return ot::gcs::GolombDecode(n, p, in);
+    });
+
+    std::cout << "Decoded " << rounds << " x " << N << " elements\n"
+              << "  reference: " << reference.count() << " microseconds\n"
+              << "  fast: " << fast.count() << " microseconds\n";
+}
+}  // namespace ottest
@@ -0,0 +1,261 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif  // __GLIBC__
+#include <boost/filesystem.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "blockchain/database/Wallet.hpp"
+#include "blockchain/database/common/Database.hpp"
+#include "internal/api/Api.hpp"
+#include "internal/api/client/Client.hpp"
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/client/Blockchain.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Element.hpp"
+#include "opentxs/blockchain/crypto/HD.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/blockchain/crypto/Types.hpp"
+#include "opentxs/client/OTAPI_Exec.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/PasswordPrompt.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/identity/Nym.hpp"
+
+namespace ot = opentxs;
+namespace fs = boost::filesystem;
+
+namespace ottest
+{
+using Chain = ot::blockchain::Type;
+using Position = ot::blockchain::block::Position;
+using Subchain = ot::blockchain::crypto::Subchain;
+using Transaction = ot::blockchain::block::bitcoin::Transaction;
+using WalletDB = ot::blockchain::database::Wallet;
+
+constexpr auto chain_ = Chain::Bitcoin;
+constexpr auto outputs_per_tx_ = std::uint32_t{100};
+constexpr auto txs_per_block_ = std::size_t{10};
+
+// NOTE includes allocations made by other threads while the wallet is
+// populated, so the result is approximate
+auto allocated() noexcept -> std::size_t
+{
+#if defined(__GLIBC__) &&                                                      \
+    ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+    return ::mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+    // NOTE mallinfo reports int fields which wrap above 2 GiB
+    return static_cast<unsigned int>(::mallinfo().uordblks);
+#else
+    return 0;
+#endif  // __GLIBC__
+}
+
+auto elapsed(const std::chrono::steady_clock::time_point start) noexcept
+    -> double
+{
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+// One input spending an unknown outpoint, outputs_per_tx_ P2PKH outputs
+// paying the same key
+auto raw_transaction(const std::size_t sequence, const ot::Data& pubkeyHash)
+    -> std::vector<std::byte>
+{
+    auto out = std::vector<std::byte>{};
+    const auto append = [&](const void* data, const std::size_t size) {
+        const auto* it = static_cast<const std::byte*>(data);
+        out.insert(out.end(), it, it + size);
+    };
+    const auto le32 = [&](const std::uint32_t value) {
+        for (auto i = 0u; i < 4u; ++i) {
+            const auto shifted = (value >> (8u * i)) & 0xffu;
+            out.emplace_back(static_cast<std::byte>(shifted));
+        }
+    };
+    const auto byte = [&](const std::uint8_t value) {
+        out.emplace_back(static_cast<std::byte>(value));
+    };
+
+    le32(1u);
+    byte(1u);
+    auto previous = std::array<std::byte, 32>{};
+    std::memcpy(previous.data(), &sequence, sizeof(sequence));
+    append(previous.data(), previous.size());
+    le32(0u);
+    byte(0u);
+    le32(0xffffffffu);
+    static_assert(outputs_per_tx_ < 0xfd);
+    byte(static_cast<std::uint8_t>(outputs_per_tx_));
+
+    for (auto i = std::uint32_t{0}; i < outputs_per_tx_; ++i) {
+        const auto value = std::uint64_t{10000} + i;
+        le32(static_cast<std::uint32_t>(value));
+        le32(static_cast<std::uint32_t>(value >> 32u));
+        byte(25u);
+        byte(0x76);
+        byte(0xa9);
+        byte(20u);
+        append(pubkeyHash.data(), pubkeyHash.size());
+        byte(0x88);
+        byte(0xac);
+    }
+
+    le32(0u);
+
+    return out;
+}
+
+TEST(Bench_OutputIndex, populate)
+{
+#if !defined(__GLIBC__)
+    GTEST_SKIP() << "Allocation statistics are not available";
+#endif  // __GLIBC__
+
+    const auto& api = ot::Context().StartClient({}, 0);
+    const auto& legacy =
+        dynamic_cast<const ot::api::internal::Context&>(ot::Context()).Legacy();
+    const auto& blockchain =
+        dynamic_cast<const ot::api::client::internal::Blockchain&>(
+            api.Blockchain());
+    const auto reason = api.Factory().PasswordPrompt(__FUNCTION__);
+    const auto seed = api.Exec().Wallet_ImportSeed(
+        "response seminar brave tip suit recall often sound stick owner "
+        "lottery motion",
+        "");
+    const auto nym = api.Wallet().Nym(reason, "Alice", {seed, 0});
+
+    ASSERT_TRUE(nym);
+
+    const auto& nymID = nym->ID();
+    const auto accountID = api.Blockchain().NewHDSubaccount(
+        nymID, ot::BlockchainAccountType::BIP44, chain_, reason);
+    const auto& account = api.Blockchain().HDSubaccount(nymID, accountID);
+    const auto& element = account.BalanceElement(Subchain::External, 0);
+    const auto key = element.KeyID();
+    const auto pubkeyHash = element.PubkeyHash();
+    const auto path = fs::temp_directory_path() /
+                      fs::unique_path("opentxs-outputs-%%%%-%%%%-%%%%-%%%%");
+    fs::create_directories(path);
+    auto common =
+        std::make_unique<ot::blockchain::database::common::Database>(
+            api, blockchain, legacy, path.string(), ot::ArgList{});
+    const auto indices = [] {
+        auto out = std::vector<std::uint32_t>{};
+
+        for (auto i = std::uint32_t{0}; i < outputs_per_tx_; ++i) {
+            out.emplace_back(i);
+        }
+
+        return out;
+    }();
+    auto sequence = std::size_t{0};
+
+    for (const auto count : {1000, 10000, 100000}) {
+        const auto txs = static_cast<std::size_t>(count) / outputs_per_tx_;
+        auto transactions = std::vector<std::unique_ptr<const Transaction>>{};
+        auto positions = std::vector<Position>{};
+        transactions.reserve(txs);
+
+        for (auto i = std::size_t{0}; i < txs; ++i, ++sequence) {
+            const auto raw = raw_transaction(sequence, pubkeyHash);
+            auto tx = api.Factory().BitcoinTransaction(
+                chain_,
+                ot::ReadView{
+                    reinterpret_cast<const char*>(raw.data()), raw.size()},
+                false);
+
+            ASSERT_TRUE(tx);
+
+            auto& internal =
+                dynamic_cast<ot::blockchain::block::bitcoin::internal::
+                                 Transaction&>(const_cast<Transaction&>(*tx));
+
+            for (const auto index : indices) {
+                ASSERT_TRUE(internal.ForTestingOnlyAddKey(index, key));
+            }
+
+            transactions.emplace_back(std::move(tx));
+        }
+
+        for (auto i = std::size_t{0}; i < txs; i += txs_per_block_) {
+            auto hash = std::array<std::byte, 32>{};
+            std::memcpy(hash.data(), &i, sizeof(i));
+            positions.emplace_back(
+                static_cast<ot::blockchain::block::Height>(i / txs_per_block_),
+                api.Factory().Data(ot::ReadView{
+                    reinterpret_cast<const char*>(hash.data()), hash.size()}));
+        }
+
+        auto wallet =
+            std::make_unique<WalletDB>(api, blockchain, *common, chain_);
+        const auto before = allocated();
+        auto start = std::chrono::steady_clock::now();
+
+        for (auto i = std::size_t{0}; i < txs; ++i) {
+            ASSERT_TRUE(wallet->AddConfirmedTransaction(
+                accountID,
+                Subchain::External,
+                positions.at(i / txs_per_block_),
+                i % txs_per_block_,
+                indices,
+                *transactions.at(i)));
+        }
+
+        const auto populate = elapsed(start);
+        const auto after = allocated();
+        start = std::chrono::steady_clock::now();
+        const auto balance = wallet->GetBalance(nymID, accountID);
+        const auto balanceTime = elapsed(start);
+        start = std::chrono::steady_clock::now();
+        const auto outputs = wallet->GetOutputs(
+            nymID, accountID, ot::blockchain::node::Wallet::TxoState::All);
+        const auto outputsTime = elapsed(start);
+        start = std::chrono::steady_clock::now();
+        const auto unspent =
+            wallet->GetUnspentOutputs(accountID, Subchain::External);
+        const auto unspentTime = elapsed(start);
+
+        EXPECT_EQ(outputs.size(), static_cast<std::size_t>(count));
+        EXPECT_EQ(unspent.size(), static_cast<std::size_t>(count));
+        EXPECT_GT(balance.first, 0);
+
+        std::cout << count << " outputs\n"
+                  << "  populate: " << populate << " ms, "
+                  << static_cast<double>(after - before) /
+                         static_cast<double>(count)
+                  << " bytes per output\n"
+                  << "  GetBalance: " << balanceTime << " ms\n"
+                  << "  GetOutputs: " << outputsTime << " ms\n"
+                  << "  GetUnspentOutputs: " << unspentTime << " ms\n";
+    }
+
+    common.reset();
+    fs::remove_all(path);
+}
+}  // namespace ottest
@@ -0,0 +1,185 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/crypto/HashType.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+// Parses a synthetic block comparable in size to a full mainnet block
+// containing a mix of legacy and segwit transactions
+struct Test_BlockParser : public ::testing::Test {
+    using Block = ot::blockchain::block::bitcoin::Block;
+
+    static constexpr auto chain_ = ot::blockchain::Type::Bitcoin;
+    static constexpr auto transactions_ = std::size_t{4500};
+
+    const ot::api::client::Manager& api_;
+    std::mt19937_64 random_;
+    std::vector<ot::Space> txids_;
+    std::vector<ot::Space> pubkey_hashes_;
+    ot::Space raw_;
+
+    static auto append(ot::Space& out, const ot::Space& in) -> void
+    {
+        out.insert(out.end(), in.begin(), in.end());
+    }
+
+    static auto append(ot::Space& out, std::uint64_t value, std::size_t bytes)
+        -> void
+    {
+        for (auto i = std::size_t{0}; i < bytes; ++i) {
+            out.emplace_back(static_cast<std::byte>(value & 0xff));
+            value >>= 8u;
+        }
+    }
+
+    auto bytes(const std::size_t count) -> ot::Space
+    {
+        auto out = ot::Space{};
+
+        while (out.size() < count) {
+            const auto remaining = count - out.size();
+            append(out, random_(), std::min<std::size_t>(8, remaining));
+        }
+
+        return out;
+    }
+
+    auto hash(const ot::Space& preimage) const -> ot::Space
+    {
+        auto out = ot::Space{};
+
+        EXPECT_TRUE(api_.Crypto().Hash().Digest(
+            ot::crypto::HashType::Sha256D,
+            ot::reader(preimage),
+            ot::writer(out)));
+
+        return out;
+    }
+
+    auto merkle_root() const -> ot::Space
+    {
+        auto row = txids_;
+
+        while (1u < row.size()) {
+            auto next = std::vector<ot::Space>{};
+
+            for (auto i = std::size_t{0}; i < row.size(); i += 2u) {
+                auto preimage = row.at(i);
+                append(preimage, row.at(std::min(i + 1u, row.size() - 1u)));
+                next.emplace_back(hash(preimage));
+            }
+
+            row.swap(next);
+        }
+
+        return row.at(0);
+    }
+
+    auto transaction(const bool segwit) -> ot::Space
+    {
+        constexpr auto outputs = std::size_t{2};
+        auto body = ot::Space{};
+        append(body, 1, 1);
+        append(body, bytes(32));
+        append(body, random_() % 4u, 4);
+
+        if (segwit) {
+            append(body, 0, 1);
+        } else {
+            append(body, 0x6b, 1);
+            append(body, 0x48, 1);
+            append(body, bytes(72));
+            append(body, 0x21, 1);
+            append(body, 0x02, 1);
+            append(body, bytes(32));
+        }
+
+        append(body, 0xffffffff, 4);
+        append(body, outputs, 1);
+
+        for (auto i = std::size_t{0}; i < outputs; ++i) {
+            const auto& pubkeyHash = pubkey_hashes_.emplace_back(bytes(20));
+            append(body, 1000u + (random_() % 100000000u), 8);
+            append(body, 25, 1);
+            append(body, 0x14a976, 3);
+            append(body, pubkeyHash);
+            append(body, 0xac88, 2);
+        }
+
+        auto legacy = ot::Space{};
+        append(legacy, 2, 4);
+        append(legacy, body);
+        append(legacy, 0, 4);
+        txids_.emplace_back(hash(legacy));
+
+        if (false == segwit) { return legacy; }
+
+        auto out = ot::Space{};
+        append(out, 2, 4);
+        append(out, 0x0100, 2);
+        append(out, body);
+        append(out, 2, 1);
+        append(out, 0x48, 1);
+        append(out, bytes(72));
+        append(out, 0x21, 1);
+        append(out, 0x03, 1);
+        append(out, bytes(32));
+        append(out, 0, 4);
+
+        return out;
+    }
+
+    auto parse() const -> std::shared_ptr<const Block>
+    {
+        return api_.Factory().BitcoinBlock(chain_, ot::reader(raw_));
+    }
+
+    Test_BlockParser()
+        : api_(ot::Context().StartClient({}, 0))
+        , random_(0x6f70656e747873)
+        , txids_()
+        , pubkey_hashes_()
+        , raw_()
+    {
+        auto transactions = ot::Space{};
+
+        for (auto i = std::size_t{0}; i < transactions_; ++i) {
+            append(transactions, transaction(1u == (i % 2u)));
+        }
+
+        append(raw_, 0x20000000, 4);
+        append(raw_, bytes(32));
+        append(raw_, merkle_root());
+        append(raw_, 1600000000, 4);
+        append(raw_, 0x1d00ffff, 4);
+        append(raw_, random_(), 4);
+        append(raw_, 0xfd, 1);
+        append(raw_, transactions_, 2);
+        append(raw_, transactions);
+    }
+};
+}  // namespace ottest
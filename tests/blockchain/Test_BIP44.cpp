@@ -4,6 +4,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -37,6 +38,7 @@
 #include "opentxs/crypto/SeedStyle.hpp"
 #include "opentxs/crypto/Types.hpp"
 #include "opentxs/identity/Nym.hpp"
+#include "opentxs/protobuf/HDPath.pb.h"
 #include "paymentcode/VectorsV3.hpp"
 
 namespace
@@ -221,5 +223,32 @@ TEST_F(Test_BIP44, balance_elements)
     }
 }
 
+TEST_F(Test_BIP44, account_child_public_keys)
+{
+    constexpr auto first = ot::Bip32Index{100u};
+    constexpr auto batch = std::size_t{50u};
+    const auto path = account_.Path();
+    const auto test = [&](auto chain, const auto& vector) {
+        const auto keys = api_.Seeds().AccountChildPublicKeys(
+            path, chain, first, batch, reason_);
+
+        ASSERT_EQ(keys.size(), batch);
+
+        for (auto i = std::size_t{0}; i < batch; ++i) {
+            const auto& pKey = keys.at(i);
+
+            ASSERT_TRUE(pKey);
+
+            const auto& key = *pKey;
+
+            EXPECT_FALSE(key.HasPrivate());
+            EXPECT_EQ(key.PublicKey(), ot::reader(vector.at(first + i)));
+        }
+    };
+
+    test(ot::EXTERNAL_CHAIN, external_);
+    test(ot::INTERNAL_CHAIN, internal_);
+}
+
 TEST_F(Test_BIP44, shutdown) { const_cast<ot::Nym_p&>(nym_).reset(); }
 }  // namespace
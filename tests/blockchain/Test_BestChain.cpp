@@ -0,0 +1,152 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/database/BestChain.hpp"
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using BestChain = ot::blockchain::database::BestChain;
+using Height = ot::blockchain::block::Height;
+
+constexpr auto fork_height_ = Height{4999};
+constexpr auto branch_length_ = Height{100};
+
+// Every hash encodes the branch it belongs to and its height
+auto hash(const std::uint8_t branch, const Height height) noexcept
+    -> ot::OTData
+{
+    auto bytes = std::array<std::byte, 32>{};
+    std::memcpy(bytes.data(), &height, sizeof(height));
+    bytes.at(sizeof(height)) = std::byte{branch};
+
+    return ot::Data::Factory(bytes.data(), bytes.size());
+}
+
+auto chain(const std::uint8_t branch, const Height first, const Height last)
+    -> ot::blockchain::node::BestHashes
+{
+    auto output = ot::blockchain::node::BestHashes{};
+
+    for (auto height{first}; height <= last; ++height) {
+        output.emplace(height, hash(branch, height));
+    }
+
+    return output;
+}
+
+TEST(Test_BestChain, apply)
+{
+    auto best = BestChain{};
+
+    EXPECT_EQ(best.Tip().first, -1);
+    EXPECT_EQ(best.Height(hash(0, 0)), -1);
+    EXPECT_TRUE(best.Apply(-1, chain(0, 0, 9)));
+    EXPECT_EQ(best.Tip().first, 9);
+    EXPECT_EQ(best.Height(hash(0, 5)), 5);
+    EXPECT_EQ(best.Hash(5), hash(0, 5));
+    EXPECT_FALSE(best.Apply(9, chain(1, 11, 12)));
+    EXPECT_TRUE(best.Apply(4, chain(1, 5, 7)));
+    EXPECT_EQ(best.Tip().first, 7);
+    EXPECT_EQ(best.Height(hash(0, 5)), -1);
+    EXPECT_EQ(best.Height(hash(0, 8)), -1);
+    EXPECT_EQ(best.Height(hash(1, 5)), 5);
+    EXPECT_EQ(best.Height(hash(0, 4)), 4);
+    EXPECT_TRUE(best.Apply(4, chain(0, 5, 9)));
+    EXPECT_EQ(best.Height(hash(0, 5)), 5);
+    EXPECT_EQ(best.Height(hash(1, 5)), -1);
+    EXPECT_TRUE(best.Apply(2, {}));
+    EXPECT_EQ(best.Tip().first, 2);
+    EXPECT_EQ(best.Height(hash(0, 3)), -1);
+    EXPECT_EQ(best.Recent(5).size(), 3u);
+}
+
+TEST(Test_BestChain, concurrent_reads_during_reorg)
+{
+    constexpr auto reorgs = 200;
+    constexpr auto readers = 4;
+    auto best = BestChain{};
+
+    ASSERT_TRUE(best.Apply(-1, chain(0, 0, fork_height_)));
+
+    auto done = std::atomic<bool>{false};
+    auto threads = std::vector<std::thread>{};
+
+    for (auto r = 0; r < readers; ++r) {
+        threads.emplace_back([&, r] {
+            auto height = Height{r};
+
+            while (false == done.load()) {
+                // Blocks below the fork are never reorganized
+                height = (height + 97) % (fork_height_ + 1);
+
+                EXPECT_EQ(best.Height(hash(0, height)), height);
+
+                // Blocks above the fork belong to one of the two branches
+                const auto branch =
+                    fork_height_ + 1 + (height % branch_length_);
+                const auto a = best.Height(hash(1, branch));
+                const auto b = best.Height(hash(2, branch));
+
+                EXPECT_TRUE((-1 == a) || (branch == a));
+                EXPECT_TRUE((-1 == b) || (branch == b));
+
+                const auto tip = best.Tip();
+
+                EXPECT_TRUE(
+                    (fork_height_ + branch_length_ == tip.first) ||
+                    (fork_height_ == tip.first));
+
+                if (fork_height_ < tip.first) {
+                    const auto found = best.Height(tip.second);
+
+                    // The tip may have been replaced since it was read
+                    EXPECT_TRUE((tip.first == found) || (-1 == found));
+                }
+            }
+        });
+    }
+
+    for (auto i = 0; i < reorgs; ++i) {
+        const auto branch = static_cast<std::uint8_t>(1 + (i % 2));
+
+        ASSERT_TRUE(best.Apply(
+            fork_height_,
+            chain(branch, fork_height_ + 1, fork_height_ + branch_length_)));
+    }
+
+    done.store(true);
+
+    for (auto& thread : threads) { thread.join(); }
+
+    const auto last = fork_height_ + branch_length_;
+
+    EXPECT_EQ(best.Tip().first, last);
+    EXPECT_EQ(best.Height(hash(2, last)), last);
+    EXPECT_EQ(best.Height(hash(1, last)), -1);
+
+    for (auto height = Height{0}; height <= last; ++height) {
+        const auto branch = (height > fork_height_) ? 2 : 0;
+
+        ASSERT_EQ(
+            best.Height(hash(static_cast<std::uint8_t>(branch), height)),
+            height);
+    }
+}
+}  // namespace ottest
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <map>
@@ -75,6 +76,30 @@ struct Test_BitcoinBlock : public ::testing::Test {
         return 0 == failureCount;
     }
 
+    auto CompareGolombCoding(
+        const ot::blockchain::node::GCS& gcs,
+        const std::uint8_t P) const -> bool
+    {
+        const auto N = gcs.ElementCount();
+        const auto compressed = gcs.Compressed();
+        const auto fast = ot::gcs::GolombDecode(N, P, compressed);
+        const auto reference =
+            ot::gcs::GolombDecodeReference(N, P, compressed);
+
+        EXPECT_EQ(fast, reference);
+
+        if (fast != reference) { return false; }
+
+        const auto encoded = ot::gcs::GolombEncode(P, fast);
+        const auto encodedReference =
+            ot::gcs::GolombEncodeReference(P, reference);
+
+        EXPECT_EQ(encoded, encodedReference);
+        EXPECT_EQ(encoded, compressed);
+
+        return (encoded == encodedReference) && (encoded == compressed);
+    }
+
     auto CompareToOracle(
         const ot::blockchain::Type chain,
         const ot::blockchain::filter::Type filterType,
@@ -357,6 +382,25 @@ TEST_F(Test_BitcoinBlock, gcs_headers)
     }
 }
 
+TEST_F(Test_BitcoinBlock, golomb_coding)
+{
+    static const auto params = ot::blockchain::internal::GetFilterParams(
+        ot::blockchain::filter::Type::Basic_BIP158);
+
+    for (const auto& vector : bip_158_vectors_) {
+        const auto blockHash = vector.Block(api_);
+        const auto encodedFilter = vector.Filter(api_);
+        const auto pGCS = ot::factory::GCS(
+            api_,
+            ot::blockchain::filter::Type::Basic_BIP158,
+            ot::blockchain::internal::BlockHashToFilterKey(blockHash->Bytes()),
+            encodedFilter->Bytes());
+
+        ASSERT_TRUE(pGCS);
+        EXPECT_TRUE(CompareGolombCoding(*pGCS, params.first));
+    }
+}
+
 TEST_F(Test_BitcoinBlock, serialization)
 {
     for (const auto& vector : bip_158_vectors_) {
@@ -437,4 +481,137 @@ TEST_F(Test_BitcoinBlock, bch_filter_1307723)
 
     EXPECT_EQ(header.get(), expectedHeader.get());
 }
+
+TEST_F(Test_BitcoinBlock, golomb_coding_large_filter)
+{
+    using ot::blockchain::filter::Type;
+    static const auto params =
+        ot::blockchain::internal::GetFilterParams(Type::Basic_BCHVariant);
+    const auto& filter = bch_filter_1307723_;
+    const auto blockHash = api_.Factory().Data(
+        "c28ca17ec9727809b449447eac0ba416a0b347f3836843f313030000000000"
+        "00",
+        ot::StringStyle::Hex);
+    const auto pGCS = ot::factory::GCS(
+        api_,
+        Type::Basic_BCHVariant,
+        ot::blockchain::internal::BlockHashToFilterKey(blockHash->Bytes()),
+        ot::ReadView{
+            reinterpret_cast<const char*>(filter.data()), filter.size()});
+
+    ASSERT_TRUE(pGCS);
+    EXPECT_TRUE(CompareGolombCoding(*pGCS, params.first));
+}
+
+TEST_F(Test_BitcoinBlock, golomb_coding_empty)
+{
+    constexpr auto P = std::uint8_t{19};
+    const auto empty = ot::Space{};
+
+    EXPECT_TRUE(ot::gcs::GolombDecode(0, P, empty).empty());
+    EXPECT_TRUE(ot::gcs::GolombEncode(P, {}).empty());
+    EXPECT_TRUE(ot::gcs::GolombEncodeReference(P, {}).empty());
+
+    // NOTE bits past the end of the input read as zero
+    const auto expected = std::vector<std::uint64_t>(4u, 0u);
+
+    EXPECT_EQ(ot::gcs::GolombDecode(4, P, empty), expected);
+    EXPECT_EQ(ot::gcs::GolombDecodeReference(4, P, empty), expected);
+}
+
+TEST_F(Test_BitcoinBlock, golomb_coding_truncated)
+{
+    static const auto params = ot::blockchain::internal::GetFilterParams(
+        ot::blockchain::filter::Type::Basic_BIP158);
+    const auto& P = params.first;
+
+    for (const auto& vector : bip_158_vectors_) {
+        const auto blockHash = vector.Block(api_);
+        const auto encodedFilter = vector.Filter(api_);
+        const auto pGCS = ot::factory::GCS(
+            api_,
+            ot::blockchain::filter::Type::Basic_BIP158,
+            ot::blockchain::internal::BlockHashToFilterKey(blockHash->Bytes()),
+            encodedFilter->Bytes());
+
+        ASSERT_TRUE(pGCS);
+
+        const auto N = pGCS->ElementCount();
+        const auto compressed = pGCS->Compressed();
+        const auto expected = ot::gcs::GolombDecode(N, P, compressed);
+
+        // NOTE covers every tail length handled by the byte at a time refill
+        for (auto cut = std::size_t{1}; cut <= 16u; ++cut) {
+            if (compressed.size() < cut) { break; }
+
+            const auto size = compressed.size() - cut;
+            const auto truncated = ot::Space{
+                compressed.begin(),
+                std::next(
+                    compressed.begin(), static_cast<std::ptrdiff_t>(size))};
+            const auto decoded = ot::gcs::GolombDecode(N, P, truncated);
+
+            ASSERT_EQ(decoded.size(), expected.size());
+
+            // Elements which were encoded entirely within the remaining
+            // bytes must still decode correctly
+            auto complete = std::size_t{0};
+
+            while (complete < expected.size()) {
+                const auto prefix = std::vector<std::uint64_t>{
+                    expected.begin(),
+                    std::next(
+                        expected.begin(),
+                        static_cast<std::ptrdiff_t>(complete + 1u))};
+
+                if (ot::gcs::GolombEncode(P, prefix).size() > size) { break; }
+
+                ++complete;
+            }
+
+            for (auto i = std::size_t{0}; i < complete; ++i) {
+                EXPECT_EQ(decoded.at(i), expected.at(i));
+            }
+        }
+    }
+}
+
+TEST_F(Test_BitcoinBlock, golomb_coding_long_unary)
+{
+    constexpr auto P = std::uint8_t{19};
+    constexpr auto unit = std::uint64_t{1u} << P;
+
+    {
+        // Quotients shorter than, equal to and longer than the buffered word
+        const auto input = std::vector<std::uint64_t>{
+            (unit * 63u) + 1u,
+            (unit * 127u) + 2u,
+            (unit * 191u) + 3u,
+            (unit * 1000u) + 4u,
+            (unit * 1064u) + 5u,
+        };
+        const auto encoded = ot::gcs::GolombEncode(P, input);
+
+        EXPECT_EQ(encoded, ot::gcs::GolombEncodeReference(P, input));
+        EXPECT_EQ(
+            ot::gcs::GolombDecode(
+                static_cast<std::uint32_t>(input.size()), P, encoded),
+            input);
+    }
+
+    // Runs of ones which reach the end of the input with every possible
+    // number of tail bytes left over. The run is a single quotient and every
+    // bit past the end reads as zero.
+    for (auto size = std::size_t{0}; size <= 24u; ++size) {
+        const auto ones = ot::Space(size, std::byte{0xff});
+
+        for (const auto p : {std::uint8_t{0}, std::uint8_t{8}, P}) {
+            const auto value = std::uint64_t{size * 8u} << p;
+            const auto expected = std::vector<std::uint64_t>(3u, value);
+
+            EXPECT_EQ(ot::gcs::GolombDecode(3, p, ones), expected);
+            EXPECT_EQ(ot::gcs::GolombDecodeReference(3, p, ones), expected);
+        }
+    }
+}
 }  // namespace ottest
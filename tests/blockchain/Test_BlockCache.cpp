@@ -0,0 +1,198 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/node/blockoracle/Mem.hpp"
+#include "blockchain/node/blockoracle/Sequence.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/blockchain/node/BlockOracle.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Block = ot::blockchain::node::BlockOracle::BitcoinBlock_p;
+using BlockHashes = ot::blockchain::node::BlockOracle::BlockHashes;
+using Future = ot::blockchain::node::BlockOracle::BitcoinBlockFuture;
+using Height = ot::blockchain::block::Height;
+using Mem = ot::blockchain::node::blockoracle::Mem;
+using Sequence = ot::blockchain::node::blockoracle::Sequence;
+
+auto hash(const Height height) noexcept -> ot::OTData
+{
+    return ot::Data::Factory(&height, sizeof(height));
+}
+
+auto future() noexcept -> Future
+{
+    auto promise = std::promise<Block>{};
+    promise.set_value(nullptr);
+
+    return promise.get_future();
+}
+
+auto push(Mem& mem, const Height id, const std::size_t bytes) noexcept
+    -> void
+{
+    mem.push(hash(id), future(), bytes);
+}
+
+auto contains(const Mem& mem, const Height id) noexcept -> bool
+{
+    return mem.contains(hash(id)->Bytes());
+}
+
+// Best chain in which the block at each height is hash(height)
+struct Chain {
+    std::size_t lookups_{};
+
+    auto best(const Height height, const std::size_t count) const noexcept
+        -> BlockHashes
+    {
+        auto output = BlockHashes{};
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            output.emplace_back(hash(height + static_cast<Height>(i)));
+        }
+
+        return output;
+    }
+
+    auto height(const ot::blockchain::block::Hash& id) noexcept
+        -> std::optional<Height>
+    {
+        ++lookups_;
+
+        for (auto i = Height{0}; i < 1000; ++i) {
+            if (id == hash(i)) { return i; }
+        }
+
+        return std::nullopt;
+    }
+};
+
+auto sequence(Chain& chain) noexcept -> Sequence
+{
+    return Sequence{
+        [&](const auto& id) { return chain.height(id); },
+        [&](const auto height, const auto count) {
+            return chain.best(height, count);
+        },
+        4};
+}
+
+auto request(const Height first, const Height last) noexcept -> BlockHashes
+{
+    auto output = BlockHashes{};
+
+    for (auto i{first}; i <= last; ++i) { output.emplace_back(hash(i)); }
+
+    return output;
+}
+
+TEST(BlockCache, byte_budget)
+{
+    auto mem = Mem{1000};
+    push(mem, 1, 400);
+    push(mem, 2, 400);
+
+    EXPECT_EQ(mem.size(), 2);
+    EXPECT_EQ(mem.bytes(), 800);
+    EXPECT_EQ(mem.evictions(), 0);
+
+    push(mem, 3, 400);
+
+    EXPECT_EQ(mem.size(), 2);
+    EXPECT_EQ(mem.bytes(), 800);
+    EXPECT_EQ(mem.evictions(), 1);
+    EXPECT_FALSE(contains(mem, 1));
+    EXPECT_TRUE(contains(mem, 2));
+    EXPECT_TRUE(contains(mem, 3));
+}
+
+TEST(BlockCache, least_recently_used)
+{
+    auto mem = Mem{1000};
+    push(mem, 1, 400);
+    push(mem, 2, 400);
+
+    EXPECT_TRUE(mem.find(hash(1)->Bytes()).valid());
+
+    push(mem, 3, 400);
+
+    EXPECT_TRUE(contains(mem, 1));
+    EXPECT_FALSE(contains(mem, 2));
+    EXPECT_TRUE(contains(mem, 3));
+    EXPECT_FALSE(mem.find(hash(2)->Bytes()).valid());
+}
+
+TEST(BlockCache, replace_and_oversized)
+{
+    auto mem = Mem{1000};
+    push(mem, 1, 400);
+    push(mem, 1, 300);
+
+    EXPECT_EQ(mem.size(), 1);
+    EXPECT_EQ(mem.bytes(), 300);
+
+    // NOTE the most recent block is retained even if it exceeds the limit
+    push(mem, 2, 5000);
+
+    EXPECT_EQ(mem.size(), 1);
+    EXPECT_EQ(mem.bytes(), 5000);
+    EXPECT_TRUE(contains(mem, 2));
+
+    mem.clear();
+
+    EXPECT_EQ(mem.size(), 0);
+    EXPECT_EQ(mem.bytes(), 0);
+}
+
+TEST(BlockCache, sequential_prefetch)
+{
+    auto chain = Chain{};
+    auto seq = sequence(chain);
+
+    EXPECT_TRUE(seq.Check(request(10, 12)).empty());
+    EXPECT_EQ(chain.lookups_, 2);
+
+    const auto next = seq.Check(request(13, 14));
+
+    EXPECT_EQ(chain.lookups_, 4);
+    EXPECT_EQ(next, request(15, 18));
+
+    // NOTE the heights of prefetched blocks are known without a lookup
+    EXPECT_EQ(seq.Check(request(15, 16)), request(17, 20));
+    EXPECT_EQ(seq.Check(request(17, 17)), request(18, 21));
+    EXPECT_EQ(chain.lookups_, 4);
+}
+
+TEST(BlockCache, non_sequential)
+{
+    auto chain = Chain{};
+    auto seq = sequence(chain);
+
+    EXPECT_TRUE(seq.Check(request(10, 10)).empty());
+    EXPECT_EQ(chain.lookups_, 1);
+    EXPECT_TRUE(seq.Check(request(20, 20)).empty());
+    EXPECT_TRUE(seq.Check(request(20, 20)).empty());
+    EXPECT_TRUE(seq.Check({}).empty());
+    EXPECT_FALSE(seq.Check(request(21, 21)).empty());
+
+    // NOTE a request for an unknown block breaks the sequence
+    EXPECT_TRUE(seq.Check({hash(5000)}).empty());
+    EXPECT_TRUE(seq.Check(request(22, 22)).empty());
+    EXPECT_FALSE(seq.Check(request(23, 23)).empty());
+}
+}  // namespace ottest
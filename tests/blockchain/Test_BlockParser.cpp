@@ -0,0 +1,71 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <memory>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/BlockParser.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/blockchain/block/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/blockchain/crypto/Subchain.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Identifier.hpp"
+
+namespace ottest
+{
+TEST_F(Test_BlockParser, lazy_parse)
+{
+    const auto pBlock = parse();
+
+    ASSERT_TRUE(pBlock);
+
+    const auto& block = *pBlock;
+    auto serialized = ot::Space{};
+
+    EXPECT_EQ(block.size(), transactions_);
+    EXPECT_TRUE(block.Serialize(ot::writer(serialized)));
+    EXPECT_EQ(serialized, raw_);
+
+    auto position = std::size_t{0};
+
+    for (const auto& tx : block) {
+        ASSERT_TRUE(tx);
+        EXPECT_EQ(tx->ID().Bytes(), ot::reader(txids_.at(position++)));
+    }
+
+    EXPECT_EQ(position, transactions_);
+}
+
+TEST_F(Test_BlockParser, find_matches)
+{
+    using Subchain = ot::blockchain::crypto::Subchain;
+    constexpr auto target = std::size_t{1234};
+    const auto pBlock = parse();
+
+    ASSERT_TRUE(pBlock);
+
+    const auto& block = *pBlock;
+    auto patterns = Block::Patterns{};
+    patterns.emplace_back(
+        Block::ElementID{
+            0,
+            Block::SubchainID{Subchain::External, api_.Factory().Identifier()}},
+        pubkey_hashes_.at(2u * target));
+    const auto [inputs, outputs] =
+        block.FindMatches(ot::blockchain::filter::Type::ES, {}, patterns);
+
+    EXPECT_EQ(inputs.size(), 0u);
+    ASSERT_EQ(outputs.size(), 1u);
+    EXPECT_EQ(outputs.at(0).first->Bytes(), ot::reader(txids_.at(target)));
+}
+}  // namespace ottest
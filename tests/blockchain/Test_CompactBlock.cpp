@@ -0,0 +1,411 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/p2p/bitcoin/CompactBlock.hpp"
+#include "internal/blockchain/node/Node.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Bytes = std::vector<std::byte>;
+using CompactBlock = ot::blockchain::p2p::bitcoin::CompactBlock;
+using CompactSize = ot::network::blockchain::bitcoin::CompactSize;
+using Transaction = ot::blockchain::block::bitcoin::Transaction;
+using Tx = std::shared_ptr<const Transaction>;
+
+constexpr auto chain_ = ot::blockchain::Type::Bitcoin;
+constexpr auto nonce_ = std::uint64_t{0x0807060504030201};
+
+auto sequence(const std::size_t size) noexcept -> Bytes
+{
+    auto out = Bytes{};
+
+    for (auto i = std::size_t{0}; i < size; ++i) {
+        out.emplace_back(static_cast<std::byte>(i));
+    }
+
+    return out;
+}
+
+auto view(const Bytes& in) noexcept -> ot::ReadView
+{
+    return {reinterpret_cast<const char*>(in.data()), in.size()};
+}
+
+auto append(Bytes& out, const Bytes& in) noexcept -> void
+{
+    out.insert(out.end(), in.begin(), in.end());
+}
+
+auto append(Bytes& out, const std::uint64_t value, const std::size_t bytes)
+    -> void
+{
+    for (auto i = std::size_t{0}; i < bytes; ++i) {
+        out.emplace_back(static_cast<std::byte>((value >> (8u * i)) & 0xffu));
+    }
+}
+
+auto compact_size(const std::uint64_t value) noexcept -> Bytes
+{
+    return CompactSize(value).Encode();
+}
+
+struct Mempool final : public ot::blockchain::node::internal::Mempool {
+    std::vector<Tx> transactions_{};
+
+    auto Dump() const noexcept -> std::set<std::string> final { return {}; }
+    auto Query(ot::ReadView) const noexcept -> Tx final { return {}; }
+    auto Stats() const noexcept -> Statistics final { return {}; }
+    auto Submit(ot::ReadView) const noexcept -> bool final { return false; }
+    auto Submit(const std::vector<ot::ReadView>& txids) const noexcept
+        -> std::vector<bool> final
+    {
+        return std::vector<bool>(txids.size(), false);
+    }
+    auto Submit(std::unique_ptr<const Transaction>) const noexcept
+        -> void final
+    {
+    }
+    auto Transactions() const noexcept -> std::vector<Tx> final
+    {
+        return transactions_;
+    }
+
+    auto Heartbeat() noexcept -> void final {}
+};
+
+class Test_CompactBlock : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    const Bytes header_;
+    const Bytes key_;
+    std::vector<Bytes> raw_;
+    std::vector<Tx> txs_;
+    Mempool mempool_;
+
+    // Every transaction spends a distinct outpoint so every txid is unique
+    static auto raw_transaction(const std::size_t index) noexcept -> Bytes
+    {
+        auto out = Bytes{};
+        append(out, 1u, 4u);
+        append(out, 1u, 1u);
+        append(out, index + 1u, 32u);
+        append(out, 0u, 4u);
+        append(out, 0u, 1u);
+        append(out, 0xffffffffu, 4u);
+        append(out, 1u, 1u);
+        append(out, 1000u + index, 8u);
+        append(out, 1u, 1u);
+        append(out, 0x51u, 1u);
+        append(out, 0u, 4u);
+
+        return out;
+    }
+
+    // Builds a cmpctblock payload for the first count transactions where
+    // prefilled lists the absolute positions to include in full
+    auto payload(const std::size_t count, const std::vector<std::size_t>& pre)
+        const noexcept -> Bytes
+    {
+        auto out = header_;
+        append(out, nonce_, 8u);
+        const auto prefilled = std::set<std::size_t>{pre.begin(), pre.end()};
+        append(out, compact_size(count - prefilled.size()));
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            if (0u < prefilled.count(i)) { continue; }
+
+            append(out, short_id(i), CompactBlock::short_id_bytes_);
+        }
+
+        append(out, compact_size(prefilled.size()));
+        auto previous = std::size_t{0};
+        auto first{true};
+
+        for (const auto index : prefilled) {
+            const auto offset = first ? index : (index - previous - 1u);
+            append(out, compact_size(offset));
+            append(out, raw_.at(index));
+            previous = index;
+            first = false;
+        }
+
+        return out;
+    }
+
+    auto serialized(const std::size_t count) const noexcept -> Bytes
+    {
+        auto out = header_;
+        append(out, compact_size(count));
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            append(out, raw_.at(i));
+        }
+
+        return out;
+    }
+
+    auto short_id(const std::size_t index) const noexcept -> std::uint64_t
+    {
+        return CompactBlock::ShortID(
+            api_, view(key_), txs_.at(index)->ID().Bytes());
+    }
+
+    auto make(const Bytes& payload) const noexcept(false)
+        -> std::unique_ptr<CompactBlock>
+    {
+        return std::make_unique<CompactBlock>(
+            api_, chain_, 1u, view(payload), mempool_);
+    }
+
+    Test_CompactBlock()
+        : api_(ot::Context().StartClient({}, 0))
+        , header_(sequence(CompactBlock::header_bytes_))
+        , key_([&] {
+            auto preimage = header_;
+            append(preimage, nonce_, 8u);
+            auto out = ot::Space{};
+            api_.Crypto().Hash().Digest(
+                ot::crypto::HashType::Sha256,
+                view(preimage),
+                ot::writer(out));
+            out.resize(16u);
+
+            return out;
+        }())
+        , raw_()
+        , txs_()
+        , mempool_()
+    {
+        for (auto i = std::size_t{0}; i < 8u; ++i) {
+            const auto& raw = raw_.emplace_back(raw_transaction(i));
+            auto tx =
+                api_.Factory().BitcoinTransaction(chain_, view(raw), false);
+
+            OT_ASSERT(tx);
+
+            txs_.emplace_back(std::move(tx));
+        }
+    }
+};
+
+TEST_F(Test_CompactBlock, siphash_vectors)
+{
+    // NOTE SipHash-2-4 with key 00..0f of the 32 byte message 00..1f is
+    // 0x7127512f72f27cce
+    EXPECT_EQ(
+        CompactBlock::ShortID(api_, view(sequence(16u)), view(sequence(32u))),
+        0x512f72f27cceu);
+}
+
+TEST_F(Test_CompactBlock, short_id_vectors)
+{
+    // NOTE BIP152 keys the hash with the first 16 bytes of
+    // SHA256(header || nonce)
+    const auto expected = ot::Data::Factory(
+        "9e5845f7becb646e8b829c75cff71133", ot::Data::Mode::Hex);
+
+    ASSERT_EQ(key_.size(), expected->size());
+    EXPECT_EQ(std::memcmp(key_.data(), expected->data(), key_.size()), 0);
+    EXPECT_EQ(
+        CompactBlock::ShortID(api_, view(key_), view(sequence(32u))),
+        0x944356aaceafu);
+    EXPECT_EQ(
+        CompactBlock::ShortID(api_, view(key_), view(Bytes(32u))),
+        0xb4006694bbccu);
+}
+
+TEST_F(Test_CompactBlock, reconstruct_from_mempool)
+{
+    mempool_.transactions_ = {txs_.at(3), txs_.at(1), txs_.at(2), txs_.at(7)};
+    const auto block = make(payload(4u, {0u}));
+
+    EXPECT_EQ(block->Transactions(), 4u);
+    EXPECT_EQ(block->FromMempool(), 3u);
+    EXPECT_TRUE(block->IsComplete());
+    EXPECT_TRUE(block->Missing().empty());
+
+    auto out = ot::Space{};
+    const auto expected = serialized(4u);
+
+    ASSERT_TRUE(block->Serialize(ot::writer(out)));
+    EXPECT_EQ(block->BlockSize(), expected.size());
+    EXPECT_EQ(out, expected);
+}
+
+TEST_F(Test_CompactBlock, differential_indices_and_fill)
+{
+    mempool_.transactions_ = {txs_.at(1), txs_.at(3)};
+    const auto block = make(payload(6u, {0u, 2u, 5u}));
+
+    EXPECT_EQ(block->FromMempool(), 2u);
+    EXPECT_FALSE(block->IsComplete());
+    EXPECT_EQ(block->Missing(), std::vector<std::size_t>{4u});
+
+    auto out = ot::Space{};
+
+    EXPECT_FALSE(block->Serialize(ot::writer(out)));
+
+    auto blocktxn = Bytes{};
+    const auto hash = block->Hash().Bytes();
+    blocktxn.insert(
+        blocktxn.end(),
+        reinterpret_cast<const std::byte*>(hash.data()),
+        reinterpret_cast<const std::byte*>(hash.data()) + hash.size());
+    append(blocktxn, compact_size(1u));
+    append(blocktxn, raw_.at(4));
+
+    ASSERT_TRUE(block->Fill(view(blocktxn)));
+    EXPECT_TRUE(block->IsComplete());
+    ASSERT_TRUE(block->Serialize(ot::writer(out)));
+    EXPECT_EQ(out, serialized(6u));
+}
+
+TEST_F(Test_CompactBlock, fill_rejects_invalid_blocktxn)
+{
+    const auto block = make(payload(3u, {0u}));
+    const auto hash = block->Hash().Bytes();
+    const auto blocktxn = [&](const std::size_t count,
+                              const std::vector<std::size_t>& txs,
+                              const bool wrongHash) {
+        auto out = Bytes{};
+        out.insert(
+            out.end(),
+            reinterpret_cast<const std::byte*>(hash.data()),
+            reinterpret_cast<const std::byte*>(hash.data()) + hash.size());
+
+        if (wrongHash) { out.at(0) ^= std::byte{0x01}; }
+
+        append(out, compact_size(count));
+
+        for (const auto index : txs) { append(out, raw_.at(index)); }
+
+        return out;
+    };
+    const auto truncated = [&] {
+        auto out = blocktxn(2u, {1u, 2u}, false);
+        out.resize(out.size() - 1u);
+
+        return out;
+    }();
+
+    ASSERT_EQ(block->Missing(), (std::vector<std::size_t>{1u, 2u}));
+    EXPECT_FALSE(block->Fill(view(blocktxn(2u, {1u, 2u}, true))));
+    EXPECT_FALSE(block->Fill(view(blocktxn(1u, {1u}, false))));
+    EXPECT_FALSE(block->Fill(view(truncated)));
+    EXPECT_FALSE(block->Fill({}));
+    EXPECT_FALSE(block->IsComplete());
+    EXPECT_TRUE(block->Fill(view(blocktxn(2u, {1u, 2u}, false))));
+    EXPECT_TRUE(block->IsComplete());
+}
+
+TEST_F(Test_CompactBlock, short_id_collision)
+{
+    // NOTE two transactions in the block with the same short id
+    auto bytes = payload(3u, {0u});
+    const auto ids = CompactBlock::header_bytes_ + 8u + 1u;
+    std::memcpy(
+        bytes.data() + ids + CompactBlock::short_id_bytes_,
+        bytes.data() + ids,
+        CompactBlock::short_id_bytes_);
+
+    EXPECT_THROW(make(bytes), std::runtime_error);
+}
+
+TEST_F(Test_CompactBlock, ambiguous_mempool_match)
+{
+    // NOTE a slot matched by two mempool transactions is requested instead
+    mempool_.transactions_ = {txs_.at(1), txs_.at(1), txs_.at(2)};
+    const auto block = make(payload(3u, {0u}));
+
+    EXPECT_EQ(block->FromMempool(), 1u);
+    EXPECT_EQ(block->Missing(), std::vector<std::size_t>{1u});
+}
+
+TEST_F(Test_CompactBlock, malformed_payloads)
+{
+    const auto valid = payload(3u, {0u});
+    const auto ids = CompactBlock::header_bytes_ + 8u;
+    const auto prefilled = ids + 1u + 2u * CompactBlock::short_id_bytes_;
+    const auto replace = [&](const std::size_t position,
+                             const std::size_t length,
+                             const Bytes& with) {
+        auto out = Bytes{valid.begin(), valid.begin() + position};
+        append(out, with);
+        out.insert(out.end(), valid.begin() + position + length, valid.end());
+
+        return out;
+    };
+    constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+
+    EXPECT_NO_THROW(make(valid));
+    EXPECT_THROW(make({}), std::runtime_error);
+    EXPECT_THROW(
+        make(Bytes{valid.begin(), valid.begin() + ids}), std::runtime_error);
+    // more short ids than the payload contains
+    EXPECT_THROW(
+        make(replace(ids, 1u, compact_size(1000u))), std::runtime_error);
+    // short id count which overflows when multiplied by the id size
+    EXPECT_THROW(
+        make(replace(ids, 1u, compact_size(max / 3u + 1u))),
+        std::runtime_error);
+    // prefilled count larger than the payload
+    EXPECT_THROW(
+        make(replace(prefilled, 1u, compact_size(1000u))), std::runtime_error);
+    // prefilled index past the end of the block
+    EXPECT_THROW(
+        make(replace(prefilled + 1u, 1u, compact_size(3u))),
+        std::runtime_error);
+    // truncated prefilled transaction
+    EXPECT_ANY_THROW(make(Bytes{valid.begin(), valid.end() - 1}));
+    // empty block
+    EXPECT_THROW(
+        make(replace(ids, valid.size() - ids, Bytes(2u))),
+        std::runtime_error);
+}
+
+TEST_F(Test_CompactBlock, overflowing_differential_index)
+{
+    // NOTE the second offset wraps the absolute index back to zero, which
+    // would overwrite the first prefilled transaction
+    const auto valid = payload(3u, {0u, 1u});
+    const auto prefilled = CompactBlock::header_bytes_ + 8u + 1u +
+                           CompactBlock::short_id_bytes_ + 1u;
+    const auto second = prefilled + 1u + raw_.at(0).size();
+    auto bytes = Bytes{valid.begin(), valid.begin() + second};
+    append(bytes, compact_size(std::numeric_limits<std::uint64_t>::max()));
+    bytes.insert(bytes.end(), valid.begin() + second + 1u, valid.end());
+
+    EXPECT_NO_THROW(make(valid));
+    EXPECT_THROW(make(bytes), std::runtime_error);
+}
+}  // namespace ottest
@@ -359,6 +359,60 @@ TEST_F(Test_Filters, golomb_coding)
     }
 }
 
+TEST_F(Test_Filters, siphash)
+{
+    auto key = ot::Space{};
+    auto message = ot::Space{};
+
+    for (auto i = std::uint8_t{0}; i < 16u; ++i) {
+        key.emplace_back(std::byte{i});
+    }
+
+    for (auto i = std::uint8_t{0}; i < 64u; ++i) {
+        message.emplace_back(std::byte{i});
+    }
+
+    const auto hasher = ot::gcs::SipHash{ot::reader(key)};
+    const auto view = [&](const std::size_t size) {
+        return ot::ReadView{
+            reinterpret_cast<const char*>(message.data()), size};
+    };
+
+    // Test vectors from the SipHash reference implementation
+    EXPECT_EQ(hasher(view(0)), 0x726fdb47dd0e0e31u);
+    EXPECT_EQ(hasher(view(1)), 0x74f839c593dc67fdu);
+    EXPECT_EQ(hasher(view(15)), 0xa129ca6149be45e5u);
+    EXPECT_EQ(hasher(view(63)), 0x958a324ceb064572u);
+
+    auto items = std::vector<ot::ReadView>{};
+    const auto range = std::uint64_t{params_.second} * 64u;
+
+    for (auto i = std::size_t{0}; i < message.size(); ++i) {
+        auto expected = std::uint64_t{};
+        auto writer = ot::preallocated(sizeof(expected), &expected);
+
+        ASSERT_TRUE(api_.Crypto().Hash().HMAC(
+            ot::crypto::HashType::SipHash24,
+            ot::reader(key),
+            view(i),
+            writer));
+        EXPECT_EQ(hasher(view(i)), expected);
+
+        items.emplace_back(view(i));
+    }
+
+    const auto hashes = ot::gcs::HashToRange(hasher, range, items);
+
+    ASSERT_EQ(hashes.size(), items.size());
+
+    for (auto i = std::size_t{0}; i < items.size(); ++i) {
+        const auto& item = items.at(i);
+
+        EXPECT_EQ(hashes.at(i), ot::gcs::HashToRange(hasher, range, item));
+        EXPECT_LT(hashes.at(i), range);
+    }
+}
+
 TEST_F(Test_Filters, gcs)
 {
     const auto s1 = std::string{"blah"};
@@ -406,6 +460,33 @@ TEST_F(Test_Filters, gcs)
     for (const auto& match : matches) {
         EXPECT_TRUE((good1 == *match) || (good2 == *match));
     }
+
+    const auto compressed = gcs.Compressed();
+    const auto pStreaming = ot::factory::GCS(
+        api_,
+        params_.first,
+        params_.second,
+        key,
+        gcs.ElementCount(),
+        ot::reader(compressed));
+
+    ASSERT_TRUE(pStreaming);
+
+    const auto& streaming = *pStreaming;
+
+    EXPECT_TRUE(streaming.Test(object1));
+    EXPECT_TRUE(streaming.Test(object4));
+    EXPECT_FALSE(streaming.Test(object5));
+    EXPECT_TRUE(streaming.Test(includedElements));
+    EXPECT_FALSE(streaming.Test(excludedElements));
+
+    const auto streamed = streaming.Match(partial);
+
+    EXPECT_TRUE(2 == streamed.size());
+
+    for (const auto& match : streamed) {
+        EXPECT_TRUE((good1 == *match) || (good2 == *match));
+    }
 }
 
 TEST_F(Test_Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
@@ -0,0 +1,357 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Bytes.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_MappedFileStorage : public ::testing::Test
+{
+protected:
+    using LMDB = ot::storage::lmdb::LMDB;
+    using IndexData = ot::util::IndexData;
+
+    enum Table : int {
+        Config = 0,
+        Index = 1,
+    };
+
+    class Storage final : public ot::util::MappedFileStorage
+    {
+    public:
+        using ot::util::MappedFileStorage::IndexTables;
+        using ot::util::MappedFileStorage::compact;
+        using ot::util::MappedFileStorage::get_read_view;
+        using ot::util::MappedFileStorage::get_write_view;
+        using ot::util::MappedFileStorage::report;
+
+        Storage(LMDB& lmdb, const std::string& path) noexcept(false)
+            : MappedFileStorage(lmdb, path, "test", Table::Config, 0, 1, 2)
+        {
+        }
+
+        ~Storage() final = default;
+    };
+
+    static const Storage::IndexTables tables_;
+
+    const std::string path_;
+    std::unique_ptr<LMDB> lmdb_;
+    std::unique_ptr<Storage> storage_;
+
+    static auto item(const char c, const std::size_t bytes) noexcept
+        -> std::string
+    {
+        return std::string(bytes, c);
+    }
+    template <typename Input>
+    static auto tsv(const Input& in) noexcept -> ot::ReadView
+    {
+        return {reinterpret_cast<const char*>(&in), sizeof(in)};
+    }
+
+    auto free_bytes() const noexcept -> std::size_t
+    {
+        auto output = std::size_t{0};
+
+        for (const auto& file : storage_->report(tables_)) {
+            output += file.free_;
+        }
+
+        return output;
+    }
+    auto index(const std::size_t key) const noexcept -> IndexData
+    {
+        auto output = IndexData{};
+        lmdb_->Load(Table::Index, key, [&](const auto in) {
+            if (sizeof(output) != in.size()) { return; }
+
+            std::memcpy(static_cast<void*>(&output), in.data(), in.size());
+        });
+
+        return output;
+    }
+    auto read(const std::size_t key) const noexcept -> std::string
+    {
+        const auto data = index(key);
+
+        if (0u == data.size_) { return {}; }
+
+        const auto view = storage_->get_read_view(data);
+
+        return std::string{view.data(), view.size()};
+    }
+    auto restart() noexcept -> void
+    {
+        storage_.reset();
+        lmdb_.reset();
+        open();
+    }
+    auto open() noexcept -> void
+    {
+        lmdb_ = std::make_unique<LMDB>(
+            ot::storage::lmdb::TableNames{
+                {Table::Config, "config"},
+                {Table::Index, "index"},
+            },
+            path_,
+            ot::storage::lmdb::TablesToInit{
+                {Table::Config, 0},
+                {Table::Index, 0},
+            });
+        storage_ = std::make_unique<Storage>(*lmdb_, path_);
+    }
+    // Returns the position at which the item was written
+    auto write(
+        const std::size_t key,
+        const std::string& value,
+        const bool commit = true,
+        const bool updateIndex = true) noexcept -> std::optional<std::size_t>
+    {
+        auto data = index(key);
+        const auto original = data;
+        auto tx = lmdb_->TransactionRW();
+        auto view = storage_->get_write_view(
+            tx,
+            data,
+            [&](auto& txn) -> bool {
+                if (false == updateIndex) { return false; }
+
+                return lmdb_->Store(Table::Index, key, tsv(data), txn).first;
+            },
+            value.size());
+
+        if (false == view.valid(value.size())) {
+            EXPECT_EQ(data.position_, original.position_);
+            EXPECT_EQ(data.size_, original.size_);
+
+            return std::nullopt;
+        }
+
+        std::memcpy(view.data(), value.data(), value.size());
+
+        if (false == tx.Finalize(commit)) { return std::nullopt; }
+
+        if (false == commit) { return std::nullopt; }
+
+        return data.position_;
+    }
+
+    Test_MappedFileStorage()
+        : path_([] {
+            const auto path =
+                fs::temp_directory_path() /
+                fs::unique_path("opentxs-mapped-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path.string();
+        }())
+        , lmdb_()
+        , storage_()
+    {
+        open();
+    }
+
+    ~Test_MappedFileStorage() override
+    {
+        storage_.reset();
+        lmdb_.reset();
+
+        try {
+            fs::remove_all(path_);
+        } catch (...) {
+        }
+    }
+};
+
+const Test_MappedFileStorage::Storage::IndexTables
+    Test_MappedFileStorage::tables_{Table::Index};
+
+TEST_F(Test_MappedFileStorage, append_and_restart)
+{
+    EXPECT_EQ(write(0, item('a', 100)), 0u);
+    EXPECT_EQ(write(1, item('b', 200)), 100u);
+
+    restart();
+
+    EXPECT_EQ(read(0), item('a', 100));
+    EXPECT_EQ(read(1), item('b', 200));
+    EXPECT_EQ(write(2, item('c', 50)), 300u);
+    EXPECT_EQ(free_bytes(), 0u);
+}
+
+TEST_F(Test_MappedFileStorage, reuse_after_restart)
+{
+    EXPECT_EQ(write(0, item('a', 100)), 0u);
+    EXPECT_EQ(write(1, item('b', 100)), 100u);
+    EXPECT_EQ(write(0, item('A', 300)), 200u);
+    EXPECT_EQ(free_bytes(), 100u);
+
+    // Released regions may still be referenced by views so they are not
+    // reused until the storage is reopened
+    EXPECT_EQ(write(2, item('c', 100)), 500u);
+
+    restart();
+
+    EXPECT_EQ(free_bytes(), 100u);
+    EXPECT_EQ(write(3, item('d', 80)), 0u);
+    EXPECT_EQ(free_bytes(), 0u);
+    EXPECT_EQ(read(0), item('A', 300));
+    EXPECT_EQ(read(1), item('b', 100));
+    EXPECT_EQ(read(2), item('c', 100));
+    EXPECT_EQ(read(3), item('d', 80));
+}
+
+TEST_F(Test_MappedFileStorage, aborted_transaction)
+{
+    EXPECT_EQ(write(0, item('a', 100)), 0u);
+    EXPECT_EQ(write(1, item('b', 100)), 100u);
+    EXPECT_EQ(write(0, item('A', 300)), 200u);
+
+    restart();
+
+    // Allocation from the free space map
+    EXPECT_FALSE(write(2, item('c', 100), false).has_value());
+    // Release of an existing item and allocation at the end of the file
+    EXPECT_FALSE(write(1, item('B', 400), false).has_value());
+    EXPECT_EQ(index(2).size_, 0u);
+    EXPECT_EQ(index(1).position_, 100u);
+    EXPECT_EQ(free_bytes(), 100u);
+    EXPECT_EQ(write(3, item('d', 100)), 0u);
+    EXPECT_EQ(write(4, item('e', 1000)), 500u);
+
+    restart();
+
+    EXPECT_EQ(free_bytes(), 0u);
+    EXPECT_EQ(write(5, item('f', 100)), 1500u);
+    EXPECT_EQ(read(0), item('A', 300));
+    EXPECT_EQ(read(1), item('b', 100));
+    EXPECT_EQ(read(3), item('d', 100));
+    EXPECT_EQ(read(4), item('e', 1000));
+}
+
+TEST_F(Test_MappedFileStorage, failed_callback)
+{
+    EXPECT_EQ(write(0, item('a', 100)), 0u);
+    EXPECT_EQ(write(1, item('b', 100)), 100u);
+    EXPECT_EQ(write(0, item('A', 300)), 200u);
+
+    restart();
+
+    EXPECT_FALSE(write(2, item('c', 100), true, false).has_value());
+    EXPECT_FALSE(write(1, item('B', 400), true, false).has_value());
+    EXPECT_EQ(free_bytes(), 100u);
+    EXPECT_EQ(write(3, item('d', 100)), 0u);
+    EXPECT_EQ(write(4, item('e', 100)), 500u);
+    EXPECT_EQ(read(1), item('b', 100));
+}
+
+TEST_F(Test_MappedFileStorage, several_writes_per_transaction)
+{
+    EXPECT_EQ(write(0, item('a', 100)), 0u);
+    EXPECT_EQ(write(1, item('b', 100)), 100u);
+    EXPECT_EQ(write(2, item('c', 100)), 200u);
+
+    const auto batch = [&](const bool commit) {
+        auto indices = std::vector<IndexData>{index(0), index(1)};
+        auto tx = lmdb_->TransactionRW();
+
+        for (auto key = std::size_t{0}; key < indices.size(); ++key) {
+            auto& data = indices.at(key);
+            const auto value = item('A' + static_cast<char>(key), 300);
+            auto view = storage_->get_write_view(tx, data, value.size());
+
+            EXPECT_TRUE(view.valid(value.size()));
+
+            std::memcpy(view.data(), value.data(), value.size());
+
+            EXPECT_TRUE(lmdb_->Store(Table::Index, key, tsv(data), tx).first);
+        }
+
+        EXPECT_TRUE(tx.Finalize(commit));
+    };
+
+    batch(false);
+
+    EXPECT_EQ(free_bytes(), 0u);
+    EXPECT_EQ(read(0), item('a', 100));
+
+    batch(true);
+
+    EXPECT_EQ(free_bytes(), 200u);
+
+    restart();
+
+    EXPECT_EQ(free_bytes(), 200u);
+    EXPECT_EQ(write(3, item('d', 80)), 0u);
+    EXPECT_EQ(write(4, item('e', 80)), 100u);
+    EXPECT_EQ(free_bytes(), 0u);
+    EXPECT_EQ(read(0), item('A', 300));
+    EXPECT_EQ(read(1), item('B', 300));
+    EXPECT_EQ(read(2), item('c', 100));
+}
+
+TEST_F(Test_MappedFileStorage, compact)
+{
+    constexpr auto count = std::size_t{10};
+    const auto value = [](const std::size_t key) {
+        if (0u == key % 2u) { return item(static_cast<char>('a' + key), 150); }
+
+        return item('x', 100);
+    };
+
+    for (auto key = std::size_t{0}; key < count; ++key) {
+        EXPECT_TRUE(write(key, item('x', 100)).has_value());
+    }
+
+    for (auto key = std::size_t{0}; key < count; key += 2u) {
+        EXPECT_TRUE(write(key, value(key)).has_value());
+    }
+
+    auto live = std::size_t{0};
+
+    for (auto key = std::size_t{0}; key < count; ++key) {
+        live += value(key).size();
+    }
+
+    ASSERT_EQ(storage_->report(tables_).size(), 1u);
+    EXPECT_EQ(storage_->report(tables_).front().live_, live);
+    EXPECT_GT(storage_->report(tables_).front().dead(), 0u);
+    EXPECT_TRUE(storage_->compact(tables_));
+
+    const auto check = [&] {
+        const auto report = storage_->report(tables_);
+
+        ASSERT_EQ(report.size(), 1u);
+        EXPECT_EQ(report.front().used_, live);
+        EXPECT_EQ(report.front().live_, live);
+        EXPECT_EQ(report.front().free_, 0u);
+
+        for (auto key = std::size_t{0}; key < count; ++key) {
+            EXPECT_EQ(read(key), value(key));
+        }
+    };
+
+    check();
+    restart();
+    check();
+    EXPECT_EQ(write(count, item('z', 100)), live);
+}
+}  // namespace ottest
@@ -0,0 +1,304 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/node/Mempool.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/network/zeromq/socket/Publish.hpp"
+#include "opentxs/network/zeromq/socket/Subscribe.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Bytes = std::vector<std::byte>;
+using Mempool = ot::blockchain::node::Mempool;
+using Transaction = ot::blockchain::block::bitcoin::Transaction;
+
+constexpr auto chain_ = ot::blockchain::Type::Bitcoin;
+
+auto append(Bytes& out, const std::uint64_t value, const std::size_t bytes)
+    -> void
+{
+    for (auto i = std::size_t{0}; i < bytes; ++i) {
+        out.emplace_back(static_cast<std::byte>((value >> (8u * i)) & 0xffu));
+    }
+}
+
+auto append(Bytes& out, const ot::ReadView in) -> void
+{
+    const auto* it = reinterpret_cast<const std::byte*>(in.data());
+    out.insert(out.end(), it, it + in.size());
+}
+
+class Test_Mempool : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    const std::string endpoint_;
+    std::mutex lock_;
+    std::set<std::string> notified_;
+    ot::OTZMQListenCallback cb_;
+    ot::OTZMQPublishSocket publish_;
+    ot::OTZMQSubscribeSocket subscribe_;
+    std::size_t sequence_;
+
+    // One input, one OP_TRUE output per value. The input either spends
+    // parent:index or, if parent is empty, a unique unknown outpoint.
+    auto make(
+        const ot::ReadView parent,
+        const std::uint32_t index,
+        const std::vector<std::uint64_t>& values,
+        const bool segwit = false) noexcept
+        -> std::unique_ptr<const Transaction>
+    {
+        auto raw = Bytes{};
+        append(raw, 1u, 4u);
+
+        if (segwit) {
+            append(raw, 0u, 1u);
+            append(raw, 1u, 1u);
+        }
+
+        append(raw, 1u, 1u);
+
+        if (parent.empty()) {
+            append(raw, ++sequence_, 8u);
+            append(raw, 0u, 24u);
+        } else {
+            append(raw, parent);
+        }
+
+        append(raw, index, 4u);
+        append(raw, 0u, 1u);
+        append(raw, 0xffffffffu, 4u);
+        append(raw, values.size(), 1u);
+
+        for (const auto value : values) {
+            append(raw, value, 8u);
+            append(raw, 1u, 1u);
+            append(raw, 0x51u, 1u);
+        }
+
+        if (segwit) {
+            append(raw, 1u, 1u);
+            append(raw, 4u, 1u);
+            append(raw, sequence_, 4u);
+        }
+
+        append(raw, 0u, 4u);
+
+        return api_.Factory().BitcoinTransaction(
+            chain_,
+            ot::ReadView{reinterpret_cast<const char*>(raw.data()), raw.size()},
+            false);
+    }
+
+    auto notified() noexcept -> std::set<std::string>
+    {
+        // NOTE notifications are delivered asynchronously
+        std::this_thread::sleep_for(std::chrono::milliseconds{250});
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        return notified_;
+    }
+
+    // Submits the transaction and returns its txid. Transactions are
+    // submitted at least one millisecond apart so that eviction order among
+    // equal fee rates is deterministic.
+    auto submit(const Mempool& mempool, std::unique_ptr<const Transaction> tx)
+        -> std::string
+    {
+        OT_ASSERT(tx);
+
+        auto txid = std::string{tx->ID().Bytes()};
+        mempool.Submit(std::move(tx));
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+
+        return txid;
+    }
+
+    Test_Mempool()
+        : api_(ot::Context().StartClient({}, 0))
+        , endpoint_(
+              std::string{"inproc://opentxs/test/mempool/"} +
+              ::testing::UnitTest::GetInstance()->current_test_info()->name())
+        , lock_()
+        , notified_()
+        , cb_(ot::network::zeromq::ListenCallback::Factory([&](auto& in) {
+            const auto body = in.Body();
+
+            OT_ASSERT(3u <= body.size());
+
+            auto lock = std::lock_guard<std::mutex>{lock_};
+            notified_.emplace(std::string{body.at(2).Bytes()});
+        }))
+        , publish_(ot::Context().ZMQ().PublishSocket())
+        , subscribe_(ot::Context().ZMQ().SubscribeSocket(cb_))
+        , sequence_(0)
+    {
+        OT_ASSERT(publish_->Start(endpoint_));
+        OT_ASSERT(subscribe_->Start(endpoint_));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    }
+};
+
+TEST_F(Test_Mempool, budget_eviction)
+{
+    const auto size = make({}, 0, {1000})->CalculateSize();
+    const auto mempool = Mempool{api_, publish_, chain_, 2u * size};
+    const auto a = submit(mempool, make({}, 0, {1000}));
+    const auto b = submit(mempool, make({}, 0, {1000}));
+
+    EXPECT_EQ(mempool.Dump(), (std::set<std::string>{a, b}));
+
+    const auto c = submit(mempool, make({}, 0, {1000}));
+
+    // NOTE all fees are unknown so the oldest transaction is evicted
+    EXPECT_EQ(mempool.Dump(), (std::set<std::string>{b, c}));
+    EXPECT_FALSE(mempool.Query(a));
+    EXPECT_TRUE(mempool.Query(b));
+    EXPECT_TRUE(mempool.Query(c));
+    EXPECT_EQ(mempool.Transactions().size(), 2u);
+    EXPECT_EQ(notified(), (std::set<std::string>{a, b, c}));
+}
+
+TEST_F(Test_Mempool, evicted_transactions_are_not_announced)
+{
+    auto tx = make({}, 0, {1000});
+    const auto limit = tx->CalculateSize() - 1u;
+    const auto mempool = Mempool{api_, publish_, chain_, limit};
+    const auto evicted = submit(mempool, std::move(tx));
+
+    EXPECT_TRUE(mempool.Dump().empty());
+    EXPECT_FALSE(mempool.Query(evicted));
+    EXPECT_EQ(mempool.Stats().bytes_, 0u);
+    EXPECT_TRUE(notified().empty());
+}
+
+TEST_F(Test_Mempool, descendant_eviction)
+{
+    auto parent = make({}, 0, {1000, 1000});
+    const auto parentID = parent->ID().Bytes();
+    auto child = make(parentID, 0, {900});
+    auto grandchild = make(child->ID().Bytes(), 0, {800});
+    auto unrelated = make({}, 0, {1000});
+    const auto bytes = parent->CalculateSize() + child->CalculateSize() +
+                       grandchild->CalculateSize() +
+                       unrelated->CalculateSize();
+    const auto mempool = Mempool{api_, publish_, chain_, bytes - 1u};
+    const auto p = submit(mempool, std::move(parent));
+    const auto c = submit(mempool, std::move(child));
+    const auto g = submit(mempool, std::move(grandchild));
+
+    EXPECT_EQ(mempool.Dump(), (std::set<std::string>{p, c, g}));
+
+    // NOTE the parent has an unknown fee and is older than the unrelated
+    // transaction, so it is evicted along with every descendant even though
+    // the descendants pay a fee
+    const auto u = submit(mempool, std::move(unrelated));
+
+    EXPECT_EQ(mempool.Dump(), std::set<std::string>{u});
+    EXPECT_FALSE(mempool.Query(p));
+    EXPECT_FALSE(mempool.Query(c));
+    EXPECT_FALSE(mempool.Query(g));
+    EXPECT_EQ(mempool.Stats().count_, 1u);
+}
+
+TEST_F(Test_Mempool, wtxid_index)
+{
+    auto parent = make({}, 0, {1000}, true);
+    const auto parentWtxid = std::string{parent->WTXID().Bytes()};
+    auto child = make(parent->ID().Bytes(), 0, {900}, true);
+    const auto childWtxid = std::string{child->WTXID().Bytes()};
+    auto unrelated = make({}, 0, {1000});
+    const auto mempool = Mempool{
+        api_,
+        publish_,
+        chain_,
+        parent->CalculateSize() + child->CalculateSize()};
+    const auto p = submit(mempool, std::move(parent));
+    const auto c = submit(mempool, std::move(child));
+
+    ASSERT_NE(p, parentWtxid);
+    ASSERT_NE(c, childWtxid);
+
+    const auto byTxid = mempool.Query(p);
+    const auto byWtxid = mempool.Query(parentWtxid);
+
+    ASSERT_TRUE(byTxid);
+    ASSERT_TRUE(byWtxid);
+    EXPECT_EQ(byTxid.get(), byWtxid.get());
+    EXPECT_TRUE(mempool.Query(childWtxid));
+
+    // NOTE evicting the parent removes both transactions from both indices
+    submit(mempool, std::move(unrelated));
+
+    EXPECT_FALSE(mempool.Query(p));
+    EXPECT_FALSE(mempool.Query(parentWtxid));
+    EXPECT_FALSE(mempool.Query(c));
+    EXPECT_FALSE(mempool.Query(childWtxid));
+}
+
+TEST_F(Test_Mempool, stats)
+{
+    const auto mempool = Mempool{api_, publish_, chain_, 1000000u};
+
+    {
+        const auto stats = mempool.Stats();
+
+        EXPECT_EQ(stats.count_, 0u);
+        EXPECT_EQ(stats.bytes_, 0u);
+        EXPECT_EQ(stats.min_fee_rate_, 0);
+    }
+
+    auto parent = make({}, 0, {1000});
+    const auto parentBytes = parent->CalculateSize();
+    const auto parentID = submit(mempool, std::move(parent));
+    auto child = make(parentID, 0, {900});
+    const auto childBytes = child->CalculateSize();
+    submit(mempool, std::move(child));
+
+    {
+        const auto stats = mempool.Stats();
+
+        EXPECT_EQ(stats.count_, 2u);
+        EXPECT_EQ(stats.bytes_, parentBytes + childBytes);
+        // NOTE the parent spends an unknown output so its fee rate is zero
+        EXPECT_EQ(stats.min_fee_rate_, 0);
+    }
+
+    // NOTE a txid without a transaction is not counted
+    EXPECT_TRUE(mempool.Submit(std::string(32u, 'x')));
+    EXPECT_FALSE(mempool.Submit(parentID));
+    EXPECT_EQ(mempool.Stats().count_, 2u);
+    EXPECT_EQ(mempool.Transactions().size(), 2u);
+}
+}  // namespace ottest
@@ -0,0 +1,186 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/node/wallet/ScanPlan.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/blockchain/Blockchain.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Height = ot::blockchain::block::Height;
+using Plan = ot::blockchain::node::wallet::ScanPlan;
+using Position = ot::blockchain::block::Position;
+using Window = Plan::Window;
+
+auto hash(const Height height) noexcept -> ot::OTData
+{
+    return ot::Data::Factory(&height, sizeof(height));
+}
+
+// Scans every segment the same way Scanner::scan_range does. A height which
+// is missing from filters ends the segment it belongs to.
+auto scan(
+    Plan& plan,
+    const std::set<Height>& missing,
+    const std::map<Height, std::set<std::size_t>>& blocks) noexcept -> void
+{
+    const auto& windows = plan.Windows();
+
+    for (auto& segment : plan.Segments()) {
+        for (auto height{segment.first_}; height <= segment.last_; ++height) {
+            if (0u < missing.count(height)) { break; }
+
+            auto matched = std::vector<bool>(windows.size(), false);
+
+            if (auto it = blocks.find(height); blocks.end() != it) {
+                for (const auto i : it->second) {
+                    const auto& window = windows.at(i);
+                    matched.at(i) =
+                        (window.start_ <= height) && (height <= window.stop_);
+                }
+            }
+
+            segment.Record(Position{height, hash(height)}, matched);
+        }
+    }
+}
+
+auto heights(const Plan::Matches& matches) noexcept -> std::vector<Height>
+{
+    auto output = std::vector<Height>{};
+
+    for (const auto& match : matches) {
+        for (auto i = Height{0}; i < 1000; ++i) {
+            if (hash(i) == match) { output.emplace_back(i); }
+        }
+    }
+
+    return output;
+}
+
+TEST(ScanPlan, window)
+{
+    const auto fresh = Plan::GetWindow(std::nullopt, 500, 400);
+
+    EXPECT_EQ(fresh.start_, 0);
+    EXPECT_EQ(fresh.stop_, 400);
+
+    const auto resume = Plan::GetWindow(Position{199, hash(199)}, 500, 400);
+
+    EXPECT_EQ(resume.start_, 200);
+    EXPECT_EQ(resume.stop_, 400);
+
+    const auto capped = Plan::GetWindow(std::nullopt, 50000, 50000);
+
+    EXPECT_EQ(capped.start_, 0);
+    EXPECT_EQ(capped.stop_, Plan::max_heights_ - 1);
+
+    const auto current = Plan::GetWindow(Position{400, hash(400)}, 500, 400);
+
+    EXPECT_TRUE(current.empty());
+}
+
+TEST(ScanPlan, segments)
+{
+    auto plan = Plan{{{0, 499}, {300, 799}, {0, 99}, {5, 4}}, 4};
+
+    EXPECT_EQ(plan.Heights(), 800);
+
+    auto next = Height{0};
+
+    for (const auto& segment : plan.Segments()) {
+        EXPECT_EQ(segment.first_, next);
+        EXPECT_LE(segment.first_, segment.last_);
+        EXPECT_EQ(segment.matches_.size(), 4);
+
+        for (const auto& window : plan.Windows()) {
+            if (window.empty()) { continue; }
+
+            const auto inside = (window.start_ <= segment.first_) &&
+                                (segment.last_ <= window.stop_);
+            const auto outside = (segment.last_ < window.start_) ||
+                                 (window.stop_ < segment.first_);
+
+            EXPECT_TRUE(inside || outside);
+        }
+
+        next = segment.last_ + 1;
+    }
+
+    EXPECT_EQ(next, 800);
+}
+
+TEST(ScanPlan, matches_and_resume_position)
+{
+    auto plan = Plan{{{0, 499}, {300, 799}, {0, 99}, {5, 4}}, 4};
+    const auto blocks = std::map<Height, std::set<std::size_t>>{
+        {10, {0}},
+        {350, {0, 1}},
+        {600, {0}},
+        {700, {1}},
+    };
+    scan(plan, {650}, blocks);
+
+    EXPECT_EQ(plan.Filters(), 750);
+
+    const auto results = plan.Collect();
+
+    ASSERT_EQ(results.size(), 4);
+
+    {
+        const auto& [highest, matches] = results.at(0);
+
+        ASSERT_TRUE(highest.has_value());
+        EXPECT_EQ(highest->first, 499);
+        EXPECT_EQ(highest->second, hash(499));
+        EXPECT_EQ(heights(matches), (std::vector<Height>{10, 350}));
+    }
+    {
+        // NOTE the missing filter at 650 must prevent the match at 700 from
+        // being reported, and the subchain must resume after 649
+        const auto& [highest, matches] = results.at(1);
+
+        ASSERT_TRUE(highest.has_value());
+        EXPECT_EQ(highest->first, 649);
+        EXPECT_EQ(heights(matches), (std::vector<Height>{350}));
+    }
+    {
+        const auto& [highest, matches] = results.at(2);
+
+        ASSERT_TRUE(highest.has_value());
+        EXPECT_EQ(highest->first, 99);
+        EXPECT_TRUE(matches.empty());
+    }
+    {
+        const auto& [highest, matches] = results.at(3);
+
+        EXPECT_FALSE(highest.has_value());
+        EXPECT_TRUE(matches.empty());
+    }
+}
+
+TEST(ScanPlan, nothing_scanned)
+{
+    auto plan = Plan{{{100, 199}}, 2};
+    scan(plan, {100}, {});
+    const auto results = plan.Collect();
+
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_FALSE(results.at(0).highest_.has_value());
+    EXPECT_TRUE(results.at(0).matches_.empty());
+}
+}  // namespace ottest
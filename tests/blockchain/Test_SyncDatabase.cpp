@@ -0,0 +1,244 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/database/common/Database.hpp"
+#include "internal/api/Api.hpp"
+#include "internal/api/client/Client.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Blockchain.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
+#include "opentxs/network/blockchain/sync/Base.hpp"
+#include "opentxs/network/blockchain/sync/Block.hpp"
+#include "opentxs/network/blockchain/sync/Data.hpp"
+#include "opentxs/network/blockchain/sync/MessageType.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameIterator.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/protobuf/BlockchainP2PChainState.pb.h"
+#include "opentxs/protobuf/BlockchainP2PHello.pb.h"
+#include "opentxs/protobuf/BlockchainP2PSync.pb.h"
+#include "opentxs/util/WorkType.hpp"
+
+namespace ot = opentxs;
+namespace fs = boost::filesystem;
+namespace otsync = ot::network::blockchain::sync;
+
+namespace ottest
+{
+using Chain = ot::blockchain::Type;
+using Height = ot::blockchain::block::Height;
+
+constexpr auto chain_ = Chain::UnitTest;
+
+class Test_SyncDatabase : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    const fs::path path_;
+    std::unique_ptr<ot::blockchain::database::common::Database> db_;
+
+    // Parses the packet stored for each height
+    static auto heights(const ot::network::zeromq::Message& in)
+        -> std::vector<Height>
+    {
+        auto output = std::vector<Height>{};
+
+        for (const auto& frame : in) {
+            auto proto = ot::proto::BlockchainP2PSync{};
+
+            if (false == proto.ParseFromArray(
+                             frame.data(), static_cast<int>(frame.size()))) {
+                output.emplace_back(-1);
+            } else {
+                output.emplace_back(static_cast<Height>(proto.height()));
+            }
+        }
+
+        return output;
+    }
+
+    static auto range(const Height first, const Height last)
+        -> std::vector<Height>
+    {
+        auto output = std::vector<Height>{};
+
+        for (auto i = first; i <= last; ++i) { output.emplace_back(i); }
+
+        return output;
+    }
+
+    auto load(const Height height) const -> ot::OTZMQMessage
+    {
+        auto output = ot::network::zeromq::Message::Factory();
+
+        EXPECT_TRUE(db_->LoadSync(chain_, height, output));
+
+        return output;
+    }
+
+    // Stores sync packets for every height in the specified range. The
+    // header of each packet is filled with the specified byte.
+    auto store(const Height first, const Height last, const char fill) const
+        -> bool
+    {
+        auto message = ot::network::zeromq::Message::Factory();
+        message->AddFrame();
+        message->AddFrame(ot::WorkType::SyncReply);
+
+        {
+            auto hello = ot::proto::BlockchainP2PHello{};
+            hello.set_version(1);
+            auto& state = *hello.add_state();
+            state.set_version(1);
+            state.set_chain(static_cast<std::uint32_t>(chain_));
+            state.set_height(static_cast<std::uint64_t>(last));
+            state.set_hash(std::string(32u, fill));
+            message->AddFrame(hello.SerializeAsString());
+        }
+
+        message->AddFrame(std::string(32u, fill));
+
+        for (auto height = first; height <= last; ++height) {
+            auto sync = ot::proto::BlockchainP2PSync{};
+            sync.set_version(1);
+            sync.set_chain(static_cast<std::uint32_t>(chain_));
+            sync.set_height(static_cast<std::uint64_t>(height));
+            sync.set_header(std::string(80u, fill));
+            sync.set_filter_type(
+                static_cast<std::uint32_t>(ot::blockchain::filter::Type::ES));
+            sync.set_filter_element_count(1);
+            sync.set_filter(std::string(8u, fill));
+            message->AddFrame(sync.SerializeAsString());
+        }
+
+        const auto base = otsync::Factory(api_, message);
+
+        if (otsync::MessageType::sync_reply != base->Type()) { return false; }
+
+        return db_->StoreSync(chain_, base->asData().Blocks());
+    }
+
+    Test_SyncDatabase()
+        : api_(ot::Context().StartClient({}, 0))
+        , path_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-sync-%%%%-%%%%-%%%%-%%%%"))
+        , db_([&] {
+            fs::create_directories(path_);
+
+            return std::make_unique<
+                ot::blockchain::database::common::Database>(
+                api_,
+                dynamic_cast<const ot::api::client::internal::Blockchain&>(
+                    api_.Blockchain()),
+                dynamic_cast<const ot::api::internal::Context&>(ot::Context())
+                    .Legacy(),
+                path_.string(),
+                ot::ArgList{});
+        }())
+    {
+    }
+
+    ~Test_SyncDatabase() override
+    {
+        db_.reset();
+        fs::remove_all(path_);
+    }
+};
+
+TEST_F(Test_SyncDatabase, genesis)
+{
+    EXPECT_EQ(db_->SyncTip(chain_), 0);
+    EXPECT_EQ(heights(load(-1)), range(0, 0));
+}
+
+TEST_F(Test_SyncDatabase, cached_segment_is_shared)
+{
+    ASSERT_TRUE(store(1, 3, 'a'));
+    EXPECT_EQ(db_->SyncTip(chain_), 3);
+
+    const auto first = load(0);
+    const auto second = load(0);
+
+    ASSERT_EQ(heights(first), range(1, 3));
+    ASSERT_EQ(heights(second), range(1, 3));
+
+    // NOTE both replies refer to the packets of the same cached segment
+    for (auto i = std::size_t{0}; i < first->size(); ++i) {
+        EXPECT_EQ(first->at(i).data(), second->at(i).data());
+    }
+
+    // NOTE a different start height is a different segment
+    const auto third = load(1);
+
+    ASSERT_EQ(heights(third), range(2, 3));
+    EXPECT_NE(third->at(0).data(), first->at(1).data());
+}
+
+TEST_F(Test_SyncDatabase, store_extends_partial_segment)
+{
+    ASSERT_TRUE(store(1, 3, 'a'));
+
+    const auto before = load(0);
+
+    ASSERT_EQ(heights(before), range(1, 3));
+    ASSERT_TRUE(store(4, 5, 'b'));
+
+    const auto after = load(0);
+
+    EXPECT_EQ(heights(after), range(1, 5));
+    EXPECT_NE(after->at(0).data(), before->at(0).data());
+}
+
+TEST_F(Test_SyncDatabase, reorg_invalidates_segment)
+{
+    ASSERT_TRUE(store(1, 5, 'a'));
+
+    const auto before = load(0);
+
+    ASSERT_EQ(heights(before), range(1, 5));
+    ASSERT_TRUE(db_->ReorgSync(chain_, 2));
+    EXPECT_EQ(db_->SyncTip(chain_), 2);
+    EXPECT_EQ(heights(load(0)), range(1, 2));
+    ASSERT_TRUE(store(3, 4, 'b'));
+
+    const auto after = load(0);
+
+    ASSERT_EQ(heights(after), range(1, 4));
+
+    auto proto = ot::proto::BlockchainP2PSync{};
+
+    ASSERT_TRUE(proto.ParseFromArray(
+        after->at(2).data(), static_cast<int>(after->at(2).size())));
+    EXPECT_EQ(proto.header(), std::string(80u, 'b'));
+
+    // NOTE frames queued before the reorg still refer to the old packets
+    ASSERT_TRUE(proto.ParseFromArray(
+        before->at(2).data(), static_cast<int>(before->at(2).size())));
+    EXPECT_EQ(proto.height(), 3u);
+    EXPECT_EQ(proto.header(), std::string(80u, 'a'));
+}
+
+TEST_F(Test_SyncDatabase, empty_range)
+{
+    auto output = ot::network::zeromq::Message::Factory();
+
+    EXPECT_FALSE(db_->LoadSync(chain_, 0, output));
+    EXPECT_EQ(output->size(), 0u);
+}
+}  // namespace ottest
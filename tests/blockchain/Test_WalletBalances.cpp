@@ -0,0 +1,296 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/database/wallet/Balances.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Balance = ot::blockchain::Balance;
+using Balances = ot::blockchain::database::wallet::Balances;
+using State = Balances::TxoState;
+
+auto nym_id() noexcept -> ot::OTNymID
+{
+    auto output = ot::identifier::Nym::Factory();
+    output->SetString(ot::Identifier::Random()->str());
+
+    return output;
+}
+
+// Applies the same state transitions as database::wallet::Output to a set of
+// running totals and to a plain list of outputs, and verifies the totals
+// against a full recount of the list after every step
+class Test_WalletBalances : public ::testing::Test
+{
+protected:
+    struct Txo {
+        State state_;
+        std::uint64_t value_;
+        std::vector<ot::OTIdentifier> accounts_{};
+        std::vector<ot::OTNymID> nyms_{};
+        Balances::Contributions contributions_{};
+    };
+
+    const ot::OTNymID alice_;
+    const ot::OTNymID bob_;
+    const ot::OTIdentifier alice_1_;
+    const ot::OTIdentifier alice_2_;
+    const ot::OTIdentifier bob_1_;
+    Balances balances_;
+    // NOTE contributions refer to totals, so outputs must not move
+    std::deque<Txo> outputs_;
+
+    static auto recount(const std::vector<const Txo*>& txos) noexcept
+        -> Balance
+    {
+        auto output = Balance{};
+        auto& [confirmed, unconfirmed] = output;
+
+        for (const auto* txo : txos) {
+            switch (txo->state_) {
+                case State::ConfirmedNew: {
+                    confirmed += txo->value_;
+                    unconfirmed += txo->value_;
+                } break;
+                case State::UnconfirmedSpend: {
+                    confirmed += txo->value_;
+                } break;
+                case State::UnconfirmedNew: {
+                    unconfirmed += txo->value_;
+                } break;
+                default: {
+                }
+            }
+        }
+
+        return output;
+    }
+
+    auto account(const std::size_t txo, const ot::Identifier& id) noexcept
+        -> void
+    {
+        auto& item = outputs_.at(txo);
+        item.accounts_.emplace_back(id);
+        balances_.AddAccount(
+            id, item.state_, item.value_, item.contributions_);
+    }
+    auto change(const std::size_t txo, const State from, const State to)
+        -> void
+    {
+        auto& item = outputs_.at(txo);
+
+        ASSERT_EQ(item.state_, from);
+
+        item.state_ = to;
+        balances_.Change(item.contributions_, from, to, item.value_);
+    }
+    auto create(const State state, const std::uint64_t value) noexcept
+        -> std::size_t
+    {
+        outputs_.emplace_back(Txo{state, value});
+        balances_.Add(state, value);
+
+        return outputs_.size() - 1u;
+    }
+    auto nym(const std::size_t txo, const ot::identifier::Nym& id) noexcept
+        -> void
+    {
+        auto& item = outputs_.at(txo);
+        item.nyms_.emplace_back(id);
+        balances_.AddNym(id, item.state_, item.value_, item.contributions_);
+    }
+    // Creates an output which belongs to an account of the nym
+    auto receive(
+        const State state,
+        const std::uint64_t value,
+        const ot::identifier::Nym& owner,
+        const ot::Identifier& acct) noexcept -> std::size_t
+    {
+        const auto output = create(state, value);
+        account(output, acct);
+        nym(output, owner);
+
+        return output;
+    }
+    auto verify() const -> void
+    {
+        auto all = std::vector<const Txo*>{};
+
+        for (const auto& txo : outputs_) { all.emplace_back(&txo); }
+
+        EXPECT_EQ(balances_.Chain(), recount(all));
+
+        for (const auto& id : {alice_1_, alice_2_, bob_1_}) {
+            auto txos = std::vector<const Txo*>{};
+
+            for (const auto& txo : outputs_) {
+                for (const auto& acct : txo.accounts_) {
+                    if (acct == id) { txos.emplace_back(&txo); }
+                }
+            }
+
+            EXPECT_EQ(balances_.Account(id), recount(txos));
+        }
+
+        for (const auto& id : {alice_, bob_}) {
+            auto txos = std::vector<const Txo*>{};
+
+            for (const auto& txo : outputs_) {
+                for (const auto& owner : txo.nyms_) {
+                    if (owner == id) { txos.emplace_back(&txo); }
+                }
+            }
+
+            EXPECT_EQ(balances_.Nym(id), recount(txos));
+        }
+    }
+    auto changed() noexcept -> std::set<ot::OTNymID>
+    {
+        auto output = std::set<ot::OTNymID>{};
+
+        for (const auto& [id, balance] : balances_.TakeChanged()) {
+            EXPECT_EQ(balance, balances_.Nym(id));
+
+            output.emplace(id);
+        }
+
+        return output;
+    }
+
+    Test_WalletBalances()
+        : alice_(nym_id())
+        , bob_(nym_id())
+        , alice_1_(ot::Identifier::Random())
+        , alice_2_(ot::Identifier::Random())
+        , bob_1_(ot::Identifier::Random())
+        , balances_()
+        , outputs_()
+    {
+    }
+};
+
+TEST_F(Test_WalletBalances, confirm_and_spend)
+{
+    const auto a = receive(State::UnconfirmedNew, 1000, alice_, alice_1_);
+    const auto b = receive(State::ConfirmedNew, 2000, alice_, alice_2_);
+    verify();
+
+    EXPECT_EQ(balances_.Nym(alice_), Balance(2000, 3000));
+    EXPECT_EQ(changed(), std::set<ot::OTNymID>{alice_});
+
+    change(a, State::UnconfirmedNew, State::ConfirmedNew);
+    verify();
+
+    EXPECT_EQ(balances_.Nym(alice_), Balance(3000, 3000));
+
+    // Alice pays Bob from output b and receives change
+    change(b, State::ConfirmedNew, State::UnconfirmedSpend);
+    const auto pay = receive(State::UnconfirmedNew, 1500, bob_, bob_1_);
+    const auto rest = receive(State::UnconfirmedNew, 400, alice_, alice_2_);
+    verify();
+
+    EXPECT_EQ(balances_.Nym(alice_), Balance(3000, 1400));
+    EXPECT_EQ(balances_.Nym(bob_), Balance(0, 1500));
+    EXPECT_EQ(changed(), (std::set<ot::OTNymID>{alice_, bob_}));
+
+    change(b, State::UnconfirmedSpend, State::ConfirmedSpend);
+    change(pay, State::UnconfirmedNew, State::ConfirmedNew);
+    change(rest, State::UnconfirmedNew, State::ConfirmedNew);
+    verify();
+
+    EXPECT_EQ(balances_.Nym(alice_), Balance(1400, 1400));
+    EXPECT_EQ(balances_.Nym(bob_), Balance(1500, 1500));
+    EXPECT_EQ(balances_.Chain(), Balance(2900, 2900));
+    EXPECT_EQ(changed(), (std::set<ot::OTNymID>{alice_, bob_}));
+    EXPECT_TRUE(changed().empty());
+}
+
+TEST_F(Test_WalletBalances, reorg_and_orphan)
+{
+    const auto a = receive(State::ConfirmedNew, 1000, alice_, alice_1_);
+    const auto b = receive(State::ConfirmedNew, 500, bob_, bob_1_);
+    change(a, State::ConfirmedNew, State::UnconfirmedSpend);
+    const auto c = receive(State::UnconfirmedNew, 900, bob_, bob_1_);
+    change(a, State::UnconfirmedSpend, State::ConfirmedSpend);
+    change(c, State::UnconfirmedNew, State::ConfirmedNew);
+    verify();
+    changed();
+
+    // The block containing the spend of a and the creation of c is
+    // disconnected
+    change(a, State::ConfirmedSpend, State::UnconfirmedSpend);
+    change(c, State::ConfirmedNew, State::UnconfirmedNew);
+    verify();
+
+    EXPECT_EQ(balances_.Nym(alice_), Balance(1000, 0));
+    EXPECT_EQ(balances_.Nym(bob_), Balance(500, 1400));
+    EXPECT_EQ(changed(), (std::set<ot::OTNymID>{alice_, bob_}));
+
+    // The transaction is not mined on the new chain so c is orphaned and a
+    // becomes spendable again
+    change(c, State::UnconfirmedNew, State::OrphanedNew);
+    change(a, State::UnconfirmedSpend, State::ConfirmedNew);
+    verify();
+
+    EXPECT_EQ(balances_.Nym(alice_), Balance(1000, 1000));
+    EXPECT_EQ(balances_.Nym(bob_), Balance(500, 500));
+
+    // A later block contains the transaction after all
+    change(c, State::OrphanedNew, State::UnconfirmedNew);
+    change(c, State::UnconfirmedNew, State::ConfirmedNew);
+    change(a, State::ConfirmedNew, State::ConfirmedSpend);
+    change(b, State::ConfirmedNew, State::OrphanedNew);
+    verify();
+
+    EXPECT_EQ(balances_.Nym(alice_), Balance(0, 0));
+    EXPECT_EQ(balances_.Nym(bob_), Balance(900, 900));
+    EXPECT_EQ(balances_.Chain(), Balance(900, 900));
+}
+
+TEST_F(Test_WalletBalances, shared_outputs)
+{
+    // An output which belongs to both nyms, and one which is associated with
+    // a nym before its account is known
+    const auto shared = create(State::UnconfirmedNew, 700);
+    nym(shared, alice_);
+    nym(shared, bob_);
+    const auto late = create(State::ConfirmedNew, 300);
+    nym(late, alice_);
+    verify();
+
+    EXPECT_EQ(balances_.Account(alice_1_), Balance(0, 0));
+
+    account(late, alice_1_);
+    change(shared, State::UnconfirmedNew, State::ConfirmedNew);
+    verify();
+
+    EXPECT_EQ(balances_.Nym(alice_), Balance(1000, 1000));
+    EXPECT_EQ(balances_.Nym(bob_), Balance(700, 700));
+    EXPECT_EQ(balances_.Account(alice_1_), Balance(300, 300));
+
+    change(late, State::ConfirmedNew, State::UnconfirmedSpend);
+    verify();
+
+    EXPECT_EQ(changed(), (std::set<ot::OTNymID>{alice_, bob_}));
+
+    change(shared, State::ConfirmedNew, State::OrphanedNew);
+    verify();
+}
+}  // namespace ottest
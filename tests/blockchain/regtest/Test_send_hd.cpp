@@ -342,6 +342,19 @@ TEST_F(Regtest_fixture_hd, first_block)
 
     ASSERT_EQ(block.size(), 1);
 
+    {
+        const auto& oracle = blockchain.BlockOracle();
+        const auto before = oracle.CacheStatistics();
+        const auto pCached = oracle.LoadBitcoin(blockHash).get();
+        const auto after = oracle.CacheStatistics();
+
+        ASSERT_TRUE(pCached);
+        EXPECT_EQ(pCached->ID(), block.ID());
+        EXPECT_GT(after.hits_, before.hits_);
+        EXPECT_GT(after.blocks_, 0u);
+        EXPECT_LE(after.bytes_, std::max(after.limit_, block.CalculateSize()));
+    }
+
     const auto pTx = block.at(0);
 
     ASSERT_TRUE(pTx);
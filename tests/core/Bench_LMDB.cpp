@@ -0,0 +1,94 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "opentxs/Bytes.hpp"
+#include "util/LMDB.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+TEST(Bench_LMDB, lookups)
+{
+    using Clock = std::chrono::steady_clock;
+    using LMDB = ot::storage::lmdb::LMDB;
+    constexpr auto table = 0;
+    constexpr auto count = std::size_t{100000};
+    const auto path = fs::temp_directory_path() /
+                      fs::unique_path("opentxs-lmdb-%%%%-%%%%-%%%%-%%%%");
+    fs::create_directories(path);
+
+    {
+        const auto names = ot::storage::lmdb::TableNames{{table, "bench"}};
+        const auto init = ot::storage::lmdb::TablesToInit{{table, 0}};
+        const auto lmdb = LMDB{names, path.string(), init};
+        auto indices = std::vector<std::size_t>(count);
+        auto keys = std::vector<ot::ReadView>{};
+        keys.reserve(count);
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            indices.at(i) = i;
+            keys.emplace_back(
+                reinterpret_cast<const char*>(&indices.at(i)), sizeof(i));
+            lmdb.Queue(table, keys.back(), std::to_string(i));
+        }
+
+        ASSERT_TRUE(lmdb.Commit());
+
+        auto found = std::size_t{};
+        const auto load = [&](const auto index) {
+            lmdb.Load(table, index, [&](const auto) { ++found; });
+        };
+        const auto time = [&](const auto& name, const auto& cb) {
+            found = 0;
+            const auto start = Clock::now();
+            cb();
+            const auto elapsed =
+                std::chrono::duration<double>(Clock::now() - start).count();
+
+            EXPECT_EQ(found, count);
+
+            std::cout << "  " << name << ": "
+                      << static_cast<std::size_t>(count / elapsed)
+                      << " lookups per second\n";
+        };
+
+        std::cout << count << " keys\n";
+        // NOTE the wrapper used to begin and abort a read transaction for
+        // every lookup
+        time("new transaction per lookup", [&] {
+            for (const auto& index : indices) {
+                auto tx = lmdb.TransactionRO();
+                load(index);
+                tx.Finalize(false);
+            }
+        });
+        time("reused transaction", [&] {
+            for (const auto& index : indices) { load(index); }
+        });
+        time("snapshot", [&] {
+            const auto snapshot = lmdb.ReadSnapshot();
+
+            for (const auto& index : indices) { load(index); }
+        });
+        time("LoadMany", [&] {
+            lmdb.LoadMany(table, keys, [&](const auto, const auto) {
+                ++found;
+            });
+        });
+    }
+
+    fs::remove_all(path);
+}
+}  // namespace ottest
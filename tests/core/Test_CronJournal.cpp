@@ -0,0 +1,197 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "core/OTStorage.hpp"
+#include "core/cron/Journal.hpp"
+#include "internal/api/client/Client.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Journal = ot::cron::Journal;
+using Records = std::vector<std::string>;
+
+class Test_CronJournal : public ::testing::Test
+{
+public:
+    static constexpr auto folder_ = "cronjournal";
+
+    const ot::api::client::internal::Manager& api_;
+
+    // Loads the journal the way LoadCron does after a restart
+    auto replay(const std::string& file, const std::int64_t generation)
+        -> Records
+    {
+        auto output = Records{};
+        auto journal = Journal{api_, folder_, file};
+        journal.Open(generation);
+        const auto count = journal.Replay([&](const auto& record) {
+            output.emplace_back(record);
+
+            return true;
+        });
+
+        EXPECT_EQ(count, output.size());
+        EXPECT_EQ(journal.Records(), static_cast<std::int64_t>(count));
+
+        return output;
+    }
+
+    auto exists(
+        const std::string& file,
+        const std::int64_t generation,
+        const std::int64_t entry) const -> bool
+    {
+        return ot::OTDB::Exists(
+            api_,
+            api_.DataFolder(),
+            folder_,
+            file,
+            std::to_string(generation),
+            std::to_string(entry));
+    }
+
+    auto store(
+        const std::string& file,
+        const std::int64_t generation,
+        const std::int64_t entry,
+        const std::string& contents) const -> bool
+    {
+        return ot::OTDB::StorePlainString(
+            api_,
+            contents,
+            api_.DataFolder(),
+            folder_,
+            file,
+            std::to_string(generation),
+            std::to_string(entry));
+    }
+
+    Test_CronJournal()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::Args(), 0)))
+    {
+    }
+};
+
+TEST_F(Test_CronJournal, replays_records_in_order)
+{
+    const auto file = std::string{"order"};
+    const auto expected = Records{"numbers\n2\n5 6 ", "consume\n1\n5 ", ""};
+    auto journal = Journal{api_, folder_, file};
+    journal.Open(0);
+
+    for (const auto& record : expected) { EXPECT_TRUE(journal.Append(record)); }
+
+    EXPECT_EQ(journal.Records(), 3);
+    EXPECT_TRUE(exists(file, 0, 2));
+    EXPECT_EQ(replay(file, 0), expected);
+}
+
+TEST_F(Test_CronJournal, batch_is_written_as_one_entry)
+{
+    const auto file = std::string{"batch"};
+    auto journal = Journal{api_, folder_, file};
+    journal.Open(0);
+    journal.Batch();
+
+    EXPECT_TRUE(journal.Batching());
+    EXPECT_TRUE(journal.Append("remove\n1\n"));
+    EXPECT_TRUE(journal.Append("remove\n2\n"));
+    EXPECT_EQ(journal.Records(), 2);
+    EXPECT_FALSE(exists(file, 0, 0));
+    EXPECT_TRUE(replay(file, 0).empty());
+
+    // Consumed numbers are written immediately, along with the buffered
+    // records which precede them
+    EXPECT_TRUE(journal.Append("consume\n1\n7 ", true));
+    EXPECT_TRUE(journal.Append("remove\n3\n"));
+    EXPECT_EQ(
+        replay(file, 0),
+        (Records{"remove\n1\n", "remove\n2\n", "consume\n1\n7 "}));
+    EXPECT_TRUE(journal.Flush());
+    EXPECT_FALSE(journal.Batching());
+    EXPECT_TRUE(exists(file, 0, 1));
+    EXPECT_FALSE(exists(file, 0, 2));
+    EXPECT_EQ(
+        replay(file, 0),
+        (Records{
+            "remove\n1\n", "remove\n2\n", "consume\n1\n7 ", "remove\n3\n"}));
+}
+
+TEST_F(Test_CronJournal, snapshot_starts_a_new_generation)
+{
+    const auto file = std::string{"snapshot"};
+    auto journal = Journal{api_, folder_, file};
+    journal.Open(0);
+
+    EXPECT_TRUE(journal.Append("a"));
+    EXPECT_EQ(journal.Rotate(), 1);
+
+    journal.Rotated(false);
+
+    EXPECT_EQ(journal.Generation(), 0);
+    EXPECT_EQ(journal.Records(), 1);
+    EXPECT_EQ(replay(file, 0), Records{"a"});
+    EXPECT_EQ(journal.Rotate(), 1);
+
+    journal.Rotated(true);
+
+    EXPECT_EQ(journal.Generation(), 1);
+    EXPECT_EQ(journal.Records(), 0);
+    EXPECT_FALSE(exists(file, 0, 0));
+    EXPECT_TRUE(journal.Append("b"));
+    EXPECT_EQ(replay(file, 1), Records{"b"});
+}
+
+TEST_F(Test_CronJournal, recovers_from_a_partial_journal)
+{
+    const auto file = std::string{"crash"};
+
+    {
+        auto journal = Journal{api_, folder_, file};
+        journal.Open(1);
+
+        EXPECT_TRUE(journal.Append("a"));
+        EXPECT_TRUE(journal.Append("b"));
+    }
+
+    // The process stopped while the third entry was being written, after the
+    // snapshot for generation 1 had been saved but before every entry of
+    // generation 0 had been erased
+    ASSERT_TRUE(store(file, 1, 2, "1\nc10\nincomp"));
+    ASSERT_TRUE(store(file, 0, 0, "5\nstale"));
+    ASSERT_TRUE(store(file, 0, 1, "5\nstale"));
+
+    auto journal = Journal{api_, folder_, file};
+    journal.Open(1);
+    auto replayed = Records{};
+    journal.Replay([&](const auto& record) {
+        replayed.emplace_back(record);
+
+        return true;
+    });
+
+    EXPECT_EQ(replayed, (Records{"a", "b", "c"}));
+    EXPECT_EQ(journal.Records(), 3);
+    EXPECT_FALSE(exists(file, 0, 0));
+    EXPECT_FALSE(exists(file, 0, 1));
+
+    // New records are written after the damaged entry
+    EXPECT_TRUE(journal.Append("d"));
+    EXPECT_TRUE(exists(file, 1, 3));
+    EXPECT_EQ(replay(file, 1), (Records{"a", "b", "c", "d"}));
+}
+}  // namespace ottest
@@ -0,0 +1,98 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "core/cron/Schedule.hpp"
+#include "opentxs/Types.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Schedule = ot::cron::Schedule;
+
+class Test_CronSchedule : public ::testing::Test
+{
+public:
+    const ot::Time start_;
+    Schedule schedule_;
+
+    auto at(const int seconds) const -> ot::Time
+    {
+        return start_ + std::chrono::seconds{seconds};
+    }
+
+    auto due(const int seconds) const -> std::vector<std::int64_t>
+    {
+        auto output = std::vector<std::int64_t>{};
+
+        for (const auto& [added, number] : schedule_.Due(at(seconds))) {
+            output.emplace_back(number);
+        }
+
+        return output;
+    }
+
+    Test_CronSchedule()
+        : start_(ot::Clock::now())
+        , schedule_()
+    {
+    }
+};
+
+TEST_F(Test_CronSchedule, due_items_follow_their_intervals)
+{
+    // An item which has never been processed is due immediately
+    schedule_.Add(1, at(0), at(0));
+    schedule_.Add(2, at(1), at(5));
+    schedule_.Add(3, at(2), at(10));
+    schedule_.Add(4, at(3), at(30));
+
+    EXPECT_EQ(schedule_.Size(), 4u);
+    EXPECT_EQ(due(-1), std::vector<std::int64_t>{});
+    EXPECT_EQ(due(0), std::vector<std::int64_t>{1});
+    EXPECT_EQ(due(5), (std::vector<std::int64_t>{1, 2}));
+    EXPECT_EQ(due(29), (std::vector<std::int64_t>{1, 2, 3}));
+    EXPECT_EQ(due(30), (std::vector<std::int64_t>{1, 2, 3, 4}));
+
+    // Processing an item moves it forward by its interval
+    schedule_.Add(1, at(0), at(20));
+    schedule_.Add(2, at(1), at(10));
+
+    EXPECT_EQ(schedule_.Size(), 4u);
+    EXPECT_EQ(due(5), std::vector<std::int64_t>{});
+    EXPECT_EQ(due(10), (std::vector<std::int64_t>{2, 3}));
+    EXPECT_EQ(due(20), (std::vector<std::int64_t>{1, 2, 3}));
+}
+
+TEST_F(Test_CronSchedule, due_items_keep_the_order_they_were_added)
+{
+    schedule_.Add(7, at(3), at(1));
+    schedule_.Add(5, at(1), at(4));
+    schedule_.Add(9, at(2), at(2));
+    schedule_.Add(6, at(1), at(3));
+
+    EXPECT_EQ(due(4), (std::vector<std::int64_t>{5, 6, 9, 7}));
+}
+
+TEST_F(Test_CronSchedule, removed_items_are_not_due)
+{
+    schedule_.Add(1, at(0), at(0));
+    schedule_.Add(2, at(1), at(0));
+    schedule_.Remove(1);
+    schedule_.Remove(3);
+
+    EXPECT_EQ(schedule_.Size(), 1u);
+    EXPECT_EQ(due(0), std::vector<std::int64_t>{2});
+    EXPECT_FALSE(schedule_.Added(1).has_value());
+    ASSERT_TRUE(schedule_.Added(2).has_value());
+    EXPECT_EQ(schedule_.Added(2).value(), at(1));
+}
+}  // namespace ottest
@@ -0,0 +1,197 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Bytes.hpp"
+#include "util/LMDB.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace ottest
+{
+class Test_LMDB : public ::testing::Test
+{
+protected:
+    using LMDB = ot::storage::lmdb::LMDB;
+
+    static constexpr auto table_{0};
+    static const ot::storage::lmdb::TableNames names_;
+
+    const std::string path_;
+    std::unique_ptr<LMDB> lmdb_;
+
+    static auto key(const std::size_t& in) noexcept -> ot::ReadView
+    {
+        return {reinterpret_cast<const char*>(&in), sizeof(in)};
+    }
+    static auto value(const std::size_t in) noexcept -> std::string
+    {
+        return "value " + std::to_string(in);
+    }
+
+    auto load(const std::size_t index) const noexcept -> std::string
+    {
+        auto output = std::string{};
+        lmdb_->Load(table_, index, [&](const auto in) { output = in; });
+
+        return output;
+    }
+    auto open() noexcept -> void
+    {
+        lmdb_ = std::make_unique<LMDB>(
+            names_, path_, ot::storage::lmdb::TablesToInit{{table_, 0}});
+    }
+    auto store(const std::size_t index, const std::string& data) noexcept
+        -> bool
+    {
+        return lmdb_->Store(table_, index, data).first;
+    }
+
+    Test_LMDB()
+        : path_([] {
+            const auto path =
+                fs::temp_directory_path() /
+                fs::unique_path("opentxs-lmdb-%%%%-%%%%-%%%%-%%%%");
+            fs::create_directories(path);
+
+            return path.string();
+        }())
+        , lmdb_()
+    {
+        open();
+
+        for (auto i = std::size_t{0}; i < 10u; ++i) {
+            EXPECT_TRUE(store(i, value(i)));
+        }
+    }
+
+    ~Test_LMDB() override
+    {
+        lmdb_.reset();
+
+        try {
+            fs::remove_all(path_);
+        } catch (...) {
+        }
+    }
+};
+
+const ot::storage::lmdb::TableNames Test_LMDB::names_{{table_, "test"}};
+
+TEST_F(Test_LMDB, load_many)
+{
+    const auto indices = std::vector<std::size_t>{1, 20, 3, 9, 10};
+    const auto keys = [&] {
+        auto out = std::vector<ot::ReadView>{};
+
+        for (const auto& index : indices) { out.emplace_back(key(index)); }
+
+        return out;
+    }();
+    auto found = std::map<std::size_t, std::string>{};
+    const auto count =
+        lmdb_->LoadMany(table_, keys, [&](const auto i, const auto data) {
+            found.emplace(i, data);
+        });
+
+    EXPECT_EQ(count, 3u);
+    ASSERT_EQ(found.size(), 3u);
+    EXPECT_EQ(found.at(0), value(1));
+    EXPECT_EQ(found.at(2), value(3));
+    EXPECT_EQ(found.at(3), value(9));
+    EXPECT_EQ(lmdb_->LoadMany(table_, {}, [](auto, auto) {}), 0u);
+    EXPECT_EQ(lmdb_->LoadMany(table_, keys, {}), 0u);
+}
+
+TEST_F(Test_LMDB, snapshot)
+{
+    {
+        auto snapshot = lmdb_->ReadSnapshot();
+
+        EXPECT_TRUE(store(1, "changed"));
+        EXPECT_TRUE(store(10, value(10)));
+        EXPECT_EQ(load(1), value(1));
+        EXPECT_EQ(load(10), "");
+        EXPECT_FALSE(lmdb_->Exists(table_, key(10)));
+
+        // Other threads are not affected by the snapshot
+        auto other = std::async(std::launch::async, [&] { return load(1); });
+
+        EXPECT_EQ(other.get(), "changed");
+    }
+
+    EXPECT_EQ(load(1), "changed");
+    EXPECT_EQ(load(10), value(10));
+}
+
+TEST_F(Test_LMDB, nested_reads)
+{
+    auto count = std::size_t{0};
+    const auto read = lmdb_->Read(
+        table_,
+        [&](const auto, const auto data) {
+            EXPECT_EQ(load(count), data);
+            EXPECT_TRUE(lmdb_->Exists(table_, key(count)));
+            ++count;
+
+            return true;
+        },
+        LMDB::Dir::Forward);
+
+    EXPECT_TRUE(read);
+    EXPECT_EQ(count, 10u);
+    EXPECT_EQ(load(5), value(5));
+}
+
+TEST_F(Test_LMDB, short_lived_threads)
+{
+    for (auto round = std::size_t{0}; round < 4u; ++round) {
+        auto threads = std::vector<std::thread>{};
+
+        for (auto i = std::size_t{0}; i < 8u; ++i) {
+            threads.emplace_back([&, i] {
+                EXPECT_EQ(load(i), value(i));
+                EXPECT_TRUE(store(i, value(i)));
+                EXPECT_EQ(load(i), value(i));
+            });
+        }
+
+        for (auto& thread : threads) { thread.join(); }
+    }
+}
+
+TEST_F(Test_LMDB, thread_outlives_environment)
+{
+    auto loaded = std::promise<void>{};
+    auto closed = std::promise<void>{};
+    auto reopened = std::promise<void>{};
+    auto thread = std::thread{[&] {
+        EXPECT_EQ(load(2), value(2));
+        loaded.set_value();
+        closed.get_future().wait();
+        reopened.get_future().wait();
+        EXPECT_EQ(load(3), value(3));
+    }};
+    loaded.get_future().wait();
+    lmdb_.reset();
+    closed.set_value();
+    open();
+    reopened.set_value();
+    thread.join();
+
+    EXPECT_EQ(load(4), value(4));
+}
+}  // namespace ottest
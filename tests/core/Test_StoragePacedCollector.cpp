@@ -0,0 +1,198 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <string>
+#include <thread>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/api/storage/Driver.hpp"
+#include "storage/PacedCollector.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Collector = ot::storage::PacedCollector;
+
+// Keeps two buckets in memory. Objects in backup_ can only be recovered by
+// Migrate, which is how the multiplex falls back to its backup plugins.
+class FakeDriver final : public ot::api::storage::Driver
+{
+public:
+    mutable std::map<std::string, std::string> bucket_[2];
+    std::map<std::string, std::string> backup_;
+    std::chrono::milliseconds delay_;
+
+    auto EmptyBucket(const bool bucket) const -> bool final
+    {
+        bucket_[bucket].clear();
+
+        return true;
+    }
+    auto Load(const std::string& key, const bool, std::string& value) const
+        -> bool final
+    {
+        return LoadFromBucket(key, value, false) ||
+               LoadFromBucket(key, value, true);
+    }
+    auto LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const -> bool final
+    {
+        std::this_thread::sleep_for(delay_);
+        const auto& map = bucket_[bucket];
+
+        if (auto it = map.find(key); map.end() != it) {
+            value = it->second;
+
+            return true;
+        }
+
+        return false;
+    }
+    auto LoadRoot() const -> std::string final { return {}; }
+    auto Migrate(const std::string& key, const Driver& to) const
+        -> bool final
+    {
+        if (auto it = backup_.find(key); backup_.end() != it) {
+            return to.Store(false, key, it->second, current_);
+        }
+
+        return false;
+    }
+    auto Store(
+        const bool,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket) const -> bool final
+    {
+        bucket_[bucket][key] = value;
+
+        return true;
+    }
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final
+    {
+        promise.set_value(Store(isTransaction, key, value, bucket));
+    }
+    auto Store(const bool, const std::string&, std::string&) const
+        -> bool final
+    {
+        return false;
+    }
+    auto StoreRoot(const bool, const std::string&) const -> bool final
+    {
+        return true;
+    }
+
+    FakeDriver(const bool current)
+        : bucket_()
+        , backup_()
+        , delay_(0)
+        , current_(current)
+    {
+    }
+
+    ~FakeDriver() final = default;
+
+private:
+    const bool current_;
+};
+
+class Test_StoragePacedCollector : public ::testing::Test
+{
+public:
+    static constexpr auto collected_ = false;
+    static constexpr auto current_ = true;
+
+    FakeDriver driver_;
+
+    Test_StoragePacedCollector()
+        : driver_(current_)
+    {
+    }
+};
+
+TEST_F(Test_StoragePacedCollector, copies_live_objects)
+{
+    driver_.bucket_[collected_]["a"] = "alpha";
+    driver_.bucket_[collected_]["b"] = "beta";
+    driver_.bucket_[collected_]["garbage"] = "unreachable";
+    const auto collector = Collector{driver_, collected_};
+
+    EXPECT_TRUE(collector.Migrate("a", driver_));
+    EXPECT_TRUE(collector.Migrate("b", driver_));
+    EXPECT_EQ(driver_.bucket_[current_].at("a"), "alpha");
+    EXPECT_EQ(driver_.bucket_[current_].at("b"), "beta");
+    EXPECT_EQ(driver_.bucket_[current_].count("garbage"), 0u);
+
+    const auto stats = collector.Stats();
+
+    EXPECT_EQ(stats.objects_, 2u);
+    EXPECT_EQ(stats.bytes_, 9u);
+    EXPECT_EQ(stats.recovered_, 0u);
+}
+
+TEST_F(Test_StoragePacedCollector, current_bucket_is_not_copied)
+{
+    driver_.bucket_[current_]["a"] = "rewritten";
+    const auto collector = Collector{driver_, collected_};
+
+    EXPECT_TRUE(collector.Migrate("a", driver_));
+    EXPECT_EQ(driver_.bucket_[current_].at("a"), "rewritten");
+    EXPECT_EQ(collector.Stats().objects_, 0u);
+}
+
+TEST_F(Test_StoragePacedCollector, falls_back_to_source_driver)
+{
+    driver_.backup_["a"] = "alpha";
+    const auto collector = Collector{driver_, collected_};
+
+    EXPECT_TRUE(collector.Migrate("a", driver_));
+    EXPECT_EQ(driver_.bucket_[current_].at("a"), "alpha");
+    EXPECT_FALSE(collector.Migrate("missing", driver_));
+    EXPECT_FALSE(collector.Migrate("", driver_));
+
+    const auto stats = collector.Stats();
+
+    EXPECT_EQ(stats.objects_, 1u);
+    EXPECT_EQ(stats.recovered_, 1u);
+}
+
+TEST_F(Test_StoragePacedCollector, slices_are_bounded)
+{
+    constexpr auto count = 20;
+    constexpr auto slice = std::chrono::milliseconds{10};
+    constexpr auto rest = std::chrono::milliseconds{5};
+    driver_.delay_ = std::chrono::milliseconds{2};
+
+    for (auto i = 0; i < count; ++i) {
+        driver_.bucket_[collected_][std::to_string(i)] = "x";
+    }
+
+    const auto collector = Collector{driver_, collected_, slice, rest};
+
+    for (auto i = 0; i < count; ++i) {
+        EXPECT_TRUE(collector.Migrate(std::to_string(i), driver_));
+    }
+
+    const auto stats = collector.Stats();
+
+    EXPECT_EQ(stats.objects_, static_cast<std::size_t>(count));
+    EXPECT_GT(stats.slices_, 1u);
+    // NOTE a slice may overrun its budget by the duration of one object
+    EXPECT_LT(stats.longest_, slice + std::chrono::milliseconds{100});
+}
+}  // namespace ottest
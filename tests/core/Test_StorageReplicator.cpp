@@ -0,0 +1,191 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "storage/Replicator.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Job = ot::storage::Replicator::Job;
+
+class Test_StorageReplicator : public ::testing::Test
+{
+public:
+    std::mutex lock_;
+    std::vector<std::string> replicated_;
+    ot::storage::Replicator replicator_;
+
+    static auto store(const std::size_t index, const std::size_t bytes = 1u)
+        -> Job
+    {
+        return Job{
+            Job::Type::Store,
+            false,
+            false,
+            std::to_string(index),
+            std::string(bytes, 'x'),
+            {}};
+    }
+
+    auto record(const Job& job) -> void
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+        replicated_.emplace_back(job.key_);
+    }
+
+    auto replicated() -> std::vector<std::string>
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        return replicated_;
+    }
+
+    Test_StorageReplicator()
+        : lock_()
+        , replicated_()
+        , replicator_(1024u)
+    {
+    }
+};
+
+TEST_F(Test_StorageReplicator, preserves_order)
+{
+    constexpr auto count = std::size_t{1000};
+    auto expected = std::vector<std::string>{};
+    replicator_.Start([this](const auto& job) { record(job); });
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        auto job = store(i);
+
+        if (0u == i % 3u) {
+            job.type_ = Job::Type::StoreRoot;
+        } else if (0u == i % 7u) {
+            job.type_ = Job::Type::EmptyBucket;
+        }
+
+        expected.emplace_back(job.key_);
+        replicator_.Enqueue(std::move(job));
+    }
+
+    replicator_.Stop();
+
+    EXPECT_EQ(replicated(), expected);
+    EXPECT_EQ(replicator_.QueueDepth(), 0u);
+    EXPECT_EQ(replicator_.QueueBytes(), 0u);
+}
+
+TEST_F(Test_StorageReplicator, full_queue_blocks_writers)
+{
+    constexpr auto bytes = std::size_t{600};
+    auto gate = std::promise<void>{};
+    auto started = std::promise<void>{};
+    auto opened = gate.get_future().share();
+    replicator_.Start([&](const auto& job) {
+        if ("0" == job.key_) {
+            started.set_value();
+            opened.wait();
+        }
+
+        record(job);
+    });
+
+    // NOTE the first job is removed from the queue while it is being copied
+    replicator_.Enqueue(store(0, bytes));
+    started.get_future().wait();
+    replicator_.Enqueue(store(1, bytes));
+
+    EXPECT_EQ(replicator_.QueueDepth(), 1u);
+
+    auto blocked = std::async(std::launch::async, [&] {
+        replicator_.Enqueue(store(2, bytes));
+    });
+
+    EXPECT_EQ(
+        blocked.wait_for(std::chrono::milliseconds{200}),
+        std::future_status::timeout);
+    EXPECT_EQ(replicator_.QueueDepth(), 1u);
+    EXPECT_EQ(replicator_.QueueBytes(), bytes + 1u);
+
+    gate.set_value();
+
+    EXPECT_EQ(
+        blocked.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+
+    replicator_.Stop();
+
+    EXPECT_EQ(replicated(), (std::vector<std::string>{"0", "1", "2"}));
+}
+
+TEST_F(Test_StorageReplicator, oversized_job_is_accepted_by_empty_queue)
+{
+    replicator_.Start([this](const auto& job) { record(job); });
+    replicator_.Enqueue(store(0, 4096u));
+    replicator_.Stop();
+
+    EXPECT_EQ(replicated(), std::vector<std::string>{"0"});
+}
+
+TEST_F(Test_StorageReplicator, stop_drains_queue)
+{
+    constexpr auto count = std::size_t{100};
+    replicator_.Start([this](const auto& job) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        record(job);
+    });
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        replicator_.Enqueue(store(i));
+    }
+
+    replicator_.Stop();
+
+    EXPECT_EQ(replicated().size(), count);
+
+    // NOTE jobs queued after shutdown are discarded
+    replicator_.Enqueue(store(count));
+
+    EXPECT_EQ(replicator_.QueueDepth(), 0u);
+    EXPECT_EQ(replicated().size(), count);
+}
+
+TEST_F(Test_StorageReplicator, pause_holds_queued_jobs)
+{
+    replicator_.Start([this](const auto& job) { record(job); });
+    replicator_.Pause();
+    replicator_.Enqueue(store(0));
+    replicator_.Enqueue(store(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    EXPECT_TRUE(replicated().empty());
+    EXPECT_EQ(replicator_.QueueDepth(), 2u);
+
+    replicator_.Resume();
+    replicator_.Stop();
+
+    EXPECT_EQ(replicated(), (std::vector<std::string>{"0", "1"}));
+}
+
+TEST_F(Test_StorageReplicator, not_started)
+{
+    replicator_.Enqueue(store(0));
+
+    EXPECT_EQ(replicator_.QueueDepth(), 0u);
+
+    replicator_.Stop();
+
+    EXPECT_TRUE(replicated().empty());
+}
+}  // namespace ottest
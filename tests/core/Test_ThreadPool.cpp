@@ -0,0 +1,146 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/api/Api.hpp"
+#include "internal/api/Factory.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/ThreadPool.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Work = ot::api::internal::ThreadPool::Work;
+
+class Test_ThreadPool : public ::testing::Test
+{
+public:
+    static constexpr auto timeout_ = std::chrono::seconds{30};
+
+    std::atomic<std::size_t> counter_;
+    std::promise<void> promise_;
+    std::future<void> done_;
+    // NOTE declared last so queued tasks finish before the state they use is
+    // destroyed
+    std::unique_ptr<ot::api::internal::ThreadPool> pool_;
+
+    auto finished(const Work type) const noexcept -> std::size_t
+    {
+        const auto stats = pool_->Statistics();
+        const auto it = stats.find(ot::api::internal::value(type));
+
+        return (stats.end() == it) ? 0u : it->second.finished_;
+    }
+
+    // Counts one completed task and signals done_ when target is reached
+    auto task(const std::size_t target) noexcept
+    {
+        return [this, target] {
+            if (target == ++counter_) { promise_.set_value(); }
+        };
+    }
+
+    Test_ThreadPool()
+        : counter_(0)
+        , promise_()
+        , done_(promise_.get_future())
+        , pool_(ot::factory::ThreadPool(ot::Context().ZMQ()))
+    {
+    }
+};
+
+TEST_F(Test_ThreadPool, distinct_endpoints)
+{
+    ASSERT_TRUE(pool_);
+    EXPECT_NE(pool_->Endpoint(), ot::Context().ThreadPool().Endpoint());
+}
+
+TEST_F(Test_ThreadPool, completes_submitted_tasks)
+{
+    constexpr auto count = std::size_t{1000};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        const auto type = (0u == i % 2u) ? Work::BlockchainWallet
+                                         : Work::CalculateBlockFilters;
+
+        ASSERT_TRUE(
+            pool_->Submit(ot::api::internal::value(type), task(count)));
+    }
+
+    ASSERT_EQ(done_.wait_for(timeout_), std::future_status::ready);
+    EXPECT_EQ(counter_.load(), count);
+
+    pool_->Shutdown();
+
+    EXPECT_EQ(pool_->QueueDepth(), 0u);
+    EXPECT_EQ(finished(Work::BlockchainWallet), count / 2u);
+    EXPECT_EQ(finished(Work::CalculateBlockFilters), count / 2u);
+}
+
+TEST_F(Test_ThreadPool, completes_tasks_submitted_by_workers)
+{
+    constexpr auto parents = std::size_t{100};
+    constexpr auto children = std::size_t{10};
+    constexpr auto count = parents * (children + 1u);
+    const auto type = ot::api::internal::value(Work::SyncDataFiltersIncoming);
+
+    for (auto i = std::size_t{0}; i < parents; ++i) {
+        ASSERT_TRUE(pool_->Submit(type, [&] {
+            for (auto j = std::size_t{0}; j < children; ++j) {
+                EXPECT_TRUE(pool_->Submit(type, task(count)));
+            }
+
+            task(count)();
+        }));
+    }
+
+    ASSERT_EQ(done_.wait_for(timeout_), std::future_status::ready);
+    EXPECT_EQ(counter_.load(), count);
+}
+
+TEST_F(Test_ThreadPool, shutdown_drains_queued_tasks)
+{
+    constexpr auto count = std::size_t{200};
+    const auto type = ot::api::internal::value(Work::CalculateBlockFilters);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        ASSERT_TRUE(pool_->Submit(type, [this] {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            ++counter_;
+        }));
+    }
+
+    pool_->Shutdown();
+
+    EXPECT_EQ(counter_.load(), count);
+    EXPECT_EQ(pool_->QueueDepth(), 0u);
+    EXPECT_FALSE(pool_->Submit(type, [] {}));
+    EXPECT_EQ(finished(Work::CalculateBlockFilters), count);
+}
+
+TEST_F(Test_ThreadPool, idle_shutdown)
+{
+    // NOTE workers block on a condition variable while idle and must wake up
+    // promptly when the pool stops
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    const auto start = std::chrono::steady_clock::now();
+    pool_->Shutdown();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LT(elapsed, std::chrono::seconds{1});
+
+    pool_->Shutdown();
+}
+}  // namespace ottest
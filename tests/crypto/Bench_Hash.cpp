@@ -0,0 +1,92 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/crypto/library/Sha256.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/crypto/HashType.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+TEST(Bench_Hash, sha256_batch)
+{
+    namespace sha256 = ot::crypto::sha256;
+    using Clock = std::chrono::steady_clock;
+
+    const auto& crypto = ot::Context().Crypto();
+
+    // NOTE similar in size to the transactions in a typical block
+    constexpr auto count = std::size_t{4096};
+    constexpr auto size = std::size_t{250};
+    constexpr auto rounds = std::size_t{10};
+    constexpr auto bytes = count * size * rounds;
+    const auto data = std::vector<char>(count * size, 'a');
+    auto inputs = std::vector<ot::ReadView>{};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        inputs.emplace_back(data.data() + (i * size), size);
+    }
+
+    const auto report = [&](const char* name, const Clock::duration elapsed) {
+        const auto seconds = std::chrono::duration<double>(elapsed).count();
+
+        std::cout << name << ": " << (bytes / seconds / 1000000.0)
+                  << " MB/s, " << (count * rounds / seconds) << " hashes/s\n";
+    };
+    auto expected = ot::Space(count * sha256::digest_bytes_);
+
+    {
+        const auto start = Clock::now();
+
+        for (auto r = std::size_t{0}; r < rounds; ++r) {
+            auto* out = expected.data();
+
+            for (const auto& input : inputs) {
+                crypto.Hash().Digest(
+                    ot::crypto::HashType::Sha256D,
+                    input,
+                    ot::preallocated(sha256::digest_bytes_, out));
+                out += sha256::digest_bytes_;
+            }
+        }
+
+        report("Digest", Clock::now() - start);
+    }
+
+    const auto names = std::vector<std::pair<sha256::Engine, const char*>>{
+        {sha256::Engine::Scalar, "Scalar"},
+        {sha256::Engine::SSE41, "SSE41"},
+        {sha256::Engine::AVX2, "AVX2"},
+    };
+
+    for (const auto& [engine, name] : names) {
+        if (false == sha256::Supported(engine)) { continue; }
+
+        auto output = ot::Space(expected.size());
+        const auto start = Clock::now();
+
+        for (auto r = std::size_t{0}; r < rounds; ++r) {
+            EXPECT_TRUE(sha256::Batch(engine, inputs, true, output.data()));
+        }
+
+        report(name, Clock::now() - start);
+
+        EXPECT_EQ(output, expected);
+    }
+}
+}  // namespace ottest
@@ -6,6 +6,8 @@
 #include <gtest/gtest.h>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <random>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -13,6 +15,7 @@
 #include <vector>
 
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/crypto/library/Sha256.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -499,4 +502,67 @@ TEST_F(Test_Hash, nist_gigabyte_string)
     EXPECT_EQ(calculatedSha256.get(), eSha256);
     EXPECT_EQ(calculatedSha512.get(), eSha512);
 }
+
+TEST_F(Test_Hash, sha256_batch)
+{
+    namespace sha256 = ot::crypto::sha256;
+
+    auto rng = std::mt19937{7};
+    auto data = std::vector<std::string>{};
+
+    for (const auto& vector : nist_hashes_) {
+        data.emplace_back(vector.input_);
+    }
+
+    // NOTE cover every padding boundary plus a spread of random lengths
+    for (auto size = std::size_t{0}; size < 300u; ++size) {
+        auto& input = data.emplace_back(size, '\0');
+
+        for (auto& c : input) { c = static_cast<char>(rng()); }
+    }
+
+    auto inputs = std::vector<ot::ReadView>{};
+
+    for (const auto& input : data) { inputs.emplace_back(input); }
+
+    for (const auto type :
+         {ot::crypto::HashType::Sha256, ot::crypto::HashType::Sha256D}) {
+        auto expected = ot::Space{};
+
+        for (const auto& input : inputs) {
+            auto digest = ot::Space{};
+
+            ASSERT_TRUE(crypto_.Hash().Digest(type, input, ot::writer(digest)));
+
+            expected.insert(expected.end(), digest.begin(), digest.end());
+        }
+
+        const auto twice = (ot::crypto::HashType::Sha256D == type);
+
+        for (const auto engine :
+             {sha256::Engine::Scalar,
+              sha256::Engine::SSE41,
+              sha256::Engine::AVX2}) {
+            auto output = ot::Space(expected.size());
+            const auto hashed =
+                sha256::Batch(engine, inputs, twice, output.data());
+
+            EXPECT_EQ(hashed, sha256::Supported(engine));
+
+            if (hashed) { EXPECT_EQ(output, expected); }
+        }
+
+        auto output = ot::Space{};
+
+        EXPECT_TRUE(
+            crypto_.Hash().DigestBatch(type, inputs, ot::writer(output)));
+        EXPECT_EQ(output, expected);
+    }
+
+    auto output = ot::Space{};
+
+    EXPECT_TRUE(crypto_.Hash().DigestBatch(
+        ot::crypto::HashType::Sha256, {}, ot::writer(output)));
+    EXPECT_TRUE(output.empty());
+}
 }  // namespace
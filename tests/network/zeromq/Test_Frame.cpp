@@ -5,9 +5,12 @@
 
 #include <gtest/gtest.h>
 #include <zmq.h>
+#include <memory>
 #include <string>
 
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/network/Factory.hpp"
+#include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/network/zeromq/Frame.hpp"
@@ -82,4 +85,53 @@ TEST_F(Frame, zmq_msg_t)
 
     EXPECT_NE(ptr, nullptr);
 }
+
+TEST_F(Frame, shared_owner)
+{
+    auto owner = std::make_shared<const std::string>(test_string_);
+    const auto weak = std::weak_ptr<const std::string>{owner};
+    const auto* data = owner->data();
+    const auto view = ot::ReadView{*owner};
+
+    {
+        auto message = zmq::Message::Factory();
+        message->AddFrame();
+        message->Replace(
+            0u, ot::OTZMQFrame{ot::factory::ZMQFrame(std::move(owner), view)});
+        const auto& frame = message->at(0u);
+
+        // NOTE the frame refers to the owner's bytes instead of copying them
+        EXPECT_EQ(frame.data(), data);
+        EXPECT_EQ(frame.Bytes(), test_string_);
+        EXPECT_FALSE(weak.expired());
+
+        // NOTE a copied frame owns its own bytes
+        const auto copy = ot::OTZMQFrame{frame};
+
+        EXPECT_NE(copy->data(), data);
+        EXPECT_EQ(copy->Bytes(), test_string_);
+        EXPECT_EQ(weak.use_count(), 1);
+    }
+
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST_F(Frame, shared_owner_subview)
+{
+    auto owner = std::make_shared<const std::string>(test_string_);
+    const auto weak = std::weak_ptr<const std::string>{owner};
+    const auto view = ot::ReadView{*owner}.substr(4u);
+
+    {
+        auto frame = ot::OTZMQFrame{ot::factory::ZMQFrame(owner, view)};
+        owner.reset();
+
+        EXPECT_FALSE(weak.expired());
+        EXPECT_EQ(frame->data(), view.data());
+        EXPECT_EQ(frame->size(), view.size());
+        EXPECT_EQ(frame->Bytes(), "String");
+    }
+
+    EXPECT_TRUE(weak.expired());
+}
 }  // namespace ottest
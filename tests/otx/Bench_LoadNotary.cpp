@@ -0,0 +1,36 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <iostream>
+
+#include "otx/LoadNotary.hpp"
+
+namespace ottest
+{
+class Bench_LoadNotary : public LoadNotary
+{
+};
+
+// Measures legacy request throughput of a notary as a function of the number
+// of worker threads
+TEST_F(Bench_LoadNotary, requests_per_worker_count)
+{
+    constexpr auto nyms = std::size_t{8};
+    constexpr auto requests = std::size_t{25};
+    auto instance{0};
+
+    for (const auto workers : {1u, 2u, 4u, 8u}) {
+        const auto seconds = run(instance++, workers, nyms, requests);
+        const auto rate = (nyms * requests) / seconds;
+
+        EXPECT_LT(0.0, rate);
+
+        std::cout << workers << " workers: " << rate << " requests/second"
+                  << std::endl;
+    }
+}
+}  // namespace ottest
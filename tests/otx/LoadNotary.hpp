@@ -0,0 +1,265 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "internal/api/client/Client.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/SharedPimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Editor.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/client/OTX.hpp"
+#include "opentxs/api/server/Manager.hpp"
+#include "opentxs/contact/ContactItemType.hpp"
+#include "opentxs/core/Account.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/PasswordPrompt.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/core/contract/ServerContract.hpp"
+#include "opentxs/core/contract/UnitDefinition.hpp"
+#include "opentxs/core/identifier/Nym.hpp"
+#include "opentxs/core/identifier/Server.hpp"
+#include "opentxs/core/identifier/UnitDefinition.hpp"
+#include "opentxs/identity/Nym.hpp"
+#include "opentxs/otx/LastReplyStatus.hpp"
+#include "opentxs/otx/consensus/Server.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+// Starts a notary with the specified number of worker threads and sends
+// legacy requests to it. Every nym sends its requests from a separate thread
+// and only touches its own nym and accounts, so the requests only contend for
+// server resources.
+class LoadNotary : public ::testing::Test
+{
+public:
+    struct Issuer {
+        ot::OTNymID nym_;
+        ot::OTIdentifier issuer_account_;
+        ot::OTIdentifier holder_account_;
+    };
+
+    const ot::api::client::internal::Manager& client_;
+    ot::OTPasswordPrompt reason_;
+
+    // Returns the number of seconds needed to process every request
+    auto run(
+        const int instance,
+        const std::size_t workers,
+        const std::size_t nymCount,
+        const std::size_t requests) -> double
+    {
+        const auto& serverID = start_server(instance, workers).ID();
+        const auto nyms = register_nyms(instance, serverID, nymCount);
+        auto failures = std::atomic<std::size_t>{0};
+        auto threads = std::vector<std::thread>{};
+        const auto start = std::chrono::steady_clock::now();
+
+        for (const auto& id : nyms) {
+            threads.emplace_back([&, nymID = id] {
+                auto context = client_.Wallet().mutable_ServerContext(
+                    nymID, serverID, reason_);
+
+                for (auto i = std::size_t{0}; i < requests; ++i) {
+                    auto sent{false};
+                    context.get().UpdateRequestNumber(sent, reason_);
+
+                    if (false == sent) { ++failures; }
+                }
+            });
+        }
+
+        for (auto& thread : threads) { thread.join(); }
+
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                std::chrono::steady_clock::now() - start);
+
+        EXPECT_EQ(failures.load(), 0u);
+
+        return elapsed.count();
+    }
+
+    // Every nym issues its own unit and transfers from the issuer account to
+    // a second account of the same unit, so no two nyms share an account.
+    // Returns the number of seconds needed to process every transfer.
+    auto transfers(
+        const int instance,
+        const std::size_t workers,
+        const std::size_t nymCount,
+        const std::size_t count) -> double
+    {
+        constexpr auto amount = ot::Amount{100};
+        const auto& server = start_server(instance, workers);
+        const auto& serverID = server.ID();
+        auto issuers = std::vector<Issuer>{};
+
+        for (const auto& nym : register_nyms(instance, serverID, nymCount)) {
+            issuers.emplace_back(issue(nym, serverID));
+        }
+
+        auto failures = std::atomic<std::size_t>{0};
+        auto threads = std::vector<std::thread>{};
+        const auto start = std::chrono::steady_clock::now();
+
+        for (const auto& issuer : issuers) {
+            threads.emplace_back([&, &issuer = issuer] {
+                for (auto i = std::size_t{0}; i < count; ++i) {
+                    auto task = client_.OTX().SendTransfer(
+                        issuer.nym_,
+                        serverID,
+                        issuer.issuer_account_,
+                        issuer.holder_account_,
+                        amount,
+                        "transfer " + std::to_string(i));
+                    const auto status = task.second.get().first;
+
+                    if (ot::otx::LastReplyStatus::MessageSuccess != status) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads) { thread.join(); }
+
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                std::chrono::steady_clock::now() - start);
+
+        EXPECT_EQ(failures.load(), 0u);
+
+        for (const auto& issuer : issuers) {
+            const auto account =
+                server.Wallet().Account(issuer.issuer_account_);
+
+            EXPECT_TRUE(account);
+
+            if (false == bool(account)) { continue; }
+
+            EXPECT_EQ(
+                account.get().GetBalance(),
+                -1 * amount * static_cast<ot::Amount>(count));
+        }
+
+        return elapsed.count();
+    }
+
+    LoadNotary()
+        : client_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient(OTTestEnvironment::Args(), 0)))
+        , reason_(client_.Factory().PasswordPrompt(__FUNCTION__))
+    {
+    }
+
+private:
+    auto issue(
+        const ot::identifier::Nym& nymID,
+        const ot::identifier::Server& serverID) -> Issuer
+    {
+        const auto contract = client_.Wallet().UnitDefinition(
+            nymID.str(),
+            "Load test units",
+            "Load test units",
+            "L",
+            "Only used by the notary load test",
+            "LTU",
+            2,
+            "cents",
+            ot::contact::ContactItemType::USD,
+            reason_);
+        const auto unitID = client_.Factory().UnitID(contract->ID()->str());
+        auto issued = client_.OTX().IssueUnitDefinition(
+            nymID, serverID, unitID, ot::contact::ContactItemType::USD);
+        const auto [issuedStatus, issuedReply] = issued.second.get();
+
+        EXPECT_EQ(ot::otx::LastReplyStatus::MessageSuccess, issuedStatus);
+
+        auto registered =
+            client_.OTX().RegisterAccount(nymID, serverID, unitID);
+        const auto [registeredStatus, registeredReply] =
+            registered.second.get();
+
+        EXPECT_EQ(ot::otx::LastReplyStatus::MessageSuccess, registeredStatus);
+
+        client_.OTX().ContextIdle(nymID, serverID).get();
+        auto output = Issuer{
+            nymID,
+            ot::Identifier::Factory(
+                issuedReply ? issuedReply->m_strAcctID : ot::String::Factory()),
+            ot::Identifier::Factory(
+                registeredReply ? registeredReply->m_strAcctID
+                                : ot::String::Factory())};
+
+        EXPECT_FALSE(output.issuer_account_->empty());
+        EXPECT_FALSE(output.holder_account_->empty());
+
+        return output;
+    }
+
+    auto register_nyms(
+        const int instance,
+        const ot::identifier::Server& serverID,
+        const std::size_t count) -> std::vector<ot::OTNymID>
+    {
+        auto output = std::vector<ot::OTNymID>{};
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto nym = client_.Wallet().Nym(
+                reason_,
+                "Nym " + std::to_string(instance) + "-" + std::to_string(i));
+
+            EXPECT_TRUE(nym);
+
+            const auto& id = nym->ID();
+            auto task = client_.OTX().RegisterNymPublic(id, serverID, true);
+
+            EXPECT_EQ(
+                ot::otx::LastReplyStatus::MessageSuccess,
+                task.second.get().first);
+
+            client_.OTX().ContextIdle(id, serverID).get();
+            output.emplace_back(id);
+        }
+
+        return output;
+    }
+
+    auto start_server(const int instance, const std::size_t workers)
+        -> const ot::api::server::Manager&
+    {
+        auto args = OTTestEnvironment::Args();
+        args[OPENTXS_ARG_NOTARY_WORKERS] = {std::to_string(workers)};
+        const auto& server = ot::Context().StartServer(args, instance, true);
+        const auto& serverID = server.ID();
+        auto bytes = ot::Space{};
+        const auto contract = server.Wallet().Server(serverID);
+
+        EXPECT_TRUE(contract->Serialize(ot::writer(bytes), true));
+
+        client_.Wallet().Server(ot::reader(bytes));
+
+        return server;
+    }
+};
+}  // namespace ottest
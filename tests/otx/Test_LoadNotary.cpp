@@ -0,0 +1,34 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+
+#include "otx/LoadNotary.hpp"
+
+namespace ottest
+{
+class Test_LoadNotary : public LoadNotary
+{
+};
+
+TEST_F(Test_LoadNotary, concurrent_requests)
+{
+    constexpr auto workers = std::size_t{4};
+    constexpr auto nyms = std::size_t{4};
+    constexpr auto requests = std::size_t{5};
+
+    run(0, workers, nyms, requests);
+}
+
+TEST_F(Test_LoadNotary, concurrent_transfers)
+{
+    constexpr auto workers = std::size_t{4};
+    constexpr auto nyms = std::size_t{4};
+    constexpr auto transfers = std::size_t{3};
+
+    this->transfers(1, workers, nyms, transfers);
+}
+}  // namespace ottest
@@ -0,0 +1,119 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "ui/base/Items.hpp"
+
+namespace
+{
+using Key = std::string;
+using ID = int;
+using Value = std::string;
+using Type =
+    opentxs::ui::implementation::ListItems<ID, Key, std::shared_ptr<Value>>;
+
+TEST(Bench_Items, populate)
+{
+    using Clock = std::chrono::steady_clock;
+    using Seconds = std::chrono::duration<double>;
+
+    for (const auto count : {10000u, 100000u, 1000000u}) {
+        auto items = Type{false};
+        auto ids = std::vector<ID>(count);
+        auto rng = std::mt19937{static_cast<std::mt19937::result_type>(count)};
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            ids[i] = static_cast<ID>(i);
+        }
+
+        std::shuffle(ids.begin(), ids.end(), rng);
+        const auto key = [](const ID id) { return std::to_string(id % 1000); };
+        auto start = Clock::now();
+
+        for (const auto id : ids) {
+            const auto [it, index] = items.find_insert_position(key(id), id);
+            items.insert_before(it, key(id), id, std::make_shared<Value>());
+        }
+
+        const auto insert = Seconds{Clock::now() - start};
+
+        ASSERT_EQ(items.size(), count);
+
+        start = Clock::now();
+
+        for (auto i = std::size_t{0}; i < count; i += 7) {
+            const auto id = ids[i];
+            const auto newKey = key(id + 500);
+            auto move = items.find_move_position(id, newKey, id);
+
+            ASSERT_TRUE(move);
+
+            auto& [from, to] = move.value();
+            items.move_before(id, from.first, newKey, id, to.first);
+        }
+
+        const auto move = Seconds{Clock::now() - start};
+        start = Clock::now();
+
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            const auto& row = items.at(i);
+            const auto index = items.get_index(row.id_);
+
+            ASSERT_TRUE(index);
+            EXPECT_EQ(index.value(), i);
+        }
+
+        const auto lookup = Seconds{Clock::now() - start};
+
+        {
+            auto previous = items.begin();
+            auto position = std::size_t{1};
+
+            for (auto it{std::next(previous)}; it != items.end();
+                 ++it, ++previous, ++position) {
+                const auto ordered =
+                    (previous->key_ < it->key_) ||
+                    ((previous->key_ == it->key_) && (previous->id_ < it->id_));
+
+                ASSERT_TRUE(ordered);
+            }
+
+            EXPECT_EQ(position, count);
+        }
+
+        start = Clock::now();
+
+        for (auto i = std::size_t{0}; i < count; i += 2) {
+            const auto id = ids[i];
+            auto position = items.find_delete_position(id);
+
+            ASSERT_TRUE(position);
+
+            items.delete_row(id, position.value().first);
+        }
+
+        const auto remove = Seconds{Clock::now() - start};
+
+        EXPECT_EQ(items.size(), count / 2);
+
+        std::cout << count << " rows: insert " << insert.count() << " s, move "
+                  << move.count() << " s, lookup " << lookup.count()
+                  << " s, delete " << remove.count() << " s\n";
+    }
+}
+}  // namespace
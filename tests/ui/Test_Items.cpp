@@ -4,10 +4,13 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <optional>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -490,4 +493,77 @@ TEST(UI_items, reverse_sort)
     EXPECT_TRUE(test_row(items, 4, vector_.at(1)));
     EXPECT_TRUE(test_row(items, 5, vector_.at(0)));
 }
+
+TEST(UI_items, populate)
+{
+    constexpr auto count = std::size_t{2000};
+    auto items = Type{false};
+    auto ids = std::vector<ID>(count);
+    auto rng = std::mt19937{static_cast<std::mt19937::result_type>(count)};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        ids[i] = static_cast<ID>(i);
+    }
+
+    std::shuffle(ids.begin(), ids.end(), rng);
+    const auto key = [](const ID id) { return std::to_string(id % 100); };
+    const auto check = [&](const std::size_t expected) {
+        ASSERT_EQ(items.size(), expected);
+
+        for (auto i = std::size_t{0}; i < expected; ++i) {
+            const auto& row = items.at(i);
+            const auto index = items.get_index(row.id_);
+
+            ASSERT_TRUE(index);
+            EXPECT_EQ(index.value(), i);
+        }
+
+        if (0u == expected) { return; }
+
+        auto previous = items.begin();
+        auto position = std::size_t{1};
+
+        for (auto it{std::next(previous)}; it != items.end();
+             ++it, ++previous, ++position) {
+            const auto ordered =
+                (previous->key_ < it->key_) ||
+                ((previous->key_ == it->key_) && (previous->id_ < it->id_));
+
+            ASSERT_TRUE(ordered);
+        }
+
+        EXPECT_EQ(position, expected);
+    };
+
+    for (const auto id : ids) {
+        const auto [it, index] = items.find_insert_position(key(id), id);
+        items.insert_before(it, key(id), id, std::make_shared<Value>());
+    }
+
+    check(count);
+
+    for (auto i = std::size_t{0}; i < count; i += 7) {
+        const auto id = ids[i];
+        const auto newKey = key(id + 50);
+        auto move = items.find_move_position(id, newKey, id);
+
+        ASSERT_TRUE(move);
+
+        auto& [from, to] = move.value();
+        items.move_before(id, from.first, newKey, id, to.first);
+    }
+
+    check(count);
+
+    for (auto i = std::size_t{0}; i < count; i += 2) {
+        const auto id = ids[i];
+        auto position = items.find_delete_position(id);
+
+        ASSERT_TRUE(position);
+
+        items.delete_row(id, position.value().first);
+    }
+
+    check(count / 2);
+}
 }  // namespace
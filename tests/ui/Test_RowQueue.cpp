@@ -0,0 +1,164 @@
+// Copyright (c) 2010-2021 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "ui/base/RowQueue.hpp"
+
+namespace
+{
+using Key = std::string;
+using Time = int;
+using Queue = opentxs::ui::implementation::RowQueue<Key, Time>;
+using Entries = std::vector<Queue::Entry>;
+using Rows = std::set<Key>;
+
+constexpr auto page_ = std::size_t{100};
+
+auto key(const int i) -> Key { return std::to_string(i); }
+
+// Mimics the state machine of a model which constructs one page of rows per
+// pass. Returns the number of passes needed to empty the queue.
+auto fill(Queue& queue, Rows& rows, std::vector<Key>& order) -> std::size_t
+{
+    auto passes = std::size_t{0};
+    const auto skip = [&](const auto& in) { return 0 < rows.count(in); };
+
+    while (false == queue.empty()) {
+        const auto page = queue.next(page_, skip);
+        ++passes;
+
+        EXPECT_LE(page.size(), page_);
+
+        for (const auto& item : page) {
+            EXPECT_TRUE(rows.emplace(item).second);
+
+            order.emplace_back(item);
+        }
+    }
+
+    return passes;
+}
+
+TEST(UI_RowQueue, empty)
+{
+    auto queue = Queue{};
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(queue.next(page_, {}).empty());
+
+    queue.reset({});
+
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(UI_RowQueue, newest_page_first)
+{
+    constexpr auto count = 350;
+    auto queue = Queue{};
+    auto entries = Entries{};
+
+    // NOTE supplied in the same order as the storage index, which is unrelated
+    // to the age of the transactions
+    for (auto i = 0; i < count; ++i) {
+        const auto time = (i * 7919) % count;
+        entries.emplace_back(key(time), time);
+    }
+
+    queue.reset(std::move(entries));
+
+    EXPECT_EQ(queue.size(), static_cast<std::size_t>(count));
+
+    auto rows = Rows{};
+    auto order = std::vector<Key>{};
+    const auto first =
+        queue.next(page_, [&](const auto& in) { return 0 < rows.count(in); });
+
+    ASSERT_EQ(first.size(), page_);
+
+    for (auto i = std::size_t{0}; i < page_; ++i) {
+        EXPECT_EQ(first.at(i), key(count - 1 - static_cast<int>(i)));
+
+        rows.emplace(first.at(i));
+        order.emplace_back(first.at(i));
+    }
+
+    EXPECT_EQ(fill(queue, rows, order), 3u);
+    EXPECT_EQ(rows.size(), static_cast<std::size_t>(count));
+    ASSERT_EQ(order.size(), static_cast<std::size_t>(count));
+
+    for (auto i = 0; i < count; ++i) {
+        EXPECT_EQ(order.at(static_cast<std::size_t>(i)), key(count - 1 - i));
+    }
+}
+
+TEST(UI_RowQueue, unknown_times_last)
+{
+    auto queue = Queue{};
+    queue.reset({
+        {"b", 0},
+        {"x", 5},
+        {"a", 0},
+        {"y", 9},
+    });
+    auto rows = Rows{};
+    auto order = std::vector<Key>{};
+
+    EXPECT_EQ(fill(queue, rows, order), 1u);
+    EXPECT_EQ(order, (std::vector<Key>{"y", "x", "b", "a"}));
+}
+
+TEST(UI_RowQueue, skip_existing_rows)
+{
+    constexpr auto count = 250;
+    auto queue = Queue{};
+    auto entries = Entries{};
+
+    for (auto i = 0; i < count; ++i) { entries.emplace_back(key(i), i); }
+
+    queue.reset(std::move(entries));
+    auto rows = Rows{};
+    auto order = std::vector<Key>{};
+
+    {
+        const auto page = queue.next(
+            page_, [&](const auto& in) { return 0 < rows.count(in); });
+
+        ASSERT_EQ(page.size(), page_);
+
+        for (const auto& item : page) {
+            rows.emplace(item);
+            order.emplace_back(item);
+        }
+    }
+
+    // Rows created by new transaction notifications between passes are not
+    // constructed again and do not count towards the size of a page
+    for (auto i = 0; i < 60; ++i) { rows.emplace(key(i)); }
+
+    EXPECT_EQ(fill(queue, rows, order), 1u);
+    EXPECT_EQ(rows.size(), static_cast<std::size_t>(count));
+    EXPECT_EQ(order.size(), static_cast<std::size_t>(count - 60));
+    EXPECT_EQ(order.back(), key(60));
+}
+
+TEST(UI_RowQueue, reset)
+{
+    auto queue = Queue{};
+    queue.reset({{"a", 1}, {"b", 2}});
+    queue.reset({{"c", 3}});
+
+    const auto page = queue.next(page_, {});
+
+    EXPECT_EQ(page, (std::vector<Key>{"c"}));
+    EXPECT_TRUE(queue.empty());
+}
+}  // namespace